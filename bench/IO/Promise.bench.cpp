@@ -0,0 +1,127 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <f1x/aasdk/IO/Promise.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace bench
+{
+
+// range(0): DispatchMode, POST queues every handler on the io_service, INLINE runs it in place
+void Promise_ResolveThen(benchmark::State& state)
+{
+    boost::asio::io_service ioService;
+    boost::asio::io_service::strand strand(ioService);
+    const auto dispatchMode = static_cast<DispatchMode>(state.range(0));
+    size_t resolved = 0;
+
+    for(auto _ : state)
+    {
+        strand.dispatch([&]() {
+            auto promise = Promise<size_t>::defer(strand, dispatchMode);
+            promise->then([&resolved](size_t value) { resolved += value; });
+            promise->resolve(1);
+        });
+
+        ioService.run();
+        ioService.reset();
+    }
+
+    benchmark::DoNotOptimize(resolved);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Promise_ResolveThen)->ArgName("inline")->Arg(static_cast<int64_t>(DispatchMode::POST))->Arg(static_cast<int64_t>(DispatchMode::INLINE));
+
+// range(0): DispatchMode, range(1): chain length, each link resolves the next promise from its handler
+void Promise_Chain(benchmark::State& state)
+{
+    boost::asio::io_service ioService;
+    boost::asio::io_service::strand strand(ioService);
+    const auto dispatchMode = static_cast<DispatchMode>(state.range(0));
+    const auto length = static_cast<size_t>(state.range(1));
+    std::vector<Promise<void>::Pointer> promises;
+    size_t resolved = 0;
+
+    for(auto _ : state)
+    {
+        strand.dispatch([&]() {
+            promises.clear();
+            for(size_t i = 0; i < length; ++i)
+            {
+                promises.push_back(Promise<void>::defer(strand, dispatchMode));
+            }
+
+            for(size_t i = 0; i < length; ++i)
+            {
+                promises[i]->then([&, i]() {
+                    ++resolved;
+                    if(i + 1 < length)
+                    {
+                        promises[i + 1]->resolve();
+                    }
+                });
+            }
+
+            promises.front()->resolve();
+        });
+
+        ioService.run();
+        ioService.reset();
+    }
+
+    benchmark::DoNotOptimize(resolved);
+    state.SetItemsProcessed(state.iterations() * length);
+}
+BENCHMARK(Promise_Chain)
+    ->ArgNames({"inline", "length"})
+    ->Args({static_cast<int64_t>(DispatchMode::POST), 8})->Args({static_cast<int64_t>(DispatchMode::INLINE), 8})
+    ->Args({static_cast<int64_t>(DispatchMode::POST), 64})->Args({static_cast<int64_t>(DispatchMode::INLINE), 64});
+
+void Promise_Reject(benchmark::State& state)
+{
+    boost::asio::io_service ioService;
+    boost::asio::io_service::strand strand(ioService);
+    size_t rejected = 0;
+
+    for(auto _ : state)
+    {
+        strand.dispatch([&]() {
+            auto promise = Promise<void>::defer(strand, DispatchMode::INLINE);
+            promise->then([]() {}, [&rejected](const error::Error&) { ++rejected; });
+            promise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+        });
+
+        ioService.run();
+        ioService.reset();
+    }
+
+    benchmark::DoNotOptimize(rejected);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Promise_Reject);
+
+}
+}
+}
+}
@@ -0,0 +1,84 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <f1x/aasdk/Messenger/ChannelReceiveMessageQueue.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace bench
+{
+
+// range(0): number of channels the messages are spread over, range(1): messages queued before popping
+void ChannelReceiveMessageQueue_PushPop(benchmark::State& state)
+{
+    static const ChannelId channelIds[] = {ChannelId::CONTROL, ChannelId::VIDEO, ChannelId::MEDIA_AUDIO, ChannelId::SPEECH_AUDIO,
+                                           ChannelId::SYSTEM_AUDIO, ChannelId::AV_INPUT, ChannelId::INPUT, ChannelId::SENSOR};
+    const auto channelCount = static_cast<size_t>(state.range(0));
+    const auto depth = static_cast<size_t>(state.range(1));
+
+    std::vector<Message::Pointer> messages;
+    for(size_t i = 0; i < depth; ++i)
+    {
+        messages.push_back(std::make_shared<Message>(channelIds[i % channelCount], EncryptionType::PLAIN, MessageType::SPECIFIC));
+    }
+
+    ChannelReceiveMessageQueue queue;
+
+    for(auto _ : state)
+    {
+        for(const auto& message : messages)
+        {
+            queue.push(message);
+        }
+
+        for(const auto& message : messages)
+        {
+            benchmark::DoNotOptimize(queue.pop(message->getChannelId()));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * depth);
+}
+BENCHMARK(ChannelReceiveMessageQueue_PushPop)
+    ->ArgNames({"channels", "depth"})
+    ->Args({1, 1})->Args({1, 32})->Args({4, 32})->Args({8, 256});
+
+void ChannelReceiveMessageQueue_Empty(benchmark::State& state)
+{
+    ChannelReceiveMessageQueue queue;
+    queue.push(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::PLAIN, MessageType::SPECIFIC));
+
+    for(auto _ : state)
+    {
+        benchmark::DoNotOptimize(queue.empty(ChannelId::VIDEO));
+        benchmark::DoNotOptimize(queue.empty(ChannelId::MEDIA_AUDIO));
+    }
+
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+BENCHMARK(ChannelReceiveMessageQueue_Empty);
+
+}
+}
+}
+}
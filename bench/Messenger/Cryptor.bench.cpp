@@ -0,0 +1,203 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <deque>
+#include <benchmark/benchmark.h>
+#include <f1x/aasdk/Transport/SSLWrapper.hpp>
+#include <f1x/aasdk/Messenger/Cryptor.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace bench
+{
+
+// Head unit cryptor (TLS client) paired with a phone side cryptor acting as the in-process
+// OpenSSL server; both sit on their own memory BIOs and the handshake records are shuttled
+// between them, so the measured session uses the cipher suite a real handshake negotiates.
+class CryptorPair
+{
+public:
+    CryptorPair()
+        : sslWrapper_(std::make_shared<transport::SSLWrapper>())
+        , client(std::make_shared<Cryptor>(sslWrapper_))
+        , server(std::make_shared<Cryptor>(sslWrapper_, Cryptor::Role::SERVER))
+    {
+        client->init();
+        server->init();
+    }
+
+    ~CryptorPair()
+    {
+        client->deinit();
+        server->deinit();
+    }
+
+    void handshake()
+    {
+        bool clientDone = false;
+        bool serverDone = false;
+
+        while(!clientDone || !serverDone)
+        {
+            if(!clientDone)
+            {
+                clientDone = client->doHandshake();
+            }
+
+            const auto clientRecords = client->readHandshakeBuffer();
+            if(!clientRecords.empty())
+            {
+                server->writeHandshakeBuffer(common::DataConstBuffer(clientRecords));
+            }
+
+            if(!serverDone)
+            {
+                serverDone = server->doHandshake();
+            }
+
+            const auto serverRecords = server->readHandshakeBuffer();
+            if(!serverRecords.empty())
+            {
+                client->writeHandshakeBuffer(common::DataConstBuffer(serverRecords));
+            }
+        }
+    }
+
+private:
+    transport::ISSLWrapper::Pointer sslWrapper_;
+
+public:
+    std::shared_ptr<Cryptor> client;
+    std::shared_ptr<Cryptor> server;
+};
+
+// AV media acks and control messages up to full 16 KB video fragments
+void FrameSizes(benchmark::internal::Benchmark* benchmark)
+{
+    benchmark->ArgName("frame");
+    for(auto size : {100, 512, 2048, 8192, 16384})
+    {
+        benchmark->Arg(size);
+    }
+}
+
+void Cryptor_Handshake(benchmark::State& state)
+{
+    for(auto _ : state)
+    {
+        CryptorPair cryptorPair;
+        cryptorPair.handshake();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Cryptor_Handshake)->Unit(benchmark::kMicrosecond);
+
+void Cryptor_Encrypt(benchmark::State& state)
+{
+    CryptorPair cryptorPair;
+    cryptorPair.handshake();
+    state.SetLabel(cryptorPair.client->getCipherName());
+
+    const common::Data payload(static_cast<size_t>(state.range(0)), 0xAA);
+    common::Data output;
+    size_t recordBytes = 0;
+
+    for(auto _ : state)
+    {
+        output.clear();
+        recordBytes += cryptorPair.client->encrypt(output, common::DataConstBuffer(payload));
+    }
+
+    state.SetBytesProcessed(state.iterations() * payload.size());
+    state.counters["overhead"] = benchmark::Counter(static_cast<double>(recordBytes) / (state.iterations() * payload.size()));
+}
+BENCHMARK(Cryptor_Encrypt)->Apply(FrameSizes);
+
+void Cryptor_Decrypt(benchmark::State& state)
+{
+    // records have to be decrypted in the order they were sealed, so they are produced in batches outside of the timing
+    static constexpr size_t cBatchSize = 256;
+
+    CryptorPair cryptorPair;
+    cryptorPair.handshake();
+    state.SetLabel(cryptorPair.client->getCipherName());
+
+    const common::Data payload(static_cast<size_t>(state.range(0)), 0xAA);
+    std::deque<common::Data> records;
+    common::Data output;
+
+    for(auto _ : state)
+    {
+        if(records.empty())
+        {
+            state.PauseTiming();
+            for(size_t i = 0; i < cBatchSize; ++i)
+            {
+                common::Data record;
+                cryptorPair.server->encrypt(record, common::DataConstBuffer(payload));
+                records.push_back(std::move(record));
+            }
+            state.ResumeTiming();
+        }
+
+        output.clear();
+        cryptorPair.client->decrypt(output, common::DataConstBuffer(records.front()));
+        records.pop_front();
+    }
+
+    state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(Cryptor_Decrypt)->Apply(FrameSizes);
+
+// per-frame latency of one frame through both ends: head unit encrypt, phone decrypt
+void Cryptor_RoundTrip(benchmark::State& state)
+{
+    CryptorPair cryptorPair;
+    cryptorPair.handshake();
+    state.SetLabel(cryptorPair.client->getCipherName());
+
+    const common::Data payload(static_cast<size_t>(state.range(0)), 0xAA);
+    common::Data record;
+    common::Data output;
+
+    for(auto _ : state)
+    {
+        record.clear();
+        output.clear();
+        cryptorPair.client->encrypt(record, common::DataConstBuffer(payload));
+        cryptorPair.server->decrypt(output, common::DataConstBuffer(record));
+    }
+
+    if(output != payload)
+    {
+        state.SkipWithError("decrypted payload does not match");
+    }
+
+    state.SetBytesProcessed(state.iterations() * payload.size());
+}
+BENCHMARK(Cryptor_RoundTrip)->Apply(FrameSizes);
+
+}
+}
+}
+}
@@ -0,0 +1,94 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <f1x/aasdk/Messenger/FrameHeader.hpp>
+#include <f1x/aasdk/Messenger/FrameSize.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace bench
+{
+
+void FrameHeader_Encode(benchmark::State& state)
+{
+    for(auto _ : state)
+    {
+        FrameHeader frameHeader(ChannelId::VIDEO, FrameType::FIRST, EncryptionType::ENCRYPTED, MessageType::SPECIFIC);
+        benchmark::DoNotOptimize(frameHeader.getData());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(FrameHeader_Encode);
+
+void FrameHeader_Decode(benchmark::State& state)
+{
+    const auto data = FrameHeader(ChannelId::VIDEO, FrameType::FIRST, EncryptionType::ENCRYPTED, MessageType::SPECIFIC).getData();
+    const common::DataConstBuffer buffer(data);
+
+    for(auto _ : state)
+    {
+        FrameHeader frameHeader(buffer);
+        benchmark::DoNotOptimize(frameHeader.getChannelId());
+        benchmark::DoNotOptimize(frameHeader.getType());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(FrameHeader_Decode);
+
+// range(0): 0 - short frame size, 1 - extended frame size with total size
+void FrameSize_Encode(benchmark::State& state)
+{
+    const bool extended = state.range(0) != 0;
+
+    for(auto _ : state)
+    {
+        FrameSize frameSize = extended ? FrameSize(0x4000, 0x100000) : FrameSize(0x4000);
+        benchmark::DoNotOptimize(frameSize.getData());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(FrameSize_Encode)->ArgName("extended")->Arg(0)->Arg(1);
+
+void FrameSize_Decode(benchmark::State& state)
+{
+    const bool extended = state.range(0) != 0;
+    const auto data = extended ? FrameSize(0x4000, 0x100000).getData() : FrameSize(0x4000).getData();
+    const common::DataConstBuffer buffer(data);
+
+    for(auto _ : state)
+    {
+        FrameSize frameSize(buffer);
+        benchmark::DoNotOptimize(frameSize.getSize());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(FrameSize_Decode)->ArgName("extended")->Arg(0)->Arg(1);
+
+}
+}
+}
+}
@@ -0,0 +1,94 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <f1x/aasdk/Transport/ITransport.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace bench
+{
+
+// completes every send in place, so only the framing cost of MessageOutStream is measured
+class NullTransport: public transport::ITransport
+{
+public:
+    void receive(size_t, ReceivePromise::Pointer promise) override
+    {
+        promise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+    }
+
+    void send(common::Data data, SendPromise::Pointer promise) override
+    {
+        sentBytes += data.size();
+        ++sentFrames;
+        promise->resolve();
+    }
+
+    void stop() override
+    {
+    }
+
+    size_t sentBytes = 0;
+    size_t sentFrames = 0;
+};
+
+// range(0): message payload size, range(1): max frame payload size
+void MessageOutStream_Fragmentation(benchmark::State& state)
+{
+    boost::asio::io_service ioService;
+    boost::asio::io_service::strand strand(ioService);
+    auto transport = std::make_shared<NullTransport>();
+    // the strand constructor completes the frame promises inline, as the single-strand session does
+    auto messageOutStream = std::make_shared<MessageOutStream>(strand, transport, nullptr);
+    messageOutStream->setMaxFramePayloadSize(static_cast<size_t>(state.range(1)));
+
+    const common::Data payload(static_cast<size_t>(state.range(0)), 0xAA);
+
+    for(auto _ : state)
+    {
+        auto message = std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::PLAIN, MessageType::SPECIFIC);
+        message->insertPayload(common::DataConstBuffer(payload));
+
+        auto promise = SendPromise::defer(strand, io::DispatchMode::INLINE);
+        promise->then([]() {}, [&state](const error::Error& e) { state.SkipWithError(e.what()); });
+        messageOutStream->stream(std::move(message), std::move(promise));
+
+        ioService.run();
+        ioService.reset();
+    }
+
+    state.SetBytesProcessed(state.iterations() * payload.size());
+    state.counters["frames"] = benchmark::Counter(static_cast<double>(transport->sentFrames), benchmark::Counter::kAvgIterations);
+    state.counters["overhead"] = benchmark::Counter(static_cast<double>(transport->sentBytes) / (state.iterations() * payload.size()));
+}
+BENCHMARK(MessageOutStream_Fragmentation)
+    ->ArgNames({"payload", "frame"})
+    ->Args({512, 0x4000})->Args({0x4000, 0x4000})
+    ->Args({0x20000, 0x4000})->Args({0x20000, 0xFFFF})
+    ->Args({0x100000, 0x4000})->Args({0x100000, 0xFFFF});
+
+}
+}
+}
+}
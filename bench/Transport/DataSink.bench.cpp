@@ -0,0 +1,79 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <benchmark/benchmark.h>
+#include <f1x/aasdk/Transport/DataSink.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+namespace bench
+{
+
+// range(0): chunk size handed out by fill(), range(1): bytes consumed per consume() call
+void DataSink_FillCommitConsume(benchmark::State& state)
+{
+    const auto chunkSize = static_cast<common::Data::size_type>(state.range(0));
+    const auto consumeSize = static_cast<common::Data::size_type>(state.range(1));
+    DataSink dataSink(chunkSize);
+
+    for(auto _ : state)
+    {
+        auto buffer = dataSink.fill();
+        benchmark::DoNotOptimize(buffer.data);
+        dataSink.commit(buffer.size);
+
+        while(dataSink.getAvailableSize() >= consumeSize)
+        {
+            benchmark::DoNotOptimize(dataSink.consume(consumeSize));
+        }
+    }
+
+    state.SetBytesProcessed(state.iterations() * chunkSize);
+}
+BENCHMARK(DataSink_FillCommitConsume)
+    ->ArgNames({"chunk", "consume"})
+    ->Args({512, 4})->Args({512, 512})
+    ->Args({16384, 4})->Args({16384, 2048})->Args({16384, 16384})
+    ->Args({65536, 16384});
+
+// short commits leave the tail of every filled chunk unused, as with small USB transfers
+void DataSink_PartialCommit(benchmark::State& state)
+{
+    const auto commitSize = static_cast<common::Data::size_type>(state.range(0));
+    DataSink dataSink;
+
+    for(auto _ : state)
+    {
+        auto buffer = dataSink.fill();
+        benchmark::DoNotOptimize(buffer.data);
+        dataSink.commit(commitSize);
+        benchmark::DoNotOptimize(dataSink.consume(commitSize));
+    }
+
+    state.SetBytesProcessed(state.iterations() * commitSize);
+}
+BENCHMARK(DataSink_PartialCommit)->ArgName("commit")->Arg(64)->Arg(1024)->Arg(8192);
+
+}
+}
+}
+}
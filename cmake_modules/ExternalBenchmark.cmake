@@ -0,0 +1,25 @@
+find_package(Threads REQUIRED)
+
+include(ExternalProject)
+ExternalProject_Add(
+  googlebenchmark
+  GIT_REPOSITORY https://github.com/google/benchmark.git
+  GIT_TAG v1.7.1
+  CMAKE_ARGS -DCMAKE_BUILD_TYPE=Release -DBENCHMARK_ENABLE_TESTING=OFF -DBENCHMARK_ENABLE_GTEST_TESTS=OFF
+  UPDATE_COMMAND ""
+  INSTALL_COMMAND ""
+  LOG_DOWNLOAD ON
+  LOG_CONFIGURE ON
+  LOG_BUILD ON)
+
+ExternalProject_Get_Property(googlebenchmark source_dir)
+set(BENCHMARK_INCLUDE_DIRS ${source_dir}/include)
+
+ExternalProject_Get_Property(googlebenchmark binary_dir)
+set(BENCHMARK_LIBRARY_PATH ${binary_dir}/src/${CMAKE_FIND_LIBRARY_PREFIXES}benchmark.a)
+set(BENCHMARK_LIBRARY benchmark)
+add_library(${BENCHMARK_LIBRARY} UNKNOWN IMPORTED)
+set_target_properties(${BENCHMARK_LIBRARY} PROPERTIES
+  IMPORTED_LOCATION ${BENCHMARK_LIBRARY_PATH}
+  IMPORTED_LINK_INTERFACE_LIBRARIES ${CMAKE_THREAD_LIBS_INIT})
+add_dependencies(${BENCHMARK_LIBRARY} googlebenchmark)
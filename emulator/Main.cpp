@@ -0,0 +1,198 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/USB/SimulatedUSBWrapper.hpp>
+#include <f1x/aasdk/USB/AOAPDevice.hpp>
+#include <f1x/aasdk/Transport/USBTransport.hpp>
+#include <f1x/aasdk/Transport/SimulatedPhoneTransport.hpp>
+#include <f1x/aasdk/Transport/SSLWrapper.hpp>
+#include <f1x/aasdk/Messenger/Cryptor.hpp>
+#include <f1x/aasdk/Messenger/MessageInStream.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+#include <f1x/aasdk/Messenger/Messenger.hpp>
+#include <f1x/aasdk/Emulator/PhoneEmulator.hpp>
+#include <f1x/aasdk/Emulator/HeadUnitResponder.hpp>
+
+using namespace f1x::aasdk;
+
+namespace
+{
+
+// Runs the phone emulator against an in-process head unit over the simulated USB link:
+// the head unit side is the regular USBTransport on top of SimulatedUSBWrapper,
+// so the report covers the whole stack from the AOAP endpoints up to the channels.
+void printUsage()
+{
+    std::cerr << "usage: aasdk_emulator [--duration=ms] [--video-bitrate=bps] [--video-frame=bytes]"
+              << " [--audio-bitrate=bps] [--audio-frame=bytes] [--link-rate=bytes per second]"
+              << " [--link-latency=us] [--max-unacked=n]" << std::endl;
+}
+
+bool parseOption(const std::string& argument, const std::string& name, size_t& value)
+{
+    const auto prefix = "--" + name + "=";
+    if(argument.compare(0, prefix.size(), prefix) != 0)
+    {
+        return false;
+    }
+
+    value = std::strtoull(argument.c_str() + prefix.size(), nullptr, 10);
+    return true;
+}
+
+void printHistogram(const char* name, const common::Histogram& histogram)
+{
+    std::cout << "    " << name << " [us]: count " << histogram.getCount()
+              << ", mean " << histogram.getMean()
+              << ", p50 " << histogram.getPercentile(50)
+              << ", p99 " << histogram.getPercentile(99)
+              << ", max " << histogram.getMax() << std::endl;
+}
+
+messenger::IMessenger::Pointer createMessenger(boost::asio::io_service& ioService, transport::ITransport::Pointer transport, messenger::ICryptor::Pointer cryptor)
+{
+    return std::make_shared<messenger::Messenger>(ioService,
+                                                  std::make_shared<messenger::MessageInStream>(ioService, transport, cryptor),
+                                                  std::make_shared<messenger::MessageOutStream>(ioService, transport, cryptor));
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    size_t duration = 10000;
+    size_t videoBitrate = 8000000;
+    size_t videoFrameSize = 32768;
+    size_t audioBitrate = 1536000;
+    size_t audioFrameSize = 2048;
+    size_t linkRate = 0;
+    size_t linkLatency = 100;
+    size_t maxUnacked = 10;
+
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string argument(argv[i]);
+        if(!parseOption(argument, "duration", duration) && !parseOption(argument, "video-bitrate", videoBitrate)
+           && !parseOption(argument, "video-frame", videoFrameSize) && !parseOption(argument, "audio-bitrate", audioBitrate)
+           && !parseOption(argument, "audio-frame", audioFrameSize) && !parseOption(argument, "link-rate", linkRate)
+           && !parseOption(argument, "link-latency", linkLatency) && !parseOption(argument, "max-unacked", maxUnacked))
+        {
+            printUsage();
+            return 1;
+        }
+    }
+
+    boost::asio::io_service ioService;
+
+    usb::SimulatedPhoneConfiguration phoneConfiguration;
+    phoneConfiguration.productId = 0x2D00;
+    phoneConfiguration.bulkTransferLatency = std::chrono::microseconds(linkLatency);
+    phoneConfiguration.bytesPerSecond = linkRate;
+    usb::SimulatedUSBWrapper usbWrapper(ioService, phoneConfiguration);
+    usbWrapper.connectPhone();
+    ioService.run();
+    ioService.reset();
+
+    auto sslWrapper = std::make_shared<transport::SSLWrapper>();
+    auto headUnitCryptor = std::make_shared<messenger::Cryptor>(sslWrapper);
+    auto phoneCryptor = std::make_shared<messenger::Cryptor>(sslWrapper, messenger::Cryptor::Role::SERVER);
+
+    auto aoapDevice = usb::AOAPDevice::create(usbWrapper, ioService, usbWrapper.openDeviceWithVidPid(0x18D1, 0x2D00));
+    transport::ITransport::Pointer headUnitTransport = std::make_shared<transport::USBTransport>(ioService, std::move(aoapDevice));
+    transport::ITransport::Pointer phoneTransport = std::make_shared<transport::SimulatedPhoneTransport>(ioService, usbWrapper);
+    auto headUnitMessenger = createMessenger(ioService, headUnitTransport, headUnitCryptor);
+    auto phoneMessenger = createMessenger(ioService, phoneTransport, phoneCryptor);
+
+    bool finished = false;
+    emulator::HeadUnitResponderConfiguration headUnitConfiguration;
+    headUnitConfiguration.maxUnacked = maxUnacked;
+    auto headUnitResponder = std::make_shared<emulator::HeadUnitResponder>(ioService, headUnitMessenger, headUnitCryptor,
+                                                                           [&finished](const error::Error& e) {
+                                                                               // teardown fails whatever is still pending, only report errors of the run itself
+                                                                               if(!finished)
+                                                                               {
+                                                                                   std::cerr << "head unit: " << e.what() << std::endl;
+                                                                               }
+                                                                           },
+                                                                           std::move(headUnitConfiguration));
+
+    emulator::PhoneEmulatorConfiguration emulatorConfiguration;
+    emulatorConfiguration.streams = {{messenger::ChannelId::VIDEO, videoBitrate, videoFrameSize},
+                                     {messenger::ChannelId::MEDIA_AUDIO, audioBitrate, audioFrameSize}};
+    emulatorConfiguration.streamingDuration = std::chrono::milliseconds(duration);
+    auto phoneEmulator = std::make_shared<emulator::PhoneEmulator>(ioService, phoneMessenger, phoneCryptor, std::move(emulatorConfiguration));
+
+    int result = 0;
+    auto promise = emulator::PhoneEmulator::Promise::defer(ioService);
+    promise->then([&](emulator::PhoneEmulatorReport report) {
+            std::cout << "handshake [us]: " << report.handshakeDuration.count() << std::endl
+                      << "setup [us]: " << report.setupDuration.count() << std::endl
+                      << "streaming [us]: " << report.streamingDuration.count() << std::endl;
+
+            const auto headUnitStatistics = headUnitResponder->getStatistics();
+            for(const auto& stream : report.streams)
+            {
+                std::cout << messenger::channelIdToString(stream.channelId) << ": max unacked " << stream.maxUnacked
+                          << ", sent " << stream.sentFrames << " frames / " << stream.sentBytes << " bytes"
+                          << ", acked " << stream.ackedFrames << " frames / " << stream.ackedBytes << " bytes"
+                          << ", window stalls " << stream.windowStalls
+                          << ", throughput " << stream.throughput << " B/s" << std::endl;
+                printHistogram("ack latency", stream.ackLatency);
+
+                const auto channelStatistics = headUnitStatistics.find(stream.channelId);
+                if(channelStatistics != headUnitStatistics.end())
+                {
+                    printHistogram("one-way latency", channelStatistics->second.latency);
+                }
+            }
+
+            finished = true;
+            headUnitMessenger->stop();
+            phoneMessenger->stop();
+        },
+        [&](const error::Error& e) {
+            std::cerr << "emulator: " << e.what() << std::endl;
+            result = 1;
+            finished = true;
+            headUnitMessenger->stop();
+            phoneMessenger->stop();
+        });
+
+    headUnitResponder->start();
+    phoneEmulator->start(std::move(promise));
+    ioService.run();
+    ioService.reset();
+
+    usbWrapper.disconnectPhone();
+    phoneTransport->stop();
+    headUnitResponder.reset();
+    phoneEmulator.reset();
+    headUnitMessenger.reset();
+    phoneMessenger.reset();
+    headUnitTransport.reset();
+    phoneTransport.reset();
+    ioService.run();
+
+    headUnitCryptor->deinit();
+    phoneCryptor->deinit();
+    return result;
+}
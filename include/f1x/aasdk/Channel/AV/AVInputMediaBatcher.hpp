@@ -0,0 +1,83 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/Channel/AV/IAVInputServiceChannel.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+struct AVInputMediaBatcherStatistics
+{
+    uint64_t capturedPeriods = 0;
+    uint64_t sentMessages = 0;
+    uint64_t sentBytes = 0;
+};
+
+// Collects microphone capture periods straight into pooled AV input message buffers and sends
+// up to maxPeriodsPerMessage periods per AV_MEDIA_WITH_TIMESTAMP_INDICATION, stamped with the
+// timestamp of the first one. A partially filled message is sent once latencyBudget has passed
+// since its first period; a zero budget sends every period on its own. Not thread safe: must be
+// used on the channel strand, so capture threads post their periods there. The channel's buffer
+// pool itself may be used from any thread.
+class AVInputMediaBatcher: public std::enable_shared_from_this<AVInputMediaBatcher>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<AVInputMediaBatcher> Pointer;
+    typedef std::function<void(const error::Error&)> ErrorHandler;
+
+    AVInputMediaBatcher(boost::asio::io_service::strand& strand, IAVInputServiceChannel::Pointer channel, ErrorHandler errorHandler,
+                        size_t maxPeriodsPerMessage = 1, std::chrono::microseconds latencyBudget = std::chrono::microseconds(0));
+
+    // returns size bytes of the pending message to capture the period into, valid until commitPeriod()
+    common::DataBuffer beginPeriod(messenger::Timestamp::ValueType timestamp, size_t size);
+    void commitPeriod();
+    void flush();
+
+    const AVInputMediaBatcherStatistics& getStatistics() const;
+
+private:
+    using std::enable_shared_from_this<AVInputMediaBatcher>::shared_from_this;
+
+    boost::asio::io_service::strand& strand_;
+    boost::asio::steady_timer timer_;
+    IAVInputServiceChannel::Pointer channel_;
+    ErrorHandler errorHandler_;
+    size_t maxPeriodsPerMessage_;
+    std::chrono::microseconds latencyBudget_;
+    common::Data buffer_;
+    messenger::Timestamp::ValueType timestamp_;
+    size_t pendingPeriods_;
+    AVInputMediaBatcherStatistics statistics_;
+};
+
+}
+}
+}
+}
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <mutex>
+#include <vector>
 #include <f1x/aasdk/Messenger/MessageId.hpp>
 #include <f1x/aasdk/Messenger/Timestamp.hpp>
 #include <f1x/aasdk/Channel/ServiceChannel.hpp>
@@ -35,13 +37,15 @@ namespace av
 class AVInputServiceChannel: public IAVInputServiceChannel, public ServiceChannel, public std::enable_shared_from_this<AVInputServiceChannel>
 {
 public:
-    AVInputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger);
+    AVInputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, io::DispatchMode dispatchMode = io::DispatchMode::POST);
 
     void receive(IAVInputServiceChannelEventHandler::Pointer eventHandler) override;
     void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) override;
     void sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise) override;
     void sendAVInputOpenResponse(const proto::messages::AVInputOpenResponse& response, SendPromise::Pointer promise) override;
     void sendAVMediaWithTimestampIndication(messenger::Timestamp::ValueType, const common::Data& data, SendPromise::Pointer promise) override;
+    common::Data acquireAVMediaBuffer(size_t capacity) override;
+    void sendAVMediaWithTimestampIndication(messenger::Timestamp::ValueType timestamp, common::Data&& buffer, SendPromise::Pointer promise) override;
     messenger::ChannelId getId() const override;
 
 private:
@@ -51,6 +55,14 @@ private:
     void handleAVInputOpenRequest(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler);
     void handleAVMediaAckIndication(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler);
     void handleChannelOpenRequest(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler);
+    void releaseAVMediaBuffer(common::Data buffer);
+
+    static constexpr size_t cMaxPooledAVMediaBuffers = 8;
+
+    // acquireAVMediaBuffer() may be called from any thread (a capture thread, or AVInputMediaBatcher on the strand)
+    // and buffers come back from the send completion, so the pool is guarded by its own mutex
+    std::mutex avMediaBufferPoolMutex_;
+    std::vector<common::Data> avMediaBufferPool_;
 };
 
 }
@@ -0,0 +1,100 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <boost/asio.hpp>
+#include <boost/core/noncopyable.hpp>
+#include <aasdk_proto/AVChannelSetupResponseMessage.pb.h>
+#include <aasdk_proto/AVChannelStartIndicationMessage.pb.h>
+#include <aasdk_proto/AVMediaAckIndicationMessage.pb.h>
+#include <f1x/aasdk/Channel/Promise.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+struct AVMediaAckStatistics
+{
+    uint32_t maxUnacked = 0;
+    // frames the phone considers outstanding: buffered by the consumer or consumed but not acked yet
+    size_t inFlightFrames = 0;
+    size_t maxInFlightFrames = 0;
+    // sampled on every received frame
+    double averageInFlightFrames = 0;
+    uint64_t receivedFrames = 0;
+    uint64_t ackedFrames = 0;
+    uint64_t ackIndications = 0;
+    // number of times and total time the phone had a full window and could not send
+    uint64_t stallCount = 0;
+    std::chrono::microseconds stallTime = std::chrono::microseconds(0);
+};
+
+// Paces AVMediaAckIndication for a video or audio channel. A frame is acked only after the consumer
+// has taken it out of its buffer, so the phone never has more than max_unacked frames queued here.
+// Acks of consumed frames are coalesced into one indication (value carries the number of frames)
+// while the consumer buffer is comfortably filled, and sent right away when the buffer runs low or
+// the phone's window is exhausted. All methods must be called on the channel strand.
+class AVMediaAckEngine: boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<AVMediaAckEngine> Pointer;
+    typedef std::chrono::steady_clock Clock;
+    typedef std::function<void(const proto::messages::AVMediaAckIndication&, SendPromise::Pointer)> AckSender;
+
+    AVMediaAckEngine(boost::asio::io_service::strand& strand, AckSender ackSender, size_t lowWatermark = cDefaultLowWatermark);
+
+    void onAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response);
+    void onAVChannelStartIndication(const proto::messages::AVChannelStartIndication& indication);
+    void onAVChannelStopIndication(Clock::time_point now = Clock::now());
+
+    void onMediaReceived(Clock::time_point now = Clock::now());
+    void onMediaConsumed(size_t count = 1, Clock::time_point now = Clock::now());
+    void flush(Clock::time_point now = Clock::now());
+
+    AVMediaAckStatistics getStatistics() const;
+
+    static constexpr size_t cDefaultLowWatermark = 1;
+
+private:
+    bool isWindowFull() const;
+    size_t getMaxBatchSize() const;
+
+    boost::asio::io_service::strand& strand_;
+    AckSender ackSender_;
+    size_t lowWatermark_;
+    int32_t session_;
+    size_t pendingAcks_;
+    bool stalled_;
+    Clock::time_point stallStart_;
+    double inFlightSum_;
+    AVMediaAckStatistics statistics_;
+};
+
+}
+}
+}
+}
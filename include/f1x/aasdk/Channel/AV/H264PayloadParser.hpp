@@ -0,0 +1,94 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <vector>
+#include <f1x/aasdk/Common/Data.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+enum class H264NALUnitType: uint8_t
+{
+    UNSPECIFIED = 0,
+    SLICE = 1,
+    SLICE_DATA_PARTITION_A = 2,
+    SLICE_DATA_PARTITION_B = 3,
+    SLICE_DATA_PARTITION_C = 4,
+    IDR_SLICE = 5,
+    SEI = 6,
+    SPS = 7,
+    PPS = 8,
+    ACCESS_UNIT_DELIMITER = 9,
+    END_OF_SEQUENCE = 10,
+    END_OF_STREAM = 11,
+    FILLER_DATA = 12
+};
+
+struct H264NALUnit
+{
+    H264NALUnitType type;
+    // nal_ref_idc, zero for units no other picture refers to
+    uint8_t referenceIndication;
+    // NAL unit including its header byte, start code and trailing zero bytes excluded;
+    // points into the parsed payload
+    common::DataConstBuffer data;
+};
+
+typedef std::vector<H264NALUnit> H264NALUnits;
+
+// Splits Annex-B H.264 payloads into NAL units without copying them. The start code search
+// uses SSE2 or NEON when the target supports it. The most recent SPS and PPS are copied out
+// so a decoder can be reconfigured at any time, e.g. after a video focus change or a reconnect.
+class H264PayloadParser
+{
+public:
+    H264PayloadParser();
+
+    // appends the NAL units found in payload to units, returns the number of units found
+    size_t parse(const common::DataConstBuffer& payload, H264NALUnits& units);
+    H264NALUnits parse(const common::DataConstBuffer& payload);
+
+    bool hasParameterSets() const;
+    const common::Data& getSPS() const;
+    const common::Data& getPPS() const;
+    // SPS and PPS in Annex-B form, ready to be fed to a decoder ahead of the next IDR slice
+    common::Data getParameterSets() const;
+    void reset();
+
+    // returns pointer to the first byte of the first 00 00 01 sequence in [begin, end) or end
+    static const uint8_t* findStartCode(const uint8_t* begin, const uint8_t* end);
+
+private:
+    void cacheParameterSet(const H264NALUnit& unit);
+
+    common::Data sps_;
+    common::Data pps_;
+};
+
+}
+}
+}
+}
@@ -23,6 +23,7 @@
 #include <aasdk_proto/AVInputOpenResponseMessage.pb.h>
 #include <aasdk_proto/ChannelOpenResponseMessage.pb.h>
 #include <f1x/aasdk/Messenger/ChannelId.hpp>
+#include <f1x/aasdk/Messenger/MessageId.hpp>
 #include <f1x/aasdk/Messenger/Timestamp.hpp>
 #include <f1x/aasdk/Channel/Promise.hpp>
 #include <f1x/aasdk/Channel/AV/IAVInputServiceChannelEventHandler.hpp>
@@ -48,8 +49,14 @@ public:
     virtual void sendChannelOpenResponse(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise) = 0;
     virtual void sendAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response, SendPromise::Pointer promise) = 0;
     virtual void sendAVMediaWithTimestampIndication(messenger::Timestamp::ValueType, const common::Data& data, SendPromise::Pointer promise) = 0;
+    // Capture-side path without copies: acquire a pooled buffer with cAVMediaHeaderSize bytes reserved up front,
+    // append PCM behind them and send it; the header is written in place and the buffer returns to the pool once sent.
+    virtual common::Data acquireAVMediaBuffer(size_t capacity) = 0;
+    virtual void sendAVMediaWithTimestampIndication(messenger::Timestamp::ValueType, common::Data&& buffer, SendPromise::Pointer promise) = 0;
     virtual void sendAVInputOpenResponse(const proto::messages::AVInputOpenResponse& response, SendPromise::Pointer promise) = 0;
     virtual messenger::ChannelId getId() const = 0;
+
+    static constexpr size_t cAVMediaHeaderSize = messenger::MessageId::getSizeOf() + sizeof(messenger::Timestamp::ValueType);
 };
 
 }
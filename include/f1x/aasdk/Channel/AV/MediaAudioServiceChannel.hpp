@@ -32,7 +32,7 @@ namespace av
 class MediaAudioServiceChannel: public AudioServiceChannel
 {
 public:
-    MediaAudioServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger);
+    MediaAudioServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, io::DispatchMode dispatchMode = io::DispatchMode::POST);
 };
 
 }
@@ -0,0 +1,114 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <boost/core/noncopyable.hpp>
+#include <aasdk_proto/AudioConfigData.pb.h>
+#include <f1x/aasdk/Common/Data.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+struct PCMRingBufferStatistics
+{
+    // reads that found less data than requested and were completed with silence
+    uint64_t underruns = 0;
+    // writes that did not fit and were truncated
+    uint64_t overruns = 0;
+    uint64_t droppedFrames = 0;
+    // frames dropped and repeated to follow the producer clock
+    uint64_t skippedFrames = 0;
+    uint64_t repeatedFrames = 0;
+    size_t fillFrames = 0;
+};
+
+// Single-producer/single-consumer PCM ring for one audio channel. The channel strand writes the
+// payloads of AV media indications, the audio sink pulls fixed-size periods from its own thread.
+// Storage is allocated once from the negotiated AudioConfig; neither side locks or allocates.
+// The consumer keeps a smoothed fill level and skips or repeats one frame per read while it is
+// outside target +/- target/4, which compensates the drift between the phone and sink clocks.
+// After an underrun the consumer plays silence until the ring is refilled up to the target.
+class PCMRingBuffer: boost::noncopyable
+{
+public:
+    typedef std::unique_ptr<PCMRingBuffer> Pointer;
+
+    PCMRingBuffer(const proto::data::AudioConfig& audioConfig,
+                  std::chrono::milliseconds capacity = cDefaultCapacity,
+                  std::chrono::milliseconds targetFill = cDefaultTargetFill);
+
+    // producer side, returns the number of bytes stored
+    size_t write(const common::DataConstBuffer& buffer);
+    // consumer side, always fills frames * getFrameSize() bytes of output, returns the number
+    // of frames taken from the ring
+    size_t read(common::Data::value_type* output, size_t frames);
+    // not thread safe, call only while neither side is running
+    void reset();
+
+    size_t getFrameSize() const;
+    size_t getCapacityFrames() const;
+    size_t getTargetFillFrames() const;
+    // safe to call from any thread
+    size_t getFillFrames() const;
+    PCMRingBufferStatistics getStatistics() const;
+
+    static constexpr std::chrono::milliseconds cDefaultCapacity = std::chrono::milliseconds(250);
+    static constexpr std::chrono::milliseconds cDefaultTargetFill = std::chrono::milliseconds(100);
+
+private:
+    static constexpr size_t cCacheLineSize = 64;
+    // weight of the newest sample in the smoothed fill level
+    static constexpr double cFillSmoothing = 1.0 / 16;
+
+    void copyOut(common::Data::value_type* output, size_t offset, size_t size) const;
+
+    size_t frameSize_;
+    size_t capacity_;
+    size_t targetFill_;
+    std::unique_ptr<common::Data::value_type[]> storage_;
+
+    // written by the producer only
+    char producerPadding_[cCacheLineSize];
+    std::atomic<uint64_t> writeOffset_;
+    std::atomic<uint64_t> overruns_;
+    std::atomic<uint64_t> droppedFrames_;
+
+    // written by the consumer only
+    char consumerPadding_[cCacheLineSize];
+    std::atomic<uint64_t> readOffset_;
+    std::atomic<uint64_t> underruns_;
+    std::atomic<uint64_t> skippedFrames_;
+    std::atomic<uint64_t> repeatedFrames_;
+    bool primed_;
+    double smoothedFill_;
+};
+
+}
+}
+}
+}
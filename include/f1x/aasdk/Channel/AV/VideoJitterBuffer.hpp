@@ -0,0 +1,105 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <boost/core/noncopyable.hpp>
+#include <f1x/aasdk/Messenger/Timestamp.hpp>
+#include <f1x/aasdk/Common/Data.hpp>
+#include <f1x/aasdk/Common/Histogram.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+struct VideoJitterBufferStatistics
+{
+    uint64_t receivedFrames = 0;
+    uint64_t deliveredFrames = 0;
+    uint64_t droppedFrames = 0;
+    // time frames spent in the buffer, microseconds
+    common::Histogram bufferingDelay;
+    // how late the dropped frames arrived, microseconds
+    common::Histogram dropLateness;
+};
+
+// Orders video frames by their media timestamp (microseconds) and releases each one at
+// first arrival offset + timestamp + latency budget. The arrival offset follows the fastest
+// frame seen so far, so the budget absorbs network jitter rather than the first frame's delay.
+// A frame arriving after its presentation time, or behind an already delivered one, is late:
+// non-reference frames are dropped, reference frames are kept (the decoder needs them) and
+// shift the timeline forward by their lateness. Time is passed in so captures can be replayed.
+class VideoJitterBuffer: boost::noncopyable
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    struct Frame
+    {
+        messenger::Timestamp::ValueType timestamp;
+        bool reference;
+        Clock::time_point arrival;
+        common::Data data;
+    };
+
+    explicit VideoJitterBuffer(std::chrono::microseconds latencyBudget = cDefaultLatencyBudget);
+
+    // returns false if the frame was dropped as late
+    bool push(messenger::Timestamp::ValueType timestamp, bool reference, common::Data data, Clock::time_point now = Clock::now());
+    // takes out the oldest frame if its presentation time has come
+    bool pop(Frame& frame, Clock::time_point now = Clock::now());
+    // presentation time of the oldest buffered frame, meaningless when empty
+    Clock::time_point getNextPresentationTime() const;
+    bool empty() const;
+    size_t size() const;
+    // forgets the timeline and buffered frames, e.g. on stop or video focus loss; statistics are kept
+    void reset();
+
+    std::chrono::microseconds getLatencyBudget() const;
+    void setLatencyBudget(std::chrono::microseconds latencyBudget);
+    const VideoJitterBufferStatistics& getStatistics() const;
+
+    static constexpr std::chrono::microseconds cDefaultLatencyBudget = std::chrono::microseconds(50000);
+
+private:
+    typedef std::multimap<messenger::Timestamp::ValueType, Frame> Frames;
+
+    Clock::time_point getPresentationTime(messenger::Timestamp::ValueType timestamp) const;
+    static uint64_t toMicroseconds(Clock::duration duration);
+
+    std::chrono::microseconds latencyBudget_;
+    bool anchored_;
+    // local arrival time minus media timestamp of the fastest frame
+    Clock::duration offset_;
+    bool delivered_;
+    messenger::Timestamp::ValueType lastDeliveredTimestamp_;
+    Frames frames_;
+    VideoJitterBufferStatistics statistics_;
+};
+
+}
+}
+}
+}
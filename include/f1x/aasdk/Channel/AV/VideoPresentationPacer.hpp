@@ -0,0 +1,84 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/Channel/AV/VideoJitterBuffer.hpp>
+#include <f1x/aasdk/Channel/AV/H264PayloadParser.hpp>
+#include <f1x/aasdk/IO/ITimer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+// Optional stage between the video channel and the decoder. Frames handed over from
+// onAVMediaWithTimestampIndication are copied into a VideoJitterBuffer and passed to the frame
+// handler at their presentation time from a timer on the strand. Frames are classified as
+// reference or not from the nal_ref_idc of their slices. Time comes from the timer, a steady one
+// unless another is passed in, e.g. to replay captures in virtual time. Must be used on the
+// channel strand.
+class VideoPresentationPacer: public std::enable_shared_from_this<VideoPresentationPacer>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<VideoPresentationPacer> Pointer;
+    typedef std::function<void(messenger::Timestamp::ValueType, const common::DataConstBuffer&)> FrameHandler;
+    // called with the timestamp of every dropped frame, e.g. to ack it to the phone
+    typedef std::function<void(messenger::Timestamp::ValueType)> DropHandler;
+
+    VideoPresentationPacer(boost::asio::io_service::strand& strand, FrameHandler frameHandler, DropHandler dropHandler = DropHandler(),
+                           std::chrono::microseconds latencyBudget = VideoJitterBuffer::cDefaultLatencyBudget);
+    VideoPresentationPacer(boost::asio::io_service::strand& strand, io::ITimer::Pointer timer, FrameHandler frameHandler,
+                           DropHandler dropHandler = DropHandler(), std::chrono::microseconds latencyBudget = VideoJitterBuffer::cDefaultLatencyBudget);
+
+    void push(messenger::Timestamp::ValueType timestamp, const common::DataConstBuffer& buffer);
+    // drops buffered frames and the timeline, e.g. on AVChannelStopIndication
+    void reset();
+    void setLatencyBudget(std::chrono::microseconds latencyBudget);
+    const VideoJitterBufferStatistics& getStatistics() const;
+
+    static bool isReferenceFrame(const H264NALUnits& units);
+
+private:
+    using std::enable_shared_from_this<VideoPresentationPacer>::shared_from_this;
+
+    void schedule();
+    void deliver();
+
+    boost::asio::io_service::strand& strand_;
+    io::ITimer::Pointer timer_;
+    FrameHandler frameHandler_;
+    DropHandler dropHandler_;
+    VideoJitterBuffer jitterBuffer_;
+    H264PayloadParser payloadParser_;
+    H264NALUnits units_;
+    bool scheduled_;
+    VideoJitterBuffer::Clock::time_point scheduledTime_;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,123 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <boost/asio.hpp>
+#include <aasdk_proto/PingResponseMessage.pb.h>
+#include <f1x/aasdk/Channel/Control/IControlServiceChannel.hpp>
+#include <f1x/aasdk/Messenger/Timestamp.hpp>
+#include <f1x/aasdk/Common/Histogram.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace control
+{
+
+struct LinkMonitorStatistics
+{
+    uint64_t sentPings = 0;
+    uint64_t receivedResponses = 0;
+    // responses that did not match any outstanding ping
+    uint64_t unmatchedResponses = 0;
+    // round trip times, microseconds
+    common::Histogram roundTripTime;
+    std::chrono::microseconds lastRoundTripTime = std::chrono::microseconds(0);
+    // phone clock minus local monotonic clock, valid once the phone answered with its own clock
+    bool clockOffsetValid = false;
+    std::chrono::microseconds clockOffset = std::chrono::microseconds(0);
+};
+
+// Pings the phone over the control channel every pingInterval with the local monotonic time
+// (microseconds) and measures the round trip when the response arrives. The event handler of the
+// control channel has to forward onPingResponse() here. When the response carries the phone clock
+// rather than an echo of the request, the clock offset is estimated NTP-style from the sample with
+// the lowest round trip among the last few, and used to map AV timestamps to local time.
+// No response for deadLinkTimeout reports the link as dead, well ahead of the USB send timeout.
+// All methods must be called on the strand.
+class LinkMonitor: public std::enable_shared_from_this<LinkMonitor>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<LinkMonitor> Pointer;
+    typedef std::chrono::steady_clock Clock;
+    typedef std::function<void()> DeadLinkHandler;
+    typedef std::function<void(std::chrono::microseconds)> RoundTripTimeHandler;
+
+    LinkMonitor(boost::asio::io_service::strand& strand, IControlServiceChannel::Pointer channel, DeadLinkHandler deadLinkHandler,
+                std::chrono::milliseconds pingInterval = cDefaultPingInterval,
+                std::chrono::milliseconds deadLinkTimeout = cDefaultDeadLinkTimeout);
+
+    void start();
+    void stop();
+    void onPingResponse(const proto::messages::PingResponse& response, Clock::time_point now = Clock::now());
+    // sends a ping now, normally driven by the ping timer
+    void ping(Clock::time_point now = Clock::now());
+
+    // maps a phone timestamp to local monotonic time, false until the clock offset is known
+    bool toLocalTime(messenger::Timestamp::ValueType timestamp, Clock::time_point& localTime) const;
+    const LinkMonitorStatistics& getStatistics() const;
+    // called with every measured round trip, e.g. transport::TransferSizeTuner::onControlFrameLatency
+    void setRoundTripTimeHandler(RoundTripTimeHandler roundTripTimeHandler);
+
+    static constexpr std::chrono::milliseconds cDefaultPingInterval = std::chrono::milliseconds(1000);
+    static constexpr std::chrono::milliseconds cDefaultDeadLinkTimeout = std::chrono::milliseconds(3000);
+
+private:
+    using std::enable_shared_from_this<LinkMonitor>::shared_from_this;
+
+    struct ClockSample
+    {
+        std::chrono::microseconds roundTripTime;
+        std::chrono::microseconds offset;
+    };
+
+    void schedulePing();
+    void armDeadline();
+    static int64_t toMicroseconds(Clock::time_point timePoint);
+
+    static constexpr size_t cMaxOutstandingPings = 16;
+    static constexpr size_t cClockSamples = 8;
+
+    boost::asio::io_service::strand& strand_;
+    boost::asio::steady_timer pingTimer_;
+    boost::asio::steady_timer deadlineTimer_;
+    IControlServiceChannel::Pointer channel_;
+    DeadLinkHandler deadLinkHandler_;
+    RoundTripTimeHandler roundTripTimeHandler_;
+    std::chrono::milliseconds pingInterval_;
+    std::chrono::milliseconds deadLinkTimeout_;
+    bool started_;
+    std::deque<int64_t> outstandingPings_;
+    std::array<ClockSample, cClockSamples> clockSamples_;
+    size_t clockSampleCount_;
+    LinkMonitorStatistics statistics_;
+};
+
+}
+}
+}
+}
@@ -0,0 +1,95 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/Channel/Input/IInputServiceChannel.hpp>
+#include <f1x/aasdk/Common/Histogram.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace input
+{
+
+struct InputEventPublisherStatistics
+{
+    uint64_t publishedEvents = 0;
+    // drag events folded into a newer one while a send was in flight
+    uint64_t mergedEvents = 0;
+    uint64_t sentIndications = 0;
+    // from publish() until the indication carrying the event was sent, microseconds
+    common::Histogram queueingLatency;
+};
+
+// Sends input event indications one at a time. While a send is in flight, a touch DRAG event
+// replaces a queued DRAG for the same pointers, so a burst of moves collapses into the newest
+// position. Press, release, pointer down/up and non-touch events are never merged and keep
+// their order. publish() may be called from any thread, everything else on the strand.
+class InputEventPublisher: public std::enable_shared_from_this<InputEventPublisher>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<InputEventPublisher> Pointer;
+    typedef std::chrono::steady_clock Clock;
+    typedef std::function<void(const error::Error&)> ErrorHandler;
+
+    InputEventPublisher(boost::asio::io_service::strand& strand, IInputServiceChannel::Pointer channel, ErrorHandler errorHandler);
+
+    void publish(proto::messages::InputEventIndication indication);
+    void stop();
+
+    const InputEventPublisherStatistics& getStatistics() const;
+
+    static bool isMergeable(const proto::messages::InputEventIndication& queued, const proto::messages::InputEventIndication& indication);
+
+private:
+    using std::enable_shared_from_this<InputEventPublisher>::shared_from_this;
+
+    struct PendingEvent
+    {
+        proto::messages::InputEventIndication indication;
+        // publish times of this event and of the events merged into it
+        std::vector<Clock::time_point> publishTimes;
+    };
+
+    void enqueue(proto::messages::InputEventIndication indication, Clock::time_point publishTime);
+    void sendNext();
+    void onSent(const std::vector<Clock::time_point>& publishTimes);
+
+    boost::asio::io_service::strand& strand_;
+    IInputServiceChannel::Pointer channel_;
+    ErrorHandler errorHandler_;
+    std::deque<PendingEvent> queue_;
+    bool sending_;
+    bool stopped_;
+    InputEventPublisherStatistics statistics_;
+};
+
+}
+}
+}
+}
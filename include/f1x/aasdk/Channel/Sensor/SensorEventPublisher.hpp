@@ -0,0 +1,94 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <set>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/Channel/Sensor/ISensorServiceChannel.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace sensor
+{
+
+struct SensorEventPublisherStatistics
+{
+    uint64_t publishedReadings = 0;
+    // readings overwritten by a newer one of the same type before the flush
+    uint64_t coalescedReadings = 0;
+    // flushed readings equal to the last value sent for their type
+    uint64_t suppressedReadings = 0;
+    uint64_t sentReadings = 0;
+    uint64_t sentIndications = 0;
+};
+
+// Coalesces sensor readings into one SensorEventIndication per flush interval. Only the newest
+// reading of every sensor type (field of SensorEventIndication) is kept, and a reading equal to
+// the last one sent for its type is not sent again. A zero interval flushes on every publish.
+// publish() may be called from any thread, everything else on the strand.
+class SensorEventPublisher: public std::enable_shared_from_this<SensorEventPublisher>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<SensorEventPublisher> Pointer;
+    typedef std::function<void(const error::Error&)> ErrorHandler;
+
+    SensorEventPublisher(boost::asio::io_service::strand& strand, ISensorServiceChannel::Pointer channel, ErrorHandler errorHandler,
+                         std::chrono::milliseconds flushInterval = cDefaultFlushInterval);
+
+    void publish(proto::messages::SensorEventIndication readings);
+    void flush();
+    // forgets the values sent so far, e.g. after the phone (re)starts a sensor, so they are sent again
+    void reset();
+    void stop();
+
+    const SensorEventPublisherStatistics& getStatistics() const;
+
+    static constexpr std::chrono::milliseconds cDefaultFlushInterval = std::chrono::milliseconds(100);
+
+private:
+    using std::enable_shared_from_this<SensorEventPublisher>::shared_from_this;
+
+    void store(const proto::messages::SensorEventIndication& readings);
+    void schedule();
+
+    boost::asio::io_service::strand& strand_;
+    boost::asio::steady_timer timer_;
+    ISensorServiceChannel::Pointer channel_;
+    ErrorHandler errorHandler_;
+    std::chrono::milliseconds flushInterval_;
+    // at most one reading per field
+    proto::messages::SensorEventIndication latest_;
+    proto::messages::SensorEventIndication sent_;
+    std::set<int> pendingFields_;
+    bool scheduled_;
+    bool stopped_;
+    SensorEventPublisherStatistics statistics_;
+};
+
+}
+}
+}
+}
@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <functional>
 #include <boost/asio.hpp>
 #include <f1x/aasdk/Messenger/IMessenger.hpp>
 #include <f1x/aasdk/Channel/Promise.hpp>
@@ -34,14 +35,19 @@ class ServiceChannel
 protected:
     ServiceChannel(boost::asio::io_service::strand& strand,
                    messenger::IMessenger::Pointer messenger,
-                   messenger::ChannelId channelId);
+                   messenger::ChannelId channelId,
+                   io::DispatchMode dispatchMode = io::DispatchMode::POST);
 
     virtual ~ServiceChannel() = default;
     void send(messenger::Message::Pointer message, SendPromise::Pointer promise);
+    // completionHandler runs when the messenger is done with the message, whether it was sent or not,
+    // just before promise is resolved or rejected
+    void send(messenger::Message::Pointer message, SendPromise::Pointer promise, std::function<void()> completionHandler);
 
     boost::asio::io_service::strand& strand_;
     messenger::IMessenger::Pointer messenger_;
     messenger::ChannelId channelId_;
+    io::DispatchMode dispatchMode_;
 };
 
 }
@@ -0,0 +1,69 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+// Counts samples into buckets delimited by ascending upper bounds; samples above the last bound
+// land in an overflow bucket. Units are up to the caller (the library records microseconds).
+class Histogram
+{
+public:
+    typedef uint64_t ValueType;
+    typedef std::vector<ValueType> Bounds;
+    typedef std::vector<uint64_t> Counts;
+
+    explicit Histogram(Bounds upperBounds = getDefaultLatencyBounds());
+
+    void record(ValueType value);
+    void reset();
+
+    const Bounds& getUpperBounds() const;
+    // one entry per upper bound plus the overflow bucket
+    const Counts& getCounts() const;
+    uint64_t getCount() const;
+    ValueType getMin() const;
+    ValueType getMax() const;
+    double getMean() const;
+    // upper bound of the bucket holding the given percentile (0-100), max value for the overflow bucket
+    ValueType getPercentile(double percentile) const;
+
+    // 250us .. 1024ms, doubling
+    static Bounds getDefaultLatencyBounds();
+
+private:
+    Bounds upperBounds_;
+    Counts counts_;
+    uint64_t count_;
+    ValueType min_;
+    ValueType max_;
+    double sum_;
+};
+
+}
+}
+}
@@ -0,0 +1,61 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <boost/core/noncopyable.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+// Accounts bytes held on behalf of one owner (e.g. a session) against a cap. Acquire and release
+// may be called from different threads; a limit of zero disables the cap but keeps the accounting.
+class MemoryBudget: boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<MemoryBudget> Pointer;
+
+    explicit MemoryBudget(size_t limit = 0);
+
+    // false leaves the usage untouched and counts a rejection
+    bool tryAcquire(size_t size);
+    void release(size_t size);
+
+    size_t getLimit() const;
+    size_t getUsage() const;
+    size_t getPeakUsage() const;
+    uint64_t getRejectionCount() const;
+
+private:
+    const size_t limit_;
+    std::atomic<size_t> usage_;
+    std::atomic<size_t> peakUsage_;
+    std::atomic<uint64_t> rejectionCount_;
+};
+
+}
+}
+}
@@ -0,0 +1,93 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/Channel/AV/IVideoServiceChannel.hpp>
+#include <f1x/aasdk/Channel/AV/IVideoServiceChannelEventHandler.hpp>
+#include <f1x/aasdk/Channel/AV/IAudioServiceChannel.hpp>
+#include <f1x/aasdk/Channel/AV/IAudioServiceChannelEventHandler.hpp>
+#include <f1x/aasdk/Common/Histogram.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace emulator
+{
+
+struct AVChannelResponderStatistics
+{
+    uint64_t receivedFrames = 0;
+    uint64_t receivedBytes = 0;
+    // frame timestamp until the frame reached the channel handler, microseconds;
+    // meaningful when the sender stamps frames with this process' monotonic clock
+    common::Histogram latency;
+};
+
+// Head unit end of a video or audio channel for load tests: accepts the channel open and setup
+// requests and acks every media frame as soon as it arrives, so the measured throughput is bound
+// by the transport and the protocol stack only. All handlers run on the channel strand.
+class AVChannelResponder: public channel::av::IVideoServiceChannelEventHandler,
+                          public channel::av::IAudioServiceChannelEventHandler,
+                          public std::enable_shared_from_this<AVChannelResponder>,
+                          boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<AVChannelResponder> Pointer;
+    typedef std::function<void(const error::Error&)> ErrorHandler;
+
+    AVChannelResponder(boost::asio::io_service::strand& strand, channel::av::IVideoServiceChannel::Pointer channel, uint32_t maxUnacked, ErrorHandler errorHandler);
+    AVChannelResponder(boost::asio::io_service::strand& strand, channel::av::IAudioServiceChannel::Pointer channel, uint32_t maxUnacked, ErrorHandler errorHandler);
+
+    void start();
+    const AVChannelResponderStatistics& getStatistics() const;
+
+    void onChannelOpenRequest(const proto::messages::ChannelOpenRequest& request) override;
+    void onAVChannelSetupRequest(const proto::messages::AVChannelSetupRequest& request) override;
+    void onAVChannelStartIndication(const proto::messages::AVChannelStartIndication& indication) override;
+    void onAVChannelStopIndication(const proto::messages::AVChannelStopIndication& indication) override;
+    void onAVMediaWithTimestampIndication(messenger::Timestamp::ValueType timestamp, const common::DataConstBuffer& buffer) override;
+    void onAVMediaIndication(const common::DataConstBuffer& buffer) override;
+    void onVideoFocusRequest(const proto::messages::VideoFocusRequest& request) override;
+    void onChannelError(const error::Error& e) override;
+
+private:
+    using std::enable_shared_from_this<AVChannelResponder>::shared_from_this;
+
+    template<typename Function>
+    void withChannel(Function function);
+    void receive();
+    void onMedia(size_t size);
+    channel::SendPromise::Pointer createSendPromise();
+
+    boost::asio::io_service::strand& strand_;
+    channel::av::IVideoServiceChannel::Pointer videoChannel_;
+    channel::av::IAudioServiceChannel::Pointer audioChannel_;
+    uint32_t maxUnacked_;
+    ErrorHandler errorHandler_;
+    int32_t session_;
+    AVChannelResponderStatistics statistics_;
+};
+
+}
+}
+}
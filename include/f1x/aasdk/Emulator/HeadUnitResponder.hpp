@@ -0,0 +1,91 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <map>
+#include <vector>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/Messenger/IMessenger.hpp>
+#include <f1x/aasdk/Messenger/ICryptor.hpp>
+#include <f1x/aasdk/Channel/Control/IControlServiceChannel.hpp>
+#include <f1x/aasdk/Channel/Control/IControlServiceChannelEventHandler.hpp>
+#include <f1x/aasdk/Emulator/AVChannelResponder.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace emulator
+{
+
+struct HeadUnitResponderConfiguration
+{
+    // VIDEO, MEDIA_AUDIO, SPEECH_AUDIO and SYSTEM_AUDIO are supported
+    std::vector<messenger::ChannelId> avChannels = {messenger::ChannelId::VIDEO, messenger::ChannelId::MEDIA_AUDIO};
+    uint32_t maxUnacked = 10;
+};
+
+// Minimal head unit built from the library's service channels: requests the version, runs the
+// client side of the TLS handshake, answers service discovery with the configured AV channels and
+// hands those to AVChannelResponder. Counterpart of PhoneEmulator for tests, benchmarks and the
+// emulator executable; a real head unit application replaces it when load testing.
+class HeadUnitResponder: public channel::control::IControlServiceChannelEventHandler,
+                         public std::enable_shared_from_this<HeadUnitResponder>,
+                         boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<HeadUnitResponder> Pointer;
+    typedef std::function<void(const error::Error&)> ErrorHandler;
+
+    HeadUnitResponder(boost::asio::io_service& ioService, messenger::IMessenger::Pointer messenger, messenger::ICryptor::Pointer cryptor,
+                      ErrorHandler errorHandler, HeadUnitResponderConfiguration configuration = HeadUnitResponderConfiguration());
+
+    void start();
+    // must not be called while the io_service runs handlers of this responder
+    std::map<messenger::ChannelId, AVChannelResponderStatistics> getStatistics() const;
+
+    void onVersionResponse(uint16_t majorCode, uint16_t minorCode, proto::enums::VersionResponseStatus::Enum status) override;
+    void onHandshake(const common::DataConstBuffer& payload) override;
+    void onServiceDiscoveryRequest(const proto::messages::ServiceDiscoveryRequest& request) override;
+    void onAudioFocusRequest(const proto::messages::AudioFocusRequest& request) override;
+    void onShutdownRequest(const proto::messages::ShutdownRequest& request) override;
+    void onShutdownResponse(const proto::messages::ShutdownResponse& response) override;
+    void onNavigationFocusRequest(const proto::messages::NavigationFocusRequest& request) override;
+    void onPingResponse(const proto::messages::PingResponse& response) override;
+    void onChannelError(const error::Error& e) override;
+
+private:
+    using std::enable_shared_from_this<HeadUnitResponder>::shared_from_this;
+
+    void sendHandshake();
+    AVChannelResponder::Pointer createAVChannelResponder(messenger::ChannelId channelId, proto::data::ChannelDescriptor& channelDescriptor);
+    channel::SendPromise::Pointer createSendPromise();
+
+    boost::asio::io_service::strand strand_;
+    messenger::IMessenger::Pointer messenger_;
+    messenger::ICryptor::Pointer cryptor_;
+    ErrorHandler errorHandler_;
+    HeadUnitResponderConfiguration configuration_;
+    channel::control::IControlServiceChannel::Pointer controlServiceChannel_;
+    std::map<messenger::ChannelId, AVChannelResponder::Pointer> avChannelResponders_;
+};
+
+}
+}
+}
@@ -0,0 +1,158 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/IO/Promise.hpp>
+#include <f1x/aasdk/IO/SimulationTimer.hpp>
+#include <f1x/aasdk/Messenger/IMessenger.hpp>
+#include <f1x/aasdk/Messenger/ICryptor.hpp>
+#include <f1x/aasdk/Common/Histogram.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace emulator
+{
+
+struct MediaStreamConfiguration
+{
+    messenger::ChannelId channelId;
+    // payload bits per second, frames are sent every frameSize * 8 / bitrate
+    size_t bitrate;
+    size_t frameSize;
+};
+
+struct PhoneEmulatorConfiguration
+{
+    std::string deviceName = "aasdk phone emulator";
+    std::string deviceBrand = "f1x";
+    // streams whose channel the head unit does not advertise are skipped, bitrate 0 sends as fast as max_unacked allows
+    std::vector<MediaStreamConfiguration> streams = {
+        {messenger::ChannelId::VIDEO, 8000000, 32768},
+        {messenger::ChannelId::MEDIA_AUDIO, 1536000, 2048}
+    };
+    std::chrono::milliseconds streamingDuration = std::chrono::milliseconds(10000);
+};
+
+struct MediaStreamReport
+{
+    messenger::ChannelId channelId = messenger::ChannelId::NONE;
+    uint32_t maxUnacked = 0;
+    uint64_t sentFrames = 0;
+    uint64_t sentBytes = 0;
+    uint64_t ackedFrames = 0;
+    uint64_t ackedBytes = 0;
+    // frames that were due while max_unacked frames were outstanding
+    uint64_t windowStalls = 0;
+    // frame enqueued to the messenger until its ack arrived, microseconds
+    common::Histogram ackLatency;
+    // acked payload bytes per second of streaming
+    double throughput = 0;
+};
+
+struct PhoneEmulatorReport
+{
+    // VERSION_REQUEST until AUTH_COMPLETE
+    std::chrono::microseconds handshakeDuration = std::chrono::microseconds(0);
+    // AUTH_COMPLETE until every stream got its START_INDICATION out
+    std::chrono::microseconds setupDuration = std::chrono::microseconds(0);
+    std::chrono::microseconds streamingDuration = std::chrono::microseconds(0);
+    std::vector<MediaStreamReport> streams;
+};
+
+// Phone side of the protocol, used to load a head unit end to end: answers the version request,
+// acts as the TLS server of the handshake (the cryptor has to be created with Cryptor::Role::SERVER),
+// sends the service discovery request, opens and sets up the configured AV channels and then streams
+// AV_MEDIA_WITH_TIMESTAMP_INDICATION frames at the configured bitrate, honouring max_unacked.
+// Frames carry the SimulationClock in microseconds, so a head unit in the same process can measure
+// one-way latency; under a VirtualTimeDriver the whole session runs in virtual time.
+// Works over any transport the messenger was built on.
+class PhoneEmulator: public std::enable_shared_from_this<PhoneEmulator>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<PhoneEmulator> Pointer;
+    typedef io::Promise<PhoneEmulatorReport> Promise;
+    typedef io::SimulationClock Clock;
+
+    PhoneEmulator(boost::asio::io_service& ioService, messenger::IMessenger::Pointer messenger, messenger::ICryptor::Pointer cryptor,
+                  PhoneEmulatorConfiguration configuration = PhoneEmulatorConfiguration());
+
+    // resolved with the report once streamingDuration elapsed, rejected on the first protocol or transport error
+    void start(Promise::Pointer promise);
+    void stop();
+
+private:
+    using std::enable_shared_from_this<PhoneEmulator>::shared_from_this;
+
+    struct Stream
+    {
+        Stream(boost::asio::io_service& ioService, const MediaStreamConfiguration& configuration);
+
+        MediaStreamConfiguration configuration;
+        Clock::duration frameInterval;
+        io::SimulationTimer frameTimer;
+        Clock::time_point nextFrameTime;
+        bool started;
+        bool stalled;
+        std::deque<Clock::time_point> unackedFrames;
+        MediaStreamReport report;
+    };
+
+    typedef std::list<Stream> Streams;
+
+    void receive(messenger::ChannelId channelId);
+    void messageHandler(messenger::Message::Pointer message);
+    void handleControlMessage(uint16_t messageId, const common::DataConstBuffer& payload);
+    void handleStreamMessage(Stream& stream, uint16_t messageId, const common::DataConstBuffer& payload);
+    void handleHandshake(const common::DataConstBuffer& payload);
+    void handleServiceDiscoveryResponse(const common::DataConstBuffer& payload);
+    void handleAVChannelSetupResponse(Stream& stream, const common::DataConstBuffer& payload);
+    void handleAVMediaAckIndication(Stream& stream, const common::DataConstBuffer& payload);
+    void startStreaming();
+    void scheduleFrame(Stream& stream);
+    void sendFrame(Stream& stream, Clock::time_point now);
+    void finish();
+    void fail(const error::Error& e);
+    void send(messenger::Message::Pointer message);
+    Streams::iterator findStream(messenger::ChannelId channelId);
+
+    boost::asio::io_service::strand strand_;
+    io::SimulationTimer streamingTimer_;
+    messenger::IMessenger::Pointer messenger_;
+    messenger::ICryptor::Pointer cryptor_;
+    PhoneEmulatorConfiguration configuration_;
+    Promise::Pointer promise_;
+    Streams streams_;
+    common::Data framePayload_;
+    Clock::time_point versionRequestTime_;
+    Clock::time_point authCompleteTime_;
+    Clock::time_point streamingStartTime_;
+    PhoneEmulatorReport report_;
+};
+
+}
+}
+}
@@ -62,6 +62,10 @@ enum class ErrorCode
     OPERATION_ABORTED = 30,
     OPERATION_IN_PROGRESS = 31,
     PARSE_PAYLOAD = 32,
+    REQUEST_REJECTED = 33,
+    SSL_CIPHER_LIST = 34,
+    MEMORY_BUDGET_EXCEEDED = 35,
+    DATA_SINK_FULL = 36,
 };
 
 }
@@ -0,0 +1,166 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#ifdef AASDK_COROUTINES
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <utility>
+#include <boost/asio.hpp>
+#include <f1x/aasdk/Error/Error.hpp>
+#include <f1x/aasdk/IO/Promise.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Fire-and-forget coroutine. The frame is allocated once when the coroutine is called
+// and released when it runs to completion, so the body is expected to report its
+// outcome through a Promise it owns and to catch error::Error thrown by co_await.
+class Task
+{
+public:
+    struct promise_type
+    {
+        Task get_return_object() { return Task(); }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+template<typename ResolveArgumentType, typename InitiatorType>
+class PromiseAwaitable
+{
+public:
+    typedef Promise<ResolveArgumentType> PromiseType;
+
+    PromiseAwaitable(boost::asio::io_service::strand& strand, InitiatorType initiator)
+        : strand_(strand)
+        , initiator_(std::move(initiator))
+    {
+
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        auto promise = PromiseType::defer(strand_);
+        promise->then([this, handle](ResolveArgumentType argument) mutable {
+                value_.emplace(std::move(argument));
+                handle.resume();
+            },
+            [this, handle](const error::Error& e) mutable {
+                error_.emplace(e);
+                handle.resume();
+            });
+
+        // the promise may complete on another thread or in place, resume the coroutine and destroy
+        // this awaitable before the initiator returns, so the initiator runs from a local
+        auto initiator = std::move(initiator_);
+        initiator(std::move(promise));
+    }
+
+    ResolveArgumentType await_resume()
+    {
+        if(error_)
+        {
+            throw *error_;
+        }
+
+        return std::move(*value_);
+    }
+
+private:
+    boost::asio::io_service::strand& strand_;
+    InitiatorType initiator_;
+    std::optional<ResolveArgumentType> value_;
+    std::optional<error::Error> error_;
+};
+
+template<typename InitiatorType>
+class PromiseAwaitable<void, InitiatorType>
+{
+public:
+    typedef Promise<void> PromiseType;
+
+    PromiseAwaitable(boost::asio::io_service::strand& strand, InitiatorType initiator)
+        : strand_(strand)
+        , initiator_(std::move(initiator))
+    {
+
+    }
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle)
+    {
+        auto promise = PromiseType::defer(strand_);
+        promise->then([handle]() mutable {
+                handle.resume();
+            },
+            [this, handle](const error::Error& e) mutable {
+                error_.emplace(e);
+                handle.resume();
+            });
+
+        // the promise may complete on another thread or in place, resume the coroutine and destroy
+        // this awaitable before the initiator returns, so the initiator runs from a local
+        auto initiator = std::move(initiator_);
+        initiator(std::move(promise));
+    }
+
+    void await_resume()
+    {
+        if(error_)
+        {
+            throw *error_;
+        }
+    }
+
+private:
+    boost::asio::io_service::strand& strand_;
+    InitiatorType initiator_;
+    std::optional<error::Error> error_;
+};
+
+template<typename ResolveArgumentType, typename InitiatorType>
+PromiseAwaitable<ResolveArgumentType, InitiatorType> makePromiseAwaitable(boost::asio::io_service::strand& strand, InitiatorType initiator)
+{
+    return PromiseAwaitable<ResolveArgumentType, InitiatorType>(strand, std::move(initiator));
+}
+
+}
+}
+}
+
+#endif
@@ -28,12 +28,20 @@ namespace aasdk
 namespace io
 {
 
+enum class DispatchMode
+{
+    // handlers are always queued on the execution context
+    POST,
+    // handlers run in place when the caller already executes on the strand
+    INLINE
+};
+
 class IOContextWrapper
 {
 public:
     IOContextWrapper();
     explicit IOContextWrapper(boost::asio::io_service& ioService);
-    explicit IOContextWrapper(boost::asio::io_service::strand& strand);
+    explicit IOContextWrapper(boost::asio::io_service::strand& strand, DispatchMode dispatchMode = DispatchMode::POST);
 
     template<typename CompletionHandlerType>
     void post(CompletionHandlerType&& handler)
@@ -61,12 +69,30 @@ public:
         }
     }
 
+    template<typename CompletionHandlerType>
+    static void runInline(CompletionHandlerType&& handler)
+    {
+        InlineScope scope;
+        handler();
+    }
+
     void reset();
     bool isActive() const;
+    bool canRunInline() const;
 
 private:
+    class InlineScope
+    {
+    public:
+        InlineScope();
+        ~InlineScope();
+    };
+
     boost::asio::io_service* ioService_;
     boost::asio::io_service::strand* strand_;
+    DispatchMode dispatchMode_;
+
+    static constexpr size_t cMaxInlineDepth = 32;
 };
 
 }
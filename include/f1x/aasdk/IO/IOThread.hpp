@@ -0,0 +1,85 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <time.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <boost/asio.hpp>
+#include <boost/core/noncopyable.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+struct IOThreadConfiguration
+{
+    std::string name;
+    // core the thread is pinned to, negative value leaves the placement to the scheduler
+    int cpuCore = -1;
+    // SCHED_FIFO priority (1-99), zero keeps the default time-sharing policy
+    int realtimePriority = 0;
+};
+
+class IOThread: boost::noncopyable
+{
+public:
+    typedef std::function<void()> Routine;
+
+    IOThread(IOThreadConfiguration configuration);
+    ~IOThread();
+
+    // runs the thread's io_service until stop()
+    void start();
+    // calls the routine repeatedly until stop(), the routine is expected to block for a bounded time.
+    // Starting a stopped thread joins the previous one first; neither may be called from the thread itself.
+    void start(Routine routine);
+    void stop();
+    void join();
+
+    boost::asio::io_service& getIOService();
+    const IOThreadConfiguration& getConfiguration() const;
+    std::chrono::nanoseconds getCPUTime() const;
+
+private:
+    void run(Routine routine);
+    void applyConfiguration();
+    std::chrono::nanoseconds sampleCPUTime() const;
+
+    IOThreadConfiguration configuration_;
+    boost::asio::io_service ioService_;
+    std::unique_ptr<boost::asio::io_service::work> work_;
+    std::thread thread_;
+    std::atomic<bool> running_;
+    // published by the thread itself, other threads never touch its pthread_t
+    std::atomic<bool> cpuClockAvailable_;
+    std::atomic<clockid_t> cpuClockId_;
+    std::atomic<int64_t> finalCPUTime_;
+};
+
+}
+}
+}
@@ -0,0 +1,54 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <boost/system/error_code.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Deadline timer together with the clock it runs on, for components whose timing tests have to
+// substitute virtual time. Behaves like boost::asio::steady_timer: setting the expiry cancels the
+// pending waits and cancelled handlers receive operation_aborted.
+class ITimer
+{
+public:
+    ITimer() = default;
+    virtual ~ITimer() = default;
+
+    typedef std::shared_ptr<ITimer> Pointer;
+    typedef std::chrono::steady_clock Clock;
+    typedef std::function<void(const boost::system::error_code&)> WaitHandler;
+
+    virtual Clock::time_point now() const = 0;
+    virtual void expiresAt(Clock::time_point expiry) = 0;
+    virtual void asyncWait(WaitHandler handler) = 0;
+    virtual void cancel() = 0;
+};
+
+}
+}
+}
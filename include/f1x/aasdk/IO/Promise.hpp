@@ -51,14 +51,19 @@ public:
         return std::make_shared<Promise>(strand);
     }
 
+    static Pointer defer(boost::asio::io_service::strand& strand, DispatchMode dispatchMode)
+    {
+        return std::make_shared<Promise>(strand, dispatchMode);
+    }
+
     Promise(boost::asio::io_service& ioService)
         : ioContextWrapper_(ioService)
     {
 
     }
 
-    Promise(boost::asio::io_service::strand& strand)
-        : ioContextWrapper_(strand)
+    Promise(boost::asio::io_service::strand& strand, DispatchMode dispatchMode = DispatchMode::POST)
+        : ioContextWrapper_(strand, dispatchMode)
     {
 
     }
@@ -73,10 +78,21 @@ public:
 
     void resolve(ResolveArgumentType argument)
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
 
         if(resolveHandler_ != nullptr && this->isPending())
         {
+            if(ioContextWrapper_.canRunInline())
+            {
+                auto resolveHandler = std::move(resolveHandler_);
+                ioContextWrapper_.reset();
+                rejectHandler_ = RejectHandler();
+                lock.unlock();
+
+                IOContextWrapper::runInline([&]() { resolveHandler(std::move(argument)); });
+                return;
+            }
+
             ioContextWrapper_.post([argument = std::move(argument), resolveHandler = std::move(resolveHandler_)]() mutable {
                 resolveHandler(std::move(argument));
             });
@@ -88,10 +104,21 @@ public:
 
     void reject(ErrorArgumentType error)
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
 
         if(rejectHandler_ != nullptr && this->isPending())
         {
+            if(ioContextWrapper_.canRunInline())
+            {
+                auto rejectHandler = std::move(rejectHandler_);
+                ioContextWrapper_.reset();
+                resolveHandler_ = ResolveHandler();
+                lock.unlock();
+
+                IOContextWrapper::runInline([&]() { rejectHandler(std::move(error)); });
+                return;
+            }
+
             ioContextWrapper_.post([error = std::move(error), rejectHandler = std::move(rejectHandler_)]() mutable {
                 rejectHandler(std::move(error));
             });
@@ -132,14 +159,19 @@ public:
         return std::make_shared<Promise>(strand);
     }
 
+    static Pointer defer(boost::asio::io_service::strand& strand, DispatchMode dispatchMode)
+    {
+        return std::make_shared<Promise>(strand, dispatchMode);
+    }
+
     Promise(boost::asio::io_service& ioService)
         : ioContextWrapper_(ioService)
     {
 
     }
 
-    Promise(boost::asio::io_service::strand& strand)
-        : ioContextWrapper_(strand)
+    Promise(boost::asio::io_service::strand& strand, DispatchMode dispatchMode = DispatchMode::POST)
+        : ioContextWrapper_(strand, dispatchMode)
     {
 
     }
@@ -154,10 +186,21 @@ public:
 
     void resolve()
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
 
         if(resolveHandler_ != nullptr && this->isPending())
         {
+            if(ioContextWrapper_.canRunInline())
+            {
+                auto resolveHandler = std::move(resolveHandler_);
+                ioContextWrapper_.reset();
+                rejectHandler_ = RejectHandler();
+                lock.unlock();
+
+                IOContextWrapper::runInline([&]() { resolveHandler(); });
+                return;
+            }
+
             ioContextWrapper_.post([resolveHandler = std::move(resolveHandler_)]() mutable {
                 resolveHandler();
             });
@@ -169,10 +212,21 @@ public:
 
     void reject(ErrorArgumentType error)
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
 
         if(rejectHandler_ != nullptr && this->isPending())
         {
+            if(ioContextWrapper_.canRunInline())
+            {
+                auto rejectHandler = std::move(rejectHandler_);
+                ioContextWrapper_.reset();
+                resolveHandler_ = ResolveHandler();
+                lock.unlock();
+
+                IOContextWrapper::runInline([&]() { rejectHandler(std::move(error)); });
+                return;
+            }
+
             ioContextWrapper_.post([error = std::move(error), rejectHandler = std::move(rejectHandler_)]() mutable {
                 rejectHandler(std::move(error));
             });
@@ -212,14 +266,19 @@ public:
         return std::make_shared<Promise>(strand);
     }
 
+    static Pointer defer(boost::asio::io_service::strand& strand, DispatchMode dispatchMode)
+    {
+        return std::make_shared<Promise>(strand, dispatchMode);
+    }
+
     Promise(boost::asio::io_service& ioService)
         : ioContextWrapper_(ioService)
     {
 
     }
 
-    Promise(boost::asio::io_service::strand& strand)
-        : ioContextWrapper_(strand)
+    Promise(boost::asio::io_service::strand& strand, DispatchMode dispatchMode = DispatchMode::POST)
+        : ioContextWrapper_(strand, dispatchMode)
     {
 
     }
@@ -234,10 +293,21 @@ public:
 
     void resolve()
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
 
         if(resolveHandler_ != nullptr && this->isPending())
         {
+            if(ioContextWrapper_.canRunInline())
+            {
+                auto resolveHandler = std::move(resolveHandler_);
+                ioContextWrapper_.reset();
+                rejectHandler_ = RejectHandler();
+                lock.unlock();
+
+                IOContextWrapper::runInline([&]() { resolveHandler(); });
+                return;
+            }
+
             ioContextWrapper_.post([resolveHandler = std::move(resolveHandler_)]() mutable {
                 resolveHandler();
             });
@@ -249,10 +319,21 @@ public:
 
     void reject()
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
 
         if(rejectHandler_ != nullptr && this->isPending())
         {
+            if(ioContextWrapper_.canRunInline())
+            {
+                auto rejectHandler = std::move(rejectHandler_);
+                ioContextWrapper_.reset();
+                resolveHandler_ = ResolveHandler();
+                lock.unlock();
+
+                IOContextWrapper::runInline([&]() { rejectHandler(); });
+                return;
+            }
+
             ioContextWrapper_.post([rejectHandler = std::move(rejectHandler_)]() mutable {
                 rejectHandler();
             });
@@ -293,14 +374,19 @@ public:
         return std::make_shared<Promise>(strand);
     }
 
+    static Pointer defer(boost::asio::io_service::strand& strand, DispatchMode dispatchMode)
+    {
+        return std::make_shared<Promise>(strand, dispatchMode);
+    }
+
     Promise(boost::asio::io_service& ioService)
         : ioContextWrapper_(ioService)
     {
 
     }
 
-    Promise(boost::asio::io_service::strand& strand)
-        : ioContextWrapper_(strand)
+    Promise(boost::asio::io_service::strand& strand, DispatchMode dispatchMode = DispatchMode::POST)
+        : ioContextWrapper_(strand, dispatchMode)
     {
 
     }
@@ -315,10 +401,21 @@ public:
 
     void resolve(ResolveArgumentType argument)
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
 
         if(resolveHandler_ != nullptr && this->isPending())
         {
+            if(ioContextWrapper_.canRunInline())
+            {
+                auto resolveHandler = std::move(resolveHandler_);
+                ioContextWrapper_.reset();
+                rejectHandler_ = RejectHandler();
+                lock.unlock();
+
+                IOContextWrapper::runInline([&]() { resolveHandler(std::move(argument)); });
+                return;
+            }
+
             ioContextWrapper_.post([argument = std::move(argument), resolveHandler = std::move(resolveHandler_)]() mutable {
                 resolveHandler(std::move(argument));
             });
@@ -330,10 +427,21 @@ public:
 
     void reject()
     {
-        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        std::unique_lock<decltype(mutex_)> lock(mutex_);
 
         if(rejectHandler_ != nullptr && this->isPending())
         {
+            if(ioContextWrapper_.canRunInline())
+            {
+                auto rejectHandler = std::move(rejectHandler_);
+                ioContextWrapper_.reset();
+                resolveHandler_ = ResolveHandler();
+                lock.unlock();
+
+                IOContextWrapper::runInline([&]() { rejectHandler(); });
+                return;
+            }
+
             ioContextWrapper_.post([rejectHandler = std::move(rejectHandler_)]() mutable {
                 rejectHandler();
             });
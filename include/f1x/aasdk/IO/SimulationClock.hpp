@@ -0,0 +1,61 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Clock of the simulated components (simulated USB link, phone emulator) and of timing tests. It follows
+// std::chrono::steady_clock until a VirtualTimeDriver switches it to virtual time; from then on it
+// only moves when the driver advances it. The clock is process-wide, one driver at a time, and
+// timers armed in virtual time should not outlive the driver since the clock returns to real time afterwards.
+class SimulationClock
+{
+public:
+    typedef std::chrono::steady_clock::duration duration;
+    typedef duration::rep rep;
+    typedef duration::period period;
+    typedef std::chrono::time_point<SimulationClock, duration> time_point;
+    // virtual time may run ahead of real time, so the clock can step back when the driver is gone
+    static constexpr bool is_steady = false;
+
+    static time_point now();
+    static bool isVirtual();
+
+private:
+    friend class VirtualTimeDriver;
+
+    static void startVirtualTime();
+    static void stopVirtualTime();
+    static void setVirtualTime(time_point timePoint);
+
+    static std::atomic<bool> virtual_;
+    static std::atomic<rep> virtualNow_;
+};
+
+}
+}
+}
@@ -0,0 +1,77 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/IO/SimulationClock.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Timer on the SimulationClock. In real time it is a plain steady_timer; waits started while a
+// VirtualTimeDriver is active are queued in the driver instead and completed when it advances the
+// virtual clock past their expiry, so no wall clock wait is involved. Handlers are always posted to
+// the io_service and receive operation_aborted when the wait is cancelled, as with asio timers.
+class SimulationTimer: boost::noncopyable
+{
+public:
+    typedef SimulationClock::time_point TimePoint;
+    typedef SimulationClock::duration Duration;
+    typedef std::function<void(const boost::system::error_code&)> WaitHandler;
+
+    explicit SimulationTimer(boost::asio::io_service& ioService);
+    SimulationTimer(boost::asio::io_service& ioService, TimePoint expiry);
+    SimulationTimer(boost::asio::io_service& ioService, Duration expiry);
+    ~SimulationTimer();
+
+    // both cancel the pending waits
+    void expiresAt(TimePoint expiry);
+    void expiresAfter(Duration expiry);
+    TimePoint getExpiry() const;
+
+    void asyncWait(WaitHandler handler);
+    void cancel();
+
+private:
+    struct VirtualWait
+    {
+        WaitHandler handler;
+        bool completed;
+    };
+
+    // owned by the driver, so waits never expired do not keep their handlers alive past it
+    typedef std::list<std::weak_ptr<VirtualWait>> VirtualWaits;
+
+    boost::asio::io_service& ioService_;
+    boost::asio::steady_timer timer_;
+    TimePoint expiry_;
+    VirtualWaits virtualWaits_;
+};
+
+}
+}
+}
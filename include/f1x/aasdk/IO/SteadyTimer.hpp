@@ -0,0 +1,48 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/IO/ITimer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+class SteadyTimer: public ITimer, boost::noncopyable
+{
+public:
+    explicit SteadyTimer(boost::asio::io_service& ioService);
+
+    Clock::time_point now() const override;
+    void expiresAt(Clock::time_point expiry) override;
+    void asyncWait(WaitHandler handler) override;
+    void cancel() override;
+
+private:
+    boost::asio::steady_timer timer_;
+};
+
+}
+}
+}
@@ -0,0 +1,81 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/IO/SimulationClock.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// Runs an io_service in virtual time for deterministic latency tests. While the driver exists the
+// SimulationClock is virtual and SimulationTimer waits are queued here: ready handlers are polled
+// one at a time on the calling thread and once nothing is ready the clock jumps straight to the
+// earliest pending expiry. Handlers therefore run at their exact virtual deadlines and in the same
+// order on every run, however fast the host is. Only components timed by SimulationClock/SimulationTimer
+// take part, and the io_service must not be run from other threads meanwhile.
+class VirtualTimeDriver: boost::noncopyable
+{
+public:
+    typedef SimulationClock::duration Duration;
+    typedef SimulationClock::time_point TimePoint;
+    typedef std::function<bool()> Condition;
+
+    explicit VirtualTimeDriver(boost::asio::io_service& ioService);
+    ~VirtualTimeDriver();
+
+    TimePoint now() const;
+    // virtual time since the driver was created
+    Duration getElapsed() const;
+    size_t getHandlerCount() const;
+
+    void runFor(Duration duration);
+    void runUntil(TimePoint timePoint);
+    // runs until the condition holds, checked after every handler; false if it did not within the limit
+    bool runUntil(Condition condition, Duration limit);
+
+    // used by SimulationTimer, the expire routine is called once virtual time reaches the deadline
+    void schedule(TimePoint deadline, std::function<void()> expire);
+    static VirtualTimeDriver* getActive();
+
+private:
+    typedef std::multimap<TimePoint, std::function<void()>> Deadlines;
+
+    bool step();
+    bool advance(TimePoint limit);
+
+    boost::asio::io_service& ioService_;
+    TimePoint startTime_;
+    size_t handlerCount_;
+    Deadlines deadlines_;
+
+    static VirtualTimeDriver* active_;
+};
+
+}
+}
+}
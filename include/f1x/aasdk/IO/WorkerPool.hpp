@@ -0,0 +1,65 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <boost/asio.hpp>
+#include <boost/core/noncopyable.hpp>
+#include <f1x/aasdk/IO/IOThread.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+// A fixed set of IOThreads running one shared io_service. Asio keeps a single ready queue per io_service,
+// so any idle worker picks up the next ready handler regardless of which session posted it; work
+// submitted through strands stays serialized per strand while the strands themselves spread over the workers.
+class WorkerPool: boost::noncopyable
+{
+public:
+    typedef std::vector<IOThreadConfiguration> Configuration;
+
+    WorkerPool(Configuration configuration);
+    ~WorkerPool();
+
+    void start();
+    void stop();
+
+    boost::asio::io_service& getIOService();
+    size_t getSize() const;
+    const IOThread& getWorker(size_t index) const;
+    // sum over the workers
+    std::chrono::nanoseconds getCPUTime() const;
+
+    // size workers named "<name>-<index>"; a non-negative first core pins worker i to core firstCore + i
+    static Configuration createConfiguration(size_t size, const std::string& name, int firstCore = -1);
+
+private:
+    boost::asio::io_service ioService_;
+    std::unique_ptr<boost::asio::io_service::work> work_;
+    std::vector<std::unique_ptr<IOThread>> workers_;
+};
+
+}
+}
+}
@@ -37,10 +37,13 @@ public:
     Message::Pointer pop(ChannelId channelId);
     bool empty(ChannelId channelId) const;
     void clear();
+    // total payload size of the queued messages
+    size_t getPayloadSize() const;
 
 private:
     typedef std::queue<Message::Pointer> MessageQueue;
     std::unordered_map<ChannelId, MessageQueue> queue_;
+    size_t payloadSize_ = 0;
 };
 
 }
@@ -0,0 +1,81 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+#include <f1x/aasdk/Transport/ISSLWrapper.hpp>
+#include <f1x/aasdk/Messenger/Cryptor.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+struct CipherSuiteCandidate
+{
+    std::string name;
+    // the TLS 1.3 suite and TLS 1.2 cipher using the same AEAD, so either protocol version negotiates it
+    Cryptor::CipherPreference ciphers;
+};
+
+struct CipherSuiteScore
+{
+    CipherSuiteCandidate candidate;
+    // cipher the measured session actually negotiated
+    std::string cipherName;
+    // payload bytes per second sealed by one end and opened by the other
+    double throughput = 0;
+};
+
+// Startup self-benchmark for the cipher preference: every candidate gets a real handshake between
+// a client and a server Cryptor over memory BIOs and is then timed on full size records, so the
+// ranking reflects the AEAD implementations available on this CPU (e.g. ChaCha20-Poly1305 beating
+// AES-GCM on cores without AES instructions). Runs synchronously, roughly candidates * duration.
+class CipherSuiteBenchmark
+{
+public:
+    typedef std::vector<CipherSuiteCandidate> Candidates;
+    typedef std::vector<CipherSuiteScore> Scores;
+
+    CipherSuiteBenchmark(transport::ISSLWrapper::Pointer sslWrapper, Candidates candidates = getDefaultCandidates(),
+                         std::chrono::milliseconds duration = std::chrono::milliseconds(20), size_t recordSize = 16384);
+
+    // fastest first, candidates this OpenSSL build cannot negotiate are left out
+    Scores run();
+
+    // concatenated ciphers of the given scores, ready for Cryptor::setCipherPreference
+    static Cryptor::CipherPreference getCipherPreference(const Scores& scores);
+    static Candidates getDefaultCandidates();
+
+private:
+    bool measure(const CipherSuiteCandidate& candidate, CipherSuiteScore& score);
+
+    transport::ISSLWrapper::Pointer sslWrapper_;
+    Candidates candidates_;
+    std::chrono::milliseconds duration_;
+    size_t recordSize_;
+};
+
+}
+}
+}
@@ -19,6 +19,8 @@
 #pragma once
 
 #include <mutex>
+#include <string>
+#include <vector>
 #include <f1x/aasdk/Transport/ISSLWrapper.hpp>
 #include <f1x/aasdk/Messenger/ICryptor.hpp>
 
@@ -32,7 +34,25 @@ namespace messenger
 class Cryptor: public ICryptor
 {
 public:
-    Cryptor(transport::ISSLWrapper::Pointer sslWrapper);
+    // the head unit is the TLS client, the server role plays the phone side of the handshake
+    enum class Role
+    {
+        CLIENT,
+        SERVER
+    };
+
+    // OpenSSL cipher names, most preferred first. TLS 1.3 suites (TLS_*) and TLS 1.2 ciphers can be mixed,
+    // each protocol version is restricted to the entries naming it; a version without entries keeps the OpenSSL defaults.
+    // Any unknown name fails init() with SSL_CIPHER_LIST.
+    typedef std::vector<std::string> CipherPreference;
+
+    Cryptor(transport::ISSLWrapper::Pointer sslWrapper, Role role = Role::CLIENT);
+
+    // takes effect with the next init()
+    void setCipherPreference(CipherPreference cipherPreference);
+    CipherPreference getCipherPreference() const;
+    // negotiated cipher, empty until the handshake completed
+    std::string getCipherName() const;
 
     void init() override;
     void deinit() override;
@@ -47,8 +67,11 @@ public:
 private:
     size_t read(common::Data& output);
     void write(const common::DataConstBuffer& buffer);
+    void applyCipherPreference();
 
     transport::ISSLWrapper::Pointer sslWrapper_;
+    Role role_;
+    CipherPreference cipherPreference_;
     size_t maxBufferSize_;
     X509* certificate_;
     EVP_PKEY* privateKey_;
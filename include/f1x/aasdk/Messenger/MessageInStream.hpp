@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
 #include <f1x/aasdk/Transport/ITransport.hpp>
 #include <f1x/aasdk/Messenger/IMessageInStream.hpp>
 #include <f1x/aasdk/Messenger/ICryptor.hpp>
@@ -35,8 +36,14 @@ class MessageInStream: public IMessageInStream, public std::enable_shared_from_t
 {
 public:
     MessageInStream(boost::asio::io_service& ioService, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor);
+    MessageInStream(boost::asio::io_service::strand& strand, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor);
+
+    ~MessageInStream() override;
 
     void startReceive(ReceivePromise::Pointer promise) override;
+    // payloads of messages being reassembled are charged to the budget, a frame that does not fit
+    // rejects the receive with MEMORY_BUDGET_EXCEEDED. Must be set before the stream is used.
+    void setMemoryBudget(common::MemoryBudget::Pointer memoryBudget);
 
 private:
     using std::enable_shared_from_this<MessageInStream>::shared_from_this;
@@ -44,6 +51,8 @@ private:
     void receiveFrameHeaderHandler(const common::DataConstBuffer& buffer);
     void receiveFrameSizeHandler(const common::DataConstBuffer& buffer);
     void receiveFramePayloadHandler(const common::DataConstBuffer& buffer);
+    // brings the charge in line with the partial messages held, false when growing it does not fit
+    bool updateReassemblyCharge();
 
     boost::asio::io_service::strand strand_;
     transport::ITransport::Pointer transport_;
@@ -53,6 +62,9 @@ private:
     Message::Pointer message_;
 
     std::map<messenger::ChannelId, Message::Pointer> channel_assembly_buffers;
+    io::DispatchMode dispatchMode_;
+    common::MemoryBudget::Pointer memoryBudget_;
+    size_t reassemblyCharge_;
 };
 
 }
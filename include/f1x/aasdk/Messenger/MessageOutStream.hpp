@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <f1x/aasdk/Common/Data.hpp>
 #include <f1x/aasdk/Transport/ITransport.hpp>
 #include <f1x/aasdk/Messenger/ICryptor.hpp>
@@ -36,9 +37,18 @@ class MessageOutStream: public IMessageOutStream, public std::enable_shared_from
 {
 public:
     MessageOutStream(boost::asio::io_service& ioService, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor);
+    MessageOutStream(boost::asio::io_service::strand& strand, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor);
 
     void stream(Message::Pointer message, SendPromise::Pointer promise) override;
 
+    // clamped to the 16-bit frame size field; encrypted frames never exceed one TLS record
+    void setMaxFramePayloadSize(size_t size);
+    size_t getMaxFramePayloadSize() const;
+
+    static constexpr size_t cDefaultMaxFramePayloadSize = 0x4000;
+    static constexpr size_t cMaxPlainFramePayloadSize = 0xFFFF;
+    static constexpr size_t cMaxEncryptedFramePayloadSize = 0x4000;
+
 private:
     using std::enable_shared_from_this<MessageOutStream>::shared_from_this;
 
@@ -48,6 +58,7 @@ private:
     void streamPlainFrame(FrameType frameType, const common::DataConstBuffer& payloadBuffer);
     void setFrameSize(common::Data& data, FrameType frameType, size_t payloadSize, size_t totalSize);
     void reset();
+    size_t getFramePayloadSizeLimit() const;
 
     boost::asio::io_service::strand strand_;
     transport::ITransport::Pointer transport_;
@@ -56,8 +67,8 @@ private:
     size_t offset_;
     size_t remainingSize_;
     SendPromise::Pointer promise_;
-
-        static constexpr size_t cMaxFramePayloadSize = 0x4000;
+    io::DispatchMode dispatchMode_;
+    std::atomic<size_t> maxFramePayloadSize_;
 };
 
 }
@@ -20,6 +20,7 @@
 
 #include <boost/asio.hpp>
 #include <list>
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
 #include <f1x/aasdk/Messenger/IMessenger.hpp>
 #include <f1x/aasdk/Messenger/IMessageInStream.hpp>
 #include <f1x/aasdk/Messenger/IMessageOutStream.hpp>
@@ -37,19 +38,31 @@ class Messenger: public IMessenger, public std::enable_shared_from_this<Messenge
 {
 public:
     Messenger(boost::asio::io_service& ioService, IMessageInStream::Pointer messageInStream, IMessageOutStream::Pointer messageOutStream);
+    Messenger(boost::asio::io_service::strand& strand, IMessageInStream::Pointer messageInStream, IMessageOutStream::Pointer messageOutStream);
+    Messenger(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand,
+              IMessageInStream::Pointer messageInStream, IMessageOutStream::Pointer messageOutStream);
     void enqueueReceive(ChannelId channelId, ReceivePromise::Pointer promise) override;
     void enqueueSend(Message::Pointer message, SendPromise::Pointer promise) override;
     void stop() override;
 
+    // payloads queued for sending or waiting for a receiver are charged to the budget, a send over
+    // the budget is rejected. An incoming message over the budget, here or in the message in stream,
+    // leaves the stream out of sync and is fatal: pending and later receives on all channels are
+    // rejected with MEMORY_BUDGET_EXCEEDED and the session has to be torn down.
+    // Must be set before the messenger is used.
+    void setMemoryBudget(common::MemoryBudget::Pointer memoryBudget);
+
 private:
     using std::enable_shared_from_this<Messenger>::shared_from_this;
     typedef std::list<std::pair<Message::Pointer, SendPromise::Pointer>> ChannelSendQueue;
     void doSend();
     void inStreamMessageHandler(Message::Pointer message);
     void outStreamMessageHandler(ChannelSendQueue::iterator queueElement);
+    void inStreamErrorHandler(const error::Error& e);
     void rejectReceivePromiseQueue(const error::Error& e);
     void rejectSendPromiseQueue(const error::Error& e);
     void parseMessage(Message::Pointer message, ReceivePromise::Pointer promise);
+    void releaseMemory(size_t size);
 
     boost::asio::io_service::strand receiveStrand_;
     boost::asio::io_service::strand sendStrand_;
@@ -59,6 +72,9 @@ private:
     ChannelReceivePromiseQueue channelReceivePromiseQueue_;
     ChannelReceiveMessageQueue channelReceiveMessageQueue_;
     ChannelSendQueue channelSendPromiseQueue_;
+    io::DispatchMode dispatchMode_;
+    common::MemoryBudget::Pointer memoryBudget_;
+    bool memoryBudgetExceeded_;
 };
 
 }
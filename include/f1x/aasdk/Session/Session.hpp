@@ -0,0 +1,74 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <boost/asio.hpp>
+#include <boost/core/noncopyable.hpp>
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
+#include <f1x/aasdk/USB/IUSBWrapper.hpp>
+#include <f1x/aasdk/Transport/MeteredTransport.hpp>
+#include <f1x/aasdk/Messenger/ICryptor.hpp>
+#include <f1x/aasdk/Messenger/IMessenger.hpp>
+#include <f1x/aasdk/Session/SessionStatistics.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace session
+{
+
+// One connected device: its own receive and send strands on a shared io_service, a memory budget charged
+// by its USB transports, message in streams and messengers, and meters on its transports. Objects created by the session refer to its strands
+// and must be released before it.
+class Session: boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<Session> Pointer;
+
+    Session(SessionId id, usb::IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, size_t memoryLimit, size_t receiveBufferSize);
+
+    // throws MEMORY_BUDGET_EXCEEDED when the receive buffer does not fit the budget
+    transport::ITransport::Pointer createUSBTransport(usb::DeviceHandle handle);
+    // meters a transport created outside the session, e.g. a TCP transport bound to the receive strand
+    transport::ITransport::Pointer meterTransport(transport::ITransport::Pointer transport);
+    messenger::IMessenger::Pointer createMessenger(transport::ITransport::Pointer transport, messenger::ICryptor::Pointer cryptor);
+
+    SessionId getId() const;
+    boost::asio::io_service::strand& getReceiveStrand();
+    boost::asio::io_service::strand& getSendStrand();
+    const common::MemoryBudget& getMemoryBudget() const;
+    // safe to call from any thread
+    SessionStatistics getStatistics() const;
+
+private:
+    const SessionId id_;
+    usb::IUSBWrapper& usbWrapper_;
+    boost::asio::io_service::strand receiveStrand_;
+    boost::asio::io_service::strand sendStrand_;
+    common::MemoryBudget::Pointer memoryBudget_;
+    const size_t receiveBufferSize_;
+    transport::MeteredTransport::Counters::Pointer transportCounters_;
+    const std::chrono::steady_clock::time_point startTime_;
+};
+
+}
+}
+}
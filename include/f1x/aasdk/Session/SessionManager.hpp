@@ -0,0 +1,93 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <vector>
+#include <boost/core/noncopyable.hpp>
+#include <f1x/aasdk/IO/IOThread.hpp>
+#include <f1x/aasdk/IO/WorkerPool.hpp>
+#include <f1x/aasdk/USB/IUSBWrapper.hpp>
+#include <f1x/aasdk/Session/Session.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace session
+{
+
+struct SessionManagerConfiguration
+{
+    io::WorkerPool::Configuration workers = io::WorkerPool::createConfiguration(std::max(1u, std::thread::hardware_concurrency()), "aasdk-worker");
+    io::IOThreadConfiguration usbEventThread{"aasdk-usb", -1, 0};
+    // bytes a session may hold in USB transport receive buffers, messages being reassembled and messenger
+    // queues, zero for no cap. Transports created outside the session and passed to meterTransport() are not counted.
+    size_t sessionMemoryLimit = 0;
+    // receive buffer of each USB transport, has to hold the largest frame plus one transfer
+    size_t sessionReceiveBufferSize = cDefaultSessionReceiveBufferSize;
+
+    static constexpr size_t cDefaultSessionReceiveBufferSize = 1024 * 1024;
+};
+
+struct SessionManagerReport
+{
+    std::vector<SessionStatistics> sessions;
+    // byte counts and throughputs summed over the sessions, elapsed is the longest session lifetime
+    SessionStatistics aggregate;
+    std::chrono::nanoseconds workerCPUTime = std::chrono::nanoseconds(0);
+};
+
+// Runs many devices in one process: every session gets its own strands on a shared worker pool,
+// so sessions progress in parallel while each one stays serialized. A single thread handles libusb
+// events for all of them.
+class SessionManager: boost::noncopyable
+{
+public:
+    SessionManager(usb::IUSBWrapper& usbWrapper, SessionManagerConfiguration configuration = SessionManagerConfiguration());
+    ~SessionManager();
+
+    void start();
+    void stop();
+
+    Session::Pointer createSession();
+    // the session's transports and messengers must be released as well
+    void releaseSession(SessionId id);
+    std::vector<Session::Pointer> getSessions() const;
+    SessionManagerReport getReport() const;
+
+    io::WorkerPool& getWorkerPool();
+    const io::IOThread& getUSBEventThread() const;
+
+private:
+    usb::IUSBWrapper& usbWrapper_;
+    const size_t sessionMemoryLimit_;
+    const size_t sessionReceiveBufferSize_;
+    io::WorkerPool workerPool_;
+    io::IOThread usbEventThread_;
+    mutable std::mutex mutex_;
+    SessionId nextSessionId_;
+    std::map<SessionId, Session::Pointer> sessions_;
+};
+
+}
+}
+}
@@ -0,0 +1,78 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <boost/asio.hpp>
+#include <boost/core/noncopyable.hpp>
+#include <f1x/aasdk/IO/IOThread.hpp>
+#include <f1x/aasdk/USB/IUSBWrapper.hpp>
+#include <f1x/aasdk/Transport/ITransport.hpp>
+#include <f1x/aasdk/Messenger/ICryptor.hpp>
+#include <f1x/aasdk/Messenger/IMessenger.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace session
+{
+
+// Runs a session on dedicated threads: libusb event handling, the receive path
+// (USB completions, frame assembly, decryption) and the send path (encryption, USB submission).
+// A fourth thread is meant for audio channels so playback can be given real-time priority
+// without promoting the rest of the pipeline.
+class SessionRuntime: boost::noncopyable
+{
+public:
+    SessionRuntime(usb::IUSBWrapper& usbWrapper,
+                   io::IOThreadConfiguration usbEventThreadConfiguration,
+                   io::IOThreadConfiguration receiveThreadConfiguration,
+                   io::IOThreadConfiguration sendThreadConfiguration,
+                   io::IOThreadConfiguration audioThreadConfiguration);
+    ~SessionRuntime();
+
+    void start();
+    void stop();
+
+    transport::ITransport::Pointer createUSBTransport(usb::DeviceHandle handle);
+    messenger::IMessenger::Pointer createMessenger(transport::ITransport::Pointer transport, messenger::ICryptor::Pointer cryptor);
+
+    boost::asio::io_service::strand& getReceiveStrand();
+    boost::asio::io_service::strand& getSendStrand();
+    boost::asio::io_service::strand& getAudioStrand();
+
+    const io::IOThread& getUSBEventThread() const;
+    const io::IOThread& getReceiveThread() const;
+    const io::IOThread& getSendThread() const;
+    const io::IOThread& getAudioThread() const;
+
+private:
+    usb::IUSBWrapper& usbWrapper_;
+    io::IOThread usbEventThread_;
+    io::IOThread receiveThread_;
+    io::IOThread sendThread_;
+    io::IOThread audioThread_;
+    boost::asio::io_service::strand receiveStrand_;
+    boost::asio::io_service::strand sendStrand_;
+    boost::asio::io_service::strand audioStrand_;
+};
+
+}
+}
+}
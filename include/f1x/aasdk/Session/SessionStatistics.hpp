@@ -0,0 +1,53 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace session
+{
+
+typedef size_t SessionId;
+
+struct SessionStatistics
+{
+    SessionId id = 0;
+    std::chrono::nanoseconds elapsed = std::chrono::nanoseconds(0);
+    // bytes delivered by and accepted by the session's metered transports
+    uint64_t receivedBytes = 0;
+    uint64_t sentBytes = 0;
+    // bytes per second over the elapsed time
+    double receiveThroughput = 0;
+    double sendThroughput = 0;
+    // memory charged to the session, see SessionManagerConfiguration::sessionMemoryLimit
+    size_t memoryUsage = 0;
+    size_t peakMemoryUsage = 0;
+    size_t memoryLimit = 0;
+    uint64_t memoryRejections = 0;
+};
+
+}
+}
+}
@@ -33,7 +33,15 @@ namespace transport
 class DataSink
 {
 public:
-    DataSink();
+    static constexpr common::Data::size_type cDefaultChunkSize = 16384;
+
+    // the capacity bounds the buffered data, a fill() is shortened to the remaining space
+    explicit DataSink(common::Data::size_type chunkSize = cDefaultChunkSize, common::Data::size_type capacity = common::cStaticDataSize);
+
+    // takes effect with the next fill()
+    void setChunkSize(common::Data::size_type chunkSize);
+    common::Data::size_type getChunkSize() const;
+    common::Data::size_type getCapacity() const;
 
     common::DataBuffer fill();
     void commit(common::Data::size_type size);
@@ -43,7 +51,8 @@ public:
 
 private:
     boost::circular_buffer<common::Data::value_type> data_;
-    static constexpr common::Data::size_type cChunkSize = 16384;
+    common::Data::size_type chunkSize_;
+    common::Data::size_type filledSize_;
 };
 
 }
@@ -40,15 +40,22 @@ public:
     virtual X509* readCertificate(const std::string& certificate) = 0;
     virtual EVP_PKEY* readPrivateKey(const std::string& privateKey) = 0;
     virtual const SSL_METHOD* getMethod() = 0;
+    virtual const SSL_METHOD* getServerMethod() = 0;
     virtual SSL_CTX* createContext(const SSL_METHOD* method) = 0;
     virtual bool useCertificate(SSL_CTX* context, X509* certificate) = 0;
     virtual bool usePrivateKey(SSL_CTX* context, EVP_PKEY* privateKey) = 0;
+    // TLS 1.2 ciphers and TLS 1.3 suites are configured separately, both as OpenSSL colon separated lists.
+    // Both fail if any single name in the list is unknown, not only when nothing matched.
+    virtual bool setCipherList(SSL_CTX* context, const std::string& cipherList) = 0;
+    virtual bool setCipherSuites(SSL_CTX* context, const std::string& cipherSuites) = 0;
     virtual SSL* createInstance(SSL_CTX* context) = 0;
     virtual bool checkPrivateKey(SSL* ssl) = 0;
     virtual std::pair<BIO*, BIO*> createBIOs() = 0;
     virtual void setBIOs(SSL* ssl, const BIOs& bIOs, size_t maxBufferSize) = 0;
     virtual void setConnectState(SSL* ssl) = 0;
+    virtual void setAcceptState(SSL* ssl) = 0;
     virtual int doHandshake(SSL* ssl) = 0;
+    virtual std::string getCipherName(const SSL* ssl) = 0;
     virtual void free(SSL* ssl) = 0;
     virtual void free(SSL_CTX* context) = 0;
     virtual void free(BIO* bio) = 0;
@@ -0,0 +1,67 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <boost/asio.hpp>
+#include <boost/core/noncopyable.hpp>
+#include <f1x/aasdk/Transport/ITransport.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+
+// Counts the bytes delivered by and accepted by the wrapped transport. Completion handlers run in place
+// on the given strands, so metering adds no extra hop when the strands are the ones the transport uses.
+class MeteredTransport: public ITransport, public std::enable_shared_from_this<MeteredTransport>, boost::noncopyable
+{
+public:
+    // may be shared by several transports and outlives them, e.g. to keep per-session totals
+    struct Counters
+    {
+        typedef std::shared_ptr<Counters> Pointer;
+
+        std::atomic<uint64_t> receivedBytes{0};
+        std::atomic<uint64_t> sentBytes{0};
+    };
+
+    MeteredTransport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand, ITransport::Pointer transport,
+                     Counters::Pointer counters = std::make_shared<Counters>());
+
+    void receive(size_t size, ReceivePromise::Pointer promise) override;
+    void send(common::Data data, SendPromise::Pointer promise) override;
+    void stop() override;
+
+    const Counters& getCounters() const;
+
+private:
+    using std::enable_shared_from_this<MeteredTransport>::shared_from_this;
+
+    boost::asio::io_service::strand& receiveStrand_;
+    boost::asio::io_service::strand& sendStrand_;
+    ITransport::Pointer transport_;
+    Counters::Pointer counters_;
+};
+
+}
+}
+}
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <string>
+#include <vector>
 #include <f1x/aasdk/Transport/ISSLWrapper.hpp>
 
 namespace f1x
@@ -36,15 +38,20 @@ public:
     X509* readCertificate(const std::string& certificate) override;
     EVP_PKEY* readPrivateKey(const std::string& privateKey) override;
     const SSL_METHOD* getMethod() override;
+    const SSL_METHOD* getServerMethod() override;
     SSL_CTX* createContext(const SSL_METHOD* method) override;
     bool useCertificate(SSL_CTX* context, X509* certificate) override;
     bool usePrivateKey(SSL_CTX* context, EVP_PKEY* privateKey) override;
+    bool setCipherList(SSL_CTX* context, const std::string& cipherList) override;
+    bool setCipherSuites(SSL_CTX* context, const std::string& cipherSuites) override;
     SSL* createInstance(SSL_CTX* context) override;
     bool checkPrivateKey(SSL* ssl) override;
     BIOs createBIOs() override;
     void setBIOs(SSL* ssl, const BIOs& bIOs, size_t maxBufferSize) override;
     void setConnectState(SSL* ssl) override;
+    void setAcceptState(SSL* ssl) override;
     int doHandshake(SSL* ssl) override;
+    std::string getCipherName(const SSL* ssl) override;
     int getError(SSL* ssl, int returnCode) override;
 
     void free(SSL* ssl) override;
@@ -59,6 +66,9 @@ public:
     int getAvailableBytes(const SSL* ssl) override;
     int sslRead(SSL *ssl, void *buf, int num) override;
     int sslWrite(SSL *ssl, const void *buf, int num) override;
+
+private:
+    static std::vector<std::string> splitCipherNames(const std::string& cipherNames);
 };
 
 }
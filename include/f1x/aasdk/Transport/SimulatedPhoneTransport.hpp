@@ -0,0 +1,56 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <boost/asio.hpp>
+#include <f1x/aasdk/Transport/Transport.hpp>
+#include <f1x/aasdk/USB/SimulatedUSBWrapper.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+
+// Phone end of a SimulatedUSBWrapper link: receives what the head unit writes to the bulk OUT endpoint
+// and queues sent data for the head unit's bulk IN transfers. Lets the phone emulator run
+// against a head unit using USBTransport without hardware.
+class SimulatedPhoneTransport: public Transport
+{
+public:
+    SimulatedPhoneTransport(boost::asio::io_service& ioService, usb::SimulatedUSBWrapper& usbWrapper);
+
+    void stop() override;
+
+private:
+    void enqueueReceive(common::DataBuffer buffer) override;
+    void enqueueSend(SendQueue::iterator queueElement) override;
+    void completeReceive();
+
+    usb::SimulatedUSBWrapper& usbWrapper_;
+    bool attached_;
+    bool stopped_;
+    common::Data headUnitData_;
+    common::DataBuffer receiveBuffer_;
+};
+
+}
+}
+}
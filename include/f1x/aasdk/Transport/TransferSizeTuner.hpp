@@ -0,0 +1,85 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/Transport/DataSink.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+
+// Hill-climbing tuner for the size of IN transfers. Every window of completed transfers the mean
+// number of bytes per transfer is compared with the previous window: the size is doubled while larger
+// transfers keep coming back fuller (fewer completions and resubmissions for the same data), a growth
+// step that did not pay off is reverted and held for a few windows, and the size is halved whenever
+// control frames reported a latency above the budget. Bytes per completion rather than bytes per second
+// is compared because an IN transfer also waits while the phone has nothing to send, so its duration
+// mostly reflects the phone's send rate. Nothing in the library reports control frame latency on its
+// own: the application connects e.g. LinkMonitor::setRoundTripTimeHandler to onControlFrameLatency.
+class TransferSizeTuner: boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<TransferSizeTuner> Pointer;
+    typedef std::chrono::steady_clock::duration Duration;
+
+    TransferSizeTuner(size_t minTransferSize = 4096,
+                      size_t maxTransferSize = 262144,
+                      size_t initialTransferSize = DataSink::cDefaultChunkSize,
+                      std::chrono::microseconds latencyBudget = cDefaultLatencyBudget,
+                      size_t windowSize = cDefaultWindowSize);
+
+    // called by the transport on its receive strand
+    void onTransferCompleted(size_t bytesTransferred);
+    // may be called from any thread, e.g. with the round trip times measured by LinkMonitor
+    void onControlFrameLatency(Duration latency);
+
+    size_t getTransferSize() const;
+
+    static constexpr std::chrono::microseconds cDefaultLatencyBudget = std::chrono::milliseconds(5);
+    static constexpr size_t cDefaultWindowSize = 32;
+
+private:
+    void evaluateWindow();
+
+    size_t minTransferSize_;
+    size_t maxTransferSize_;
+    std::chrono::microseconds latencyBudget_;
+    size_t windowSize_;
+    std::atomic<size_t> transferSize_;
+    std::atomic<bool> latencyBudgetExceeded_;
+    size_t windowTransfers_;
+    size_t windowBytes_;
+    double previousBytesPerTransfer_;
+    bool grown_;
+    size_t holdWindows_;
+
+    static constexpr size_t cHoldWindows = 8;
+    static constexpr double cMinImprovement = 0.05;
+};
+
+}
+}
+}
@@ -21,8 +21,10 @@
 #include <list>
 #include <queue>
 #include <boost/asio.hpp>
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
 #include <f1x/aasdk/Transport/ITransport.hpp>
 #include <f1x/aasdk/Transport/DataSink.hpp>
+#include <f1x/aasdk/Transport/TransferSizeTuner.hpp>
 
 namespace f1x
 {
@@ -35,10 +37,24 @@ class Transport: public ITransport, public std::enable_shared_from_this<Transpor
 {
 public:
     Transport(boost::asio::io_service& ioService);
+    // session mode: every transport handler runs on the shared session strand
+    // and promises created on it complete in place instead of being re-posted
+    Transport(boost::asio::io_service::strand& strand);
+    Transport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand);
+    // receive buffer of receiveBufferSize bytes charged to the budget for the lifetime of the transport,
+    // throws MEMORY_BUDGET_EXCEEDED when it does not fit
+    Transport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand,
+              common::MemoryBudget::Pointer memoryBudget, size_t receiveBufferSize);
+    ~Transport() override;
 
     void receive(size_t size, ReceivePromise::Pointer promise) override;
     void send(common::Data data, SendPromise::Pointer promise) override;
 
+    // size of the buffer handed to each receive transfer, applied from the next transfer on
+    void setReceiveChunkSize(size_t chunkSize);
+    // when set, the tuner overrides the receive chunk size after every completed transfer
+    void setTransferSizeTuner(TransferSizeTuner::Pointer transferSizeTuner);
+
 protected:
     typedef std::list<std::pair<size_t, ReceivePromise::Pointer>> ReceiveQueue;
     typedef std::list<std::pair<common::Data, SendPromise::Pointer>> SendQueue;
@@ -52,12 +68,15 @@ protected:
     virtual void enqueueSend(SendQueue::iterator queueElement) = 0;
 
     DataSink receivedDataSink_;
+    TransferSizeTuner::Pointer transferSizeTuner_;
 
     boost::asio::io_service::strand receiveStrand_;
     ReceiveQueue receiveQueue_;
 
     boost::asio::io_service::strand sendStrand_;
     SendQueue sendQueue_;
+    io::DispatchMode dispatchMode_;
+    common::MemoryBudget::Pointer memoryBudget_;
 };
 
 }
@@ -33,6 +33,10 @@ class USBTransport: public Transport
 {
 public:
     USBTransport(boost::asio::io_service& ioService, usb::IAOAPDevice::Pointer aoapDevice);
+    USBTransport(boost::asio::io_service::strand& strand, usb::IAOAPDevice::Pointer aoapDevice);
+    USBTransport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand, usb::IAOAPDevice::Pointer aoapDevice);
+    USBTransport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand,
+                 common::MemoryBudget::Pointer memoryBudget, size_t receiveBufferSize, usb::IAOAPDevice::Pointer aoapDevice);
 
     void stop() override;
 
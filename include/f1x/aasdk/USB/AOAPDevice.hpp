@@ -34,15 +34,32 @@ namespace usb
 class AOAPDevice: public IAOAPDevice, boost::noncopyable
 {
 public:
-    AOAPDevice(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle, const libusb_interface_descriptor* interfaceDescriptor);
+    static constexpr size_t cDefaultTransferPoolSize = 4;
+
+    AOAPDevice(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle, const libusb_interface_descriptor* interfaceDescriptor,
+               size_t transferPoolSize = cDefaultTransferPoolSize);
+    AOAPDevice(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& strand, DeviceHandle handle, const libusb_interface_descriptor* interfaceDescriptor,
+               size_t transferPoolSize = cDefaultTransferPoolSize);
+    AOAPDevice(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& inStrand, boost::asio::io_service::strand& outStrand,
+               DeviceHandle handle, const libusb_interface_descriptor* interfaceDescriptor,
+               size_t transferPoolSize = cDefaultTransferPoolSize);
     ~AOAPDevice() override;
 
     IUSBEndpoint& getInEndpoint() override;
     IUSBEndpoint& getOutEndpoint() override;
 
-    static IAOAPDevice::Pointer create(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle);
+    static IAOAPDevice::Pointer create(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle,
+                                       size_t transferPoolSize = cDefaultTransferPoolSize);
+    static IAOAPDevice::Pointer create(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& strand, DeviceHandle handle,
+                                       size_t transferPoolSize = cDefaultTransferPoolSize);
+    static IAOAPDevice::Pointer create(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& inStrand, boost::asio::io_service::strand& outStrand, DeviceHandle handle,
+                                       size_t transferPoolSize = cDefaultTransferPoolSize);
 
 private:
+    template<typename InExecutionContextType, typename OutExecutionContextType>
+    void createEndpoints(InExecutionContextType& inExecutionContext, OutExecutionContextType& outExecutionContext, size_t transferPoolSize);
+
+    static const libusb_interface_descriptor* claimInterface(IUSBWrapper& usbWrapper, DeviceHandle handle);
     static ConfigDescriptorHandle getConfigDescriptor(IUSBWrapper& usbWrapper, DeviceHandle handle);
     static const libusb_interface* getInterface(const ConfigDescriptorHandle& configDescriptorHandle);
     static const libusb_interface_descriptor* getInterfaceDescriptor(const libusb_interface* interface);
@@ -0,0 +1,85 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <vector>
+#include <f1x/aasdk/USB/IUSBWrapper.hpp>
+#include <f1x/aasdk/USB/IAccessoryModeQueryFactory.hpp>
+#include <f1x/aasdk/USB/IAccessoryModeQueryChain.hpp>
+#include <f1x/aasdk/Error/Error.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+
+struct AccessoryModeQueryStepTiming
+{
+    AccessoryModeQueryType queryType;
+    // from submission of the query until its completion
+    std::chrono::microseconds duration;
+    error::ErrorCode errorCode;
+};
+
+typedef std::vector<AccessoryModeQueryStepTiming> AccessoryModeQueryStepTimings;
+
+// Same steps as AccessoryModeQueryChain, but once the protocol version is known all six
+// identification strings are submitted back-to-back instead of waiting for each transfer to
+// complete; START follows when all of them succeeded. The first failing step rejects the chain
+// with its own error and cancels the remaining ones. Per-step timings are logged and kept.
+class AccessoryModePipelinedQueryChain: public IAccessoryModeQueryChain, public std::enable_shared_from_this<AccessoryModePipelinedQueryChain>, boost::noncopyable
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    AccessoryModePipelinedQueryChain(IUSBWrapper& usbWrapper,
+                                     boost::asio::io_service& ioService,
+                                     IAccessoryModeQueryFactory& queryFactory);
+
+    void start(DeviceHandle handle, Promise::Pointer promise) override;
+    void cancel() override;
+
+    // complete once the chain promise is settled
+    const AccessoryModeQueryStepTimings& getStepTimings() const;
+
+private:
+    using std::enable_shared_from_this<AccessoryModePipelinedQueryChain>::shared_from_this;
+
+    void startQuery(AccessoryModeQueryType queryType, IUSBEndpoint::Pointer usbEndpoint);
+    void queryHandler(AccessoryModeQueryType queryType, Clock::time_point startTime, IUSBEndpoint::Pointer usbEndpoint);
+    void queryErrorHandler(AccessoryModeQueryType queryType, Clock::time_point startTime, const error::Error& e);
+    void sendStrings(IUSBEndpoint::Pointer usbEndpoint);
+    void logStepTimings() const;
+
+    IUSBWrapper& usbWrapper_;
+    boost::asio::io_service::strand strand_;
+    IAccessoryModeQueryFactory& queryFactory_;
+    Promise::Pointer promise_;
+    std::vector<IAccessoryModeQuery::Pointer> activeQueries_;
+    size_t pendingStrings_;
+    Clock::time_point startTime_;
+    AccessoryModeQueryStepTimings stepTimings_;
+};
+
+}
+}
+}
@@ -31,15 +31,18 @@ namespace usb
 class AccessoryModeQueryChainFactory: public IAccessoryModeQueryChainFactory
 {
 public:
+    // pipelined: create AccessoryModePipelinedQueryChain instead of the strictly sequential chain
     AccessoryModeQueryChainFactory(IUSBWrapper& usbWrapper,
                                    boost::asio::io_service& ioService,
-                                   IAccessoryModeQueryFactory& queryFactory);
+                                   IAccessoryModeQueryFactory& queryFactory,
+                                   bool pipelined = false);
     IAccessoryModeQueryChain::Pointer create() override;
 
 private:
     IUSBWrapper& usbWrapper_;
     boost::asio::io_service& ioService_;
     IAccessoryModeQueryFactory& queryFactory_;
+    bool pipelined_;
 };
 
 }
@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <list>
+#include <set>
 #include <boost/asio.hpp>
 #include <f1x/aasdk/USB/IUSBWrapper.hpp>
 #include <f1x/aasdk/USB/IAccessoryModeQueryChainFactory.hpp>
@@ -30,10 +32,27 @@ namespace aasdk
 namespace usb
 {
 
+// Decides from the device descriptor, before a device is opened, whether it is worth probing.
+// Empty lists disable the respective check; a vendor on the allow list is probed regardless of its class.
+struct ConnectedAccessoriesFilter
+{
+    std::set<uint8_t> deniedDeviceClasses;
+    std::set<uint16_t> allowedVendorIds;
+    std::set<uint16_t> deniedVendorIds;
+
+    bool empty() const;
+    bool accepts(const libusb_device_descriptor& deviceDescriptor) const;
+    // skips hubs and HID devices, which are never AOAP capable
+    static ConnectedAccessoriesFilter createDefault();
+};
+
 class ConnectedAccessoriesEnumerator: public IConnectedAccessoriesEnumerator, public std::enable_shared_from_this<ConnectedAccessoriesEnumerator>
 {
 public:
     ConnectedAccessoriesEnumerator(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, IAccessoryModeQueryChainFactory& queryChainFactory);
+    // filtered mode: devices rejected by the filter are not opened, up to maxConcurrentQueries devices are probed at once
+    ConnectedAccessoriesEnumerator(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, IAccessoryModeQueryChainFactory& queryChainFactory,
+                                   ConnectedAccessoriesFilter filter, size_t maxConcurrentQueries);
 
     void enumerate(Promise::Pointer promise) override;
     void cancel() override;
@@ -42,13 +61,20 @@ private:
     using std::enable_shared_from_this<ConnectedAccessoriesEnumerator>::shared_from_this;
     void queryNextDevice();
     DeviceHandle getNextDeviceHandle();
+    bool isFilteredOut(libusb_device* device) const;
+    void removeQueryChain(const IAccessoryModeQueryChain* queryChain);
+    void cancelQueryChains();
     void reset();
 
     IUSBWrapper& usbWrapper_;
     boost::asio::io_service::strand strand_;
     IAccessoryModeQueryChainFactory& queryChainFactory_;
-    IAccessoryModeQueryChain::Pointer queryChain_;
+    ConnectedAccessoriesFilter filter_;
+    size_t maxConcurrentQueries_;
+    std::list<IAccessoryModeQueryChain::Pointer> queryChains_;
     Promise::Pointer promise_;
+    // completions of chains cancelled by an earlier enumeration still arrive through the strand
+    uint64_t enumerationId_;
     DeviceListHandle deviceListHandle_;
     DeviceList::iterator actualDeviceIter_;
 };
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <f1x/aasdk/USB/USBWrapper.hpp>
+#include <f1x/aasdk/USB/USBTransferBuffer.hpp>
 #include <f1x/aasdk/Common/Data.hpp>
 #include <f1x/aasdk/IO/Promise.hpp>
 
@@ -45,6 +46,7 @@ public:
     virtual void interruptTransfer(common::DataBuffer buffer, uint32_t timeout, Promise::Pointer promise) = 0;
     virtual void cancelTransfers() = 0;
     virtual DeviceHandle getDeviceHandle() const = 0;
+    virtual USBTransferBuffer::Pointer allocateTransferBuffer(size_t size) = 0;
 };
 
 }
@@ -20,6 +20,7 @@
 
 #include <memory>
 #include <list>
+#include <vector>
 #include <boost/asio.hpp>
 #include <libusb.h>
 
@@ -35,6 +36,7 @@ typedef std::list<libusb_device*> DeviceList;
 typedef std::shared_ptr<DeviceList> DeviceListHandle;
 typedef std::shared_ptr<libusb_config_descriptor> ConfigDescriptorHandle;
 typedef std::shared_ptr<libusb_hotplug_callback_handle> HotplugCallbackHandle;
+typedef std::vector<libusb_pollfd> PollfdList;
 
 class IUSBWrapper
 {
@@ -73,9 +75,18 @@ public:
         uint16_t wLength) = 0;
     virtual int getDeviceDescriptor(libusb_device *dev, libusb_device_descriptor &desc) = 0;
     virtual void handleEvents() = 0;
+    virtual void interruptEventHandler() = 0;
+    virtual int handleEventsTimeout(timeval* tv) = 0;
+    virtual PollfdList getPollfds() = 0;
+    virtual void setPollfdNotifiers(libusb_pollfd_added_cb added_cb, libusb_pollfd_removed_cb removed_cb, void* user_data) = 0;
+    virtual int getNextTimeout(timeval* tv) = 0;
+    virtual bool pollfdsHandleTimeouts() = 0;
     virtual HotplugCallbackHandle hotplugRegisterCallback(libusb_hotplug_event events, libusb_hotplug_flag flags, int vendor_id, int product_id, int dev_class,
                                                           libusb_hotplug_callback_fn cb_fn, void *user_data) = 0;
     virtual libusb_transfer* allocTransfer(int iso_packets) = 0;
+    // returns nullptr when the platform or the device does not support DMA-able transfer memory
+    virtual unsigned char* devMemAlloc(const DeviceHandle& dev_handle, size_t length) = 0;
+    virtual int devMemFree(const DeviceHandle& dev_handle, unsigned char* buffer, size_t length) = 0;
 };
 
 }
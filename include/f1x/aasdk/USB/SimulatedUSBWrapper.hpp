@@ -0,0 +1,184 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <memory>
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/Common/Data.hpp>
+#include <f1x/aasdk/IO/SimulationClock.hpp>
+#include <f1x/aasdk/USB/IUSBWrapper.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+
+struct SimulatedPhoneConfiguration
+{
+    // identity before switching to accessory mode
+    uint16_t vendorId = 0x18D1;
+    uint16_t productId = 0x4EE1;
+    uint16_t protocolVersion = 2;
+    std::chrono::microseconds controlTransferLatency = std::chrono::microseconds(200);
+    std::chrono::milliseconds reenumerationDelay = std::chrono::milliseconds(100);
+    std::chrono::microseconds bulkTransferLatency = std::chrono::microseconds(100);
+    // per direction, 0 - unlimited
+    size_t bytesPerSecond = 0;
+};
+
+// Software IUSBWrapper emulating a single phone: hotplug arrival, the AOAP control requests,
+// re-enumeration with the Google accessory VID/PID and bulk endpoints backed by in-memory queues.
+// Transfers complete on the given io_service after the configured latency and link throughput,
+// so USBHub, the query chains, AOAPDevice and USBTransport run unmodified without hardware.
+class SimulatedUSBWrapper: public IUSBWrapper, boost::noncopyable
+{
+public:
+    typedef std::function<void(common::Data)> HeadUnitDataHandler;
+
+    SimulatedUSBWrapper(boost::asio::io_service& ioService, SimulatedPhoneConfiguration configuration = SimulatedPhoneConfiguration());
+    ~SimulatedUSBWrapper() override;
+
+    void connectPhone();
+    void disconnectPhone();
+    // phone -> head unit, consumed by bulk IN transfers
+    void sendToHeadUnit(common::Data data);
+    // head unit -> phone, called with the payload of every completed bulk OUT transfer;
+    // data completed while no handler is set is kept and handed to the next handler
+    void setHeadUnitDataHandler(HeadUnitDataHandler handler);
+    std::string getAccessoryString(uint16_t index) const;
+    bool isAccessoryModeStarted() const;
+
+    int releaseInterface(const DeviceHandle& dev_handle, int interface_number) override;
+    libusb_device* getDevice(const DeviceHandle& dev_handle) override;
+    int claimInterface(const DeviceHandle& dev_handle, int interface_number) override;
+    DeviceHandle openDeviceWithVidPid(uint16_t vendor_id, uint16_t product_id) override;
+    int getConfigDescriptor(libusb_device *dev, uint8_t config_index, ConfigDescriptorHandle& config_descriptor_handle) override;
+
+    void fillBulkTransfer(libusb_transfer *transfer,
+        const DeviceHandle& dev_handle, unsigned char endpoint,
+        unsigned char *buffer, int length, libusb_transfer_cb_fn callback,
+        void *user_data, unsigned int timeout) override;
+
+    void fillInterruptTransfer(libusb_transfer *transfer,
+        const DeviceHandle& dev_handle, unsigned char endpoint,
+        unsigned char *buffer, int length, libusb_transfer_cb_fn callback,
+        void *user_data, unsigned int timeout) override;
+
+    void fillControlTransfer(
+        libusb_transfer *transfer, const DeviceHandle& dev_handle,
+        unsigned char *buffer, libusb_transfer_cb_fn callback, void *user_data,
+        unsigned int timeout) override;
+
+    int submitTransfer(libusb_transfer *transfer) override;
+    int cancelTransfer(libusb_transfer *transfer) override;
+    void freeTransfer(libusb_transfer *transfer) override;
+
+    ssize_t getDeviceList(DeviceListHandle& handle) override;
+    int open(libusb_device *dev, DeviceHandle& dev_handle) override;
+    void fillControlSetup(unsigned char *buffer,
+        uint8_t bmRequestType, uint8_t bRequest, uint16_t wValue, uint16_t wIndex,
+        uint16_t wLength) override;
+    int getDeviceDescriptor(libusb_device *dev, libusb_device_descriptor &desc) override;
+    void handleEvents() override;
+    void interruptEventHandler() override;
+    int handleEventsTimeout(timeval* tv) override;
+    PollfdList getPollfds() override;
+    void setPollfdNotifiers(libusb_pollfd_added_cb added_cb, libusb_pollfd_removed_cb removed_cb, void* user_data) override;
+    int getNextTimeout(timeval* tv) override;
+    bool pollfdsHandleTimeouts() override;
+    HotplugCallbackHandle hotplugRegisterCallback(libusb_hotplug_event events, libusb_hotplug_flag flags, int vendor_id, int product_id, int dev_class,
+                                                  libusb_hotplug_callback_fn cb_fn, void *user_data) override;
+    libusb_transfer* allocTransfer(int iso_packets) override;
+    unsigned char* devMemAlloc(const DeviceHandle& dev_handle, size_t length) override;
+    int devMemFree(const DeviceHandle& dev_handle, unsigned char* buffer, size_t length) override;
+
+private:
+    struct Device
+    {
+        libusb_device_descriptor descriptor;
+        bool connected;
+    };
+
+    struct HotplugCallback
+    {
+        libusb_hotplug_event events;
+        libusb_hotplug_callback_fn callback;
+        void* userData;
+    };
+
+    typedef io::SimulationClock::time_point TimePoint;
+    typedef std::list<Device> Devices;
+    typedef std::map<int, HotplugCallback> HotplugCallbacks;
+
+    Device& addDevice(uint16_t vendorId, uint16_t productId);
+    Device* findDevice(libusb_device* device);
+    void notifyArrival(Device& device);
+    void handleControlTransfer(libusb_transfer* transfer);
+    void handleBulkOutTransfer(libusb_transfer* transfer);
+    void completeInTransfers();
+    TimePoint reserveLink(TimePoint& linkBusyUntil, size_t size);
+    void scheduleCompletion(libusb_transfer* transfer, TimePoint when, libusb_transfer_status status, int actualLength, std::function<void()> afterCompletion = nullptr);
+    void schedule(TimePoint when, std::function<void()> handler);
+
+    static constexpr uint8_t cAccessoryGetProtocol = 51;
+    static constexpr uint8_t cAccessorySendString = 52;
+    static constexpr uint8_t cAccessoryStart = 53;
+    static constexpr uint16_t cGoogleVendorId = 0x18D1;
+    static constexpr uint16_t cAOAPId = 0x2D00;
+    static constexpr uint8_t cInEndpointAddress = 0x81;
+    static constexpr uint8_t cOutEndpointAddress = 0x01;
+
+    boost::asio::io_service& ioService_;
+    SimulatedPhoneConfiguration configuration_;
+    mutable std::mutex mutex_;
+    Devices devices_;
+    HotplugCallbacks hotplugCallbacks_;
+    int nextHotplugCallbackId_;
+    std::map<uint16_t, std::string> accessoryStrings_;
+    bool accessoryModeStarted_;
+    std::deque<libusb_transfer*> pendingInTransfers_;
+    common::Data phoneData_;
+    TimePoint inLinkBusyUntil_;
+    TimePoint outLinkBusyUntil_;
+    HeadUnitDataHandler headUnitDataHandler_;
+    common::Data headUnitData_;
+    std::condition_variable eventsCondition_;
+    bool eventsInterrupted_;
+
+    libusb_endpoint_descriptor endpointDescriptors_[2];
+    libusb_interface_descriptor interfaceDescriptor_;
+    libusb_interface interface_;
+    libusb_config_descriptor configDescriptor_;
+    // guards handlers still queued on the io_service when the simulator goes away
+    std::shared_ptr<bool> alive_;
+};
+
+}
+}
+}
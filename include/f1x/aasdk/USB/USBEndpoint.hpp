@@ -18,8 +18,9 @@
 
 #pragma once
 
-#include <unordered_map>
+#include <vector>
 #include <memory>
+#include <mutex>
 #include <boost/asio.hpp>
 #include <f1x/aasdk/USB/IUSBWrapper.hpp>
 #include <f1x/aasdk/USB/IUSBEndpoint.hpp>
@@ -36,7 +37,10 @@ class USBEndpoint: public IUSBEndpoint,
         boost::noncopyable
 {
 public:
-    USBEndpoint(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle, uint8_t endpointAddress = 0x00);
+    // transferPoolSize libusb_transfer objects are kept for reuse once allocated; 0 allocates and frees one per transfer
+    USBEndpoint(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle, uint8_t endpointAddress = 0x00, size_t transferPoolSize = 0);
+    USBEndpoint(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& strand, DeviceHandle handle, uint8_t endpointAddress = 0x00, size_t transferPoolSize = 0);
+    ~USBEndpoint() override;
 
     void controlTransfer(common::DataBuffer buffer, uint32_t timeout, Promise::Pointer promise) override;
     void bulkTransfer(common::DataBuffer buffer, uint32_t timeout, Promise::Pointer promise) override;
@@ -44,19 +48,35 @@ public:
     uint8_t getAddress() override;
     void cancelTransfers() override;
     DeviceHandle getDeviceHandle() const override;
+    USBTransferBuffer::Pointer allocateTransferBuffer(size_t size) override;
 
 private:
-    typedef std::unordered_map<libusb_transfer*, Promise::Pointer> Transfers;
+    struct TransferSlot
+    {
+        libusb_transfer* transfer = nullptr;
+        Promise::Pointer promise;
+    };
+
+    // flat in-flight table, free slots have a null transfer; grows only past the highest in-flight count seen so far
+    typedef std::vector<TransferSlot> TransferSlots;
+    typedef std::vector<libusb_transfer*> TransferPool;
 
     using std::enable_shared_from_this<USBEndpoint>::shared_from_this;
     void transfer(libusb_transfer *transfer, Promise::Pointer promise);
     static void transferHandler(libusb_transfer *transfer);
+    libusb_transfer* acquireTransfer();
+    void releaseTransfer(libusb_transfer* transfer);
+    TransferSlots::iterator findSlot(const libusb_transfer* transfer);
 
     IUSBWrapper& usbWrapper_;
     boost::asio::io_service::strand strand_;
     DeviceHandle handle_;
     uint8_t endpointAddress_;
-    Transfers transfers_;
+    TransferSlots transferSlots_;
+    size_t transfersInFlight_;
+    size_t transferPoolSize_;
+    std::mutex transferPoolMutex_;
+    TransferPool transferPool_;
     std::shared_ptr<USBEndpoint> self_;
 };
 
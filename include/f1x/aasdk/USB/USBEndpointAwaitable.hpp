@@ -0,0 +1,58 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#ifdef AASDK_COROUTINES
+
+#include <f1x/aasdk/IO/Awaitable.hpp>
+#include <f1x/aasdk/USB/IUSBEndpoint.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+
+inline auto asyncControlTransfer(IUSBEndpoint& usbEndpoint, common::DataBuffer buffer, uint32_t timeout, boost::asio::io_service::strand& strand)
+{
+    return io::makePromiseAwaitable<size_t>(strand, [&usbEndpoint, buffer, timeout](IUSBEndpoint::Promise::Pointer promise) {
+        usbEndpoint.controlTransfer(buffer, timeout, std::move(promise));
+    });
+}
+
+inline auto asyncBulkTransfer(IUSBEndpoint& usbEndpoint, common::DataBuffer buffer, uint32_t timeout, boost::asio::io_service::strand& strand)
+{
+    return io::makePromiseAwaitable<size_t>(strand, [&usbEndpoint, buffer, timeout](IUSBEndpoint::Promise::Pointer promise) {
+        usbEndpoint.bulkTransfer(buffer, timeout, std::move(promise));
+    });
+}
+
+inline auto asyncInterruptTransfer(IUSBEndpoint& usbEndpoint, common::DataBuffer buffer, uint32_t timeout, boost::asio::io_service::strand& strand)
+{
+    return io::makePromiseAwaitable<size_t>(strand, [&usbEndpoint, buffer, timeout](IUSBEndpoint::Promise::Pointer promise) {
+        usbEndpoint.interruptTransfer(buffer, timeout, std::move(promise));
+    });
+}
+
+}
+}
+}
+
+#endif
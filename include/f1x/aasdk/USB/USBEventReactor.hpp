@@ -0,0 +1,72 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <unordered_map>
+#include <memory>
+#include <boost/asio.hpp>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/USB/IUSBWrapper.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+
+// Drives libusb from the asio reactor instead of a dedicated libusb_handle_events() thread.
+// libusb's pollfds are watched with stream descriptors and its pending timeouts with a timer
+// (skipped when libusb exposes a timerfd). Transfer callbacks run on the reactor's strand, so
+// endpoints created on the same strand complete their promises without a thread handoff.
+class USBEventReactor: public std::enable_shared_from_this<USBEventReactor>, boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<USBEventReactor> Pointer;
+
+    USBEventReactor(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService);
+    USBEventReactor(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& strand);
+
+    void start();
+    void stop();
+
+private:
+    typedef std::shared_ptr<boost::asio::posix::stream_descriptor> Descriptor;
+    typedef std::unordered_map<int, Descriptor> Descriptors;
+
+    using std::enable_shared_from_this<USBEventReactor>::shared_from_this;
+    void addPollfd(int fd, short events);
+    void removePollfd(int fd);
+    void waitForEvent(Descriptor descriptor, boost::asio::posix::stream_descriptor::wait_type waitType);
+    void handleEvents();
+    void scheduleTimeout();
+
+    static void pollfdAddedHandler(int fd, short events, void* userData);
+    static void pollfdRemovedHandler(int fd, void* userData);
+
+    IUSBWrapper& usbWrapper_;
+    boost::asio::io_service::strand strand_;
+    boost::asio::steady_timer timer_;
+    Descriptors descriptors_;
+    bool started_;
+};
+
+}
+}
+}
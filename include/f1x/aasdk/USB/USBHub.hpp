@@ -18,6 +18,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <boost/asio.hpp>
 #include <list>
 #include <f1x/aasdk/USB/IUSBHub.hpp>
@@ -35,15 +36,22 @@ class IUSBWrapper;
 class USBHub: public IUSBHub, public std::enable_shared_from_this<USBHub>, boost::noncopyable
 {
 public:
-    USBHub(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, IAccessoryModeQueryChainFactory& queryChainFactory);
+    // deviceSettleDelay: time a freshly attached non-AOAP device is left alone before it is queried,
+    // some platforms (e.g. VMware USB passthrough) need it; zero queries right away
+    USBHub(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, IAccessoryModeQueryChainFactory& queryChainFactory,
+           std::chrono::milliseconds deviceSettleDelay = cDefaultDeviceSettleDelay);
 
     void start(Promise::Pointer promise) override;
     void cancel() override;
+
+    static constexpr std::chrono::milliseconds cDefaultDeviceSettleDelay = std::chrono::milliseconds(1000);
     
 private:
     typedef std::list<IAccessoryModeQueryChain::Pointer> QueryChainQueue;
+    typedef std::list<std::shared_ptr<boost::asio::steady_timer>> SettleTimers;
     using std::enable_shared_from_this<USBHub>::shared_from_this;
     void handleDevice(libusb_device* device);
+    void queryDevice(DeviceHandle handle);
     bool isAOAPDevice(const libusb_device_descriptor& deviceDescriptor) const;
     static int hotplugEventsHandler(libusb_context* usbContext, libusb_device* device, libusb_hotplug_event event, void* uerData);
 
@@ -54,6 +62,8 @@ private:
     Pointer self_;
     HotplugCallbackHandle hotplugHandle_;
     QueryChainQueue queryChainQueue_;
+    std::chrono::milliseconds deviceSettleDelay_;
+    SettleTimers settleTimers_;
 
     static constexpr uint16_t cGoogleVendorId = 0x18D1;
     static constexpr uint16_t cAOAPId = 0x2D00;
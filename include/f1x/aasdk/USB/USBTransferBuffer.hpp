@@ -0,0 +1,59 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <memory>
+#include <boost/noncopyable.hpp>
+#include <f1x/aasdk/Common/Data.hpp>
+#include <f1x/aasdk/USB/IUSBWrapper.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+
+// Transfer buffer mapped for DMA by the kernel (usbfs zero-copy) when the device supports it,
+// plain heap memory otherwise. Keeps the device handle open for as long as the mapping lives.
+// Only saves the usbfs bounce copy when the data is produced or consumed in place; staging another
+// buffer through it just moves the copy into user space, which is why USBTransport does not use it.
+class USBTransferBuffer: boost::noncopyable
+{
+public:
+    typedef std::shared_ptr<USBTransferBuffer> Pointer;
+
+    USBTransferBuffer(IUSBWrapper& usbWrapper, DeviceHandle handle, size_t size);
+    ~USBTransferBuffer();
+
+    common::DataBuffer getBuffer(size_t size = 0);
+    size_t getSize() const;
+    bool isDeviceMemory() const;
+
+private:
+    IUSBWrapper& usbWrapper_;
+    DeviceHandle handle_;
+    size_t size_;
+    unsigned char* deviceMemory_;
+    common::Data fallbackMemory_;
+};
+
+}
+}
+}
@@ -64,9 +64,17 @@ public:
         uint16_t wLength) override;
     int getDeviceDescriptor(libusb_device *dev, libusb_device_descriptor &desc) override;
     void handleEvents() override;
+    void interruptEventHandler() override;
+    int handleEventsTimeout(timeval* tv) override;
+    PollfdList getPollfds() override;
+    void setPollfdNotifiers(libusb_pollfd_added_cb added_cb, libusb_pollfd_removed_cb removed_cb, void* user_data) override;
+    int getNextTimeout(timeval* tv) override;
+    bool pollfdsHandleTimeouts() override;
     HotplugCallbackHandle hotplugRegisterCallback(libusb_hotplug_event events, libusb_hotplug_flag flags, int vendor_id, int product_id, int dev_class,
                                                   libusb_hotplug_callback_fn cb_fn, void *user_data) override;
     libusb_transfer* allocTransfer(int iso_packets) override;
+    unsigned char* devMemAlloc(const DeviceHandle& dev_handle, size_t length) override;
+    int devMemFree(const DeviceHandle& dev_handle, unsigned char* buffer, size_t length) override;
 
 private:
     libusb_context* usbContext_;
@@ -0,0 +1,54 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <gmock/gmock.h>
+#include <f1x/aasdk/Channel/Control/IControlServiceChannel.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace control
+{
+namespace ut
+{
+
+class ControlServiceChannelMock: public IControlServiceChannel
+{
+public:
+    MOCK_METHOD1(receive, void(IControlServiceChannelEventHandler::Pointer eventHandler));
+    MOCK_METHOD1(sendVersionRequest, void(SendPromise::Pointer promise));
+    MOCK_METHOD2(sendHandshake, void(common::Data handshakeBuffer, SendPromise::Pointer promise));
+    MOCK_METHOD2(sendAuthComplete, void(const proto::messages::AuthCompleteIndication& response, SendPromise::Pointer promise));
+    MOCK_METHOD2(sendServiceDiscoveryResponse, void(const proto::messages::ServiceDiscoveryResponse& response, SendPromise::Pointer promise));
+    MOCK_METHOD2(sendAudioFocusResponse, void(const proto::messages::AudioFocusResponse& response, SendPromise::Pointer promise));
+    MOCK_METHOD2(sendShutdownRequest, void(const proto::messages::ShutdownRequest& request, SendPromise::Pointer promise));
+    MOCK_METHOD2(sendShutdownResponse, void(const proto::messages::ShutdownResponse& response, SendPromise::Pointer promise));
+    MOCK_METHOD2(sendNavigationFocusResponse, void(const proto::messages::NavigationFocusResponse& response, SendPromise::Pointer promise));
+    MOCK_METHOD2(sendPingRequest, void(const proto::messages::PingRequest& request, SendPromise::Pointer promise));
+};
+
+}
+}
+}
+}
+}
@@ -0,0 +1,49 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#pragma once
+
+#include <gmock/gmock.h>
+#include <f1x/aasdk/Channel/Sensor/ISensorServiceChannel.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace sensor
+{
+namespace ut
+{
+
+class SensorServiceChannelMock: public ISensorServiceChannel
+{
+public:
+    MOCK_METHOD1(receive, void(ISensorServiceChannelEventHandler::Pointer eventHandler));
+    MOCK_CONST_METHOD0(getId, messenger::ChannelId());
+    MOCK_METHOD2(sendChannelOpenResponse, void(const proto::messages::ChannelOpenResponse& response, SendPromise::Pointer promise));
+    MOCK_METHOD2(sendSensorEventIndication, void(const proto::messages::SensorEventIndication& indication, SendPromise::Pointer promise));
+    MOCK_METHOD2(sendSensorStartResponse, void(const proto::messages::SensorStartResponseMessage& response, SendPromise::Pointer promise));
+};
+
+}
+}
+}
+}
+}
@@ -39,6 +39,7 @@ public:
     MOCK_METHOD3(interruptTransfer, void(common::DataBuffer buffer, uint32_t timeout, Promise::Pointer promise));
     MOCK_METHOD0(cancelTransfers, void());
     MOCK_CONST_METHOD0(getDeviceHandle, DeviceHandle());
+    MOCK_METHOD1(allocateTransferBuffer, USBTransferBuffer::Pointer(size_t size));
 };
 
 }
@@ -67,9 +67,17 @@ public:
         uint16_t wLength));
     MOCK_METHOD2(getDeviceDescriptor, int(libusb_device *dev, libusb_device_descriptor &desc));
     MOCK_METHOD0(handleEvents, void());
+    MOCK_METHOD0(interruptEventHandler, void());
+    MOCK_METHOD1(handleEventsTimeout, int(timeval* tv));
+    MOCK_METHOD0(getPollfds, PollfdList());
+    MOCK_METHOD3(setPollfdNotifiers, void(libusb_pollfd_added_cb added_cb, libusb_pollfd_removed_cb removed_cb, void* user_data));
+    MOCK_METHOD1(getNextTimeout, int(timeval* tv));
+    MOCK_METHOD0(pollfdsHandleTimeouts, bool());
     MOCK_METHOD7(hotplugRegisterCallback, HotplugCallbackHandle(libusb_hotplug_event events, libusb_hotplug_flag flags, int vendor_id, int product_id, int dev_class,
                                                                 libusb_hotplug_callback_fn cb_fn, void *user_data));
     MOCK_METHOD1(allocTransfer, libusb_transfer*(int iso_packets));
+    MOCK_METHOD2(devMemAlloc, unsigned char*(const DeviceHandle& dev_handle, size_t length));
+    MOCK_METHOD3(devMemFree, int(const DeviceHandle& dev_handle, unsigned char* buffer, size_t length));
 };
 
 }
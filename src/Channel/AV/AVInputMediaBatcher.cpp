@@ -0,0 +1,109 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <f1x/aasdk/Channel/AV/AVInputMediaBatcher.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+AVInputMediaBatcher::AVInputMediaBatcher(boost::asio::io_service::strand& strand, IAVInputServiceChannel::Pointer channel, ErrorHandler errorHandler,
+                                         size_t maxPeriodsPerMessage, std::chrono::microseconds latencyBudget)
+    : strand_(strand)
+    , timer_(strand_.context())
+    , channel_(std::move(channel))
+    , errorHandler_(std::move(errorHandler))
+    , maxPeriodsPerMessage_(std::max<size_t>(1, maxPeriodsPerMessage))
+    , latencyBudget_(latencyBudget)
+    , timestamp_(0)
+    , pendingPeriods_(0)
+{
+
+}
+
+common::DataBuffer AVInputMediaBatcher::beginPeriod(messenger::Timestamp::ValueType timestamp, size_t size)
+{
+    if(pendingPeriods_ == 0)
+    {
+        buffer_ = channel_->acquireAVMediaBuffer(size * maxPeriodsPerMessage_);
+        timestamp_ = timestamp;
+    }
+
+    const auto offset = buffer_.size();
+    buffer_.resize(offset + size);
+    return common::DataBuffer(buffer_, offset);
+}
+
+void AVInputMediaBatcher::commitPeriod()
+{
+    ++statistics_.capturedPeriods;
+
+    if(++pendingPeriods_ >= maxPeriodsPerMessage_ || latencyBudget_.count() == 0)
+    {
+        this->flush();
+    }
+    else if(pendingPeriods_ == 1)
+    {
+        timer_.expires_from_now(latencyBudget_);
+        timer_.async_wait(strand_.wrap([this, self = this->shared_from_this(), timestamp = timestamp_](const boost::system::error_code& e) {
+            if(e != boost::asio::error::operation_aborted && pendingPeriods_ > 0 && timestamp_ == timestamp)
+            {
+                this->flush();
+            }
+        }));
+    }
+}
+
+void AVInputMediaBatcher::flush()
+{
+    if(pendingPeriods_ == 0)
+    {
+        return;
+    }
+
+    timer_.cancel();
+    pendingPeriods_ = 0;
+    ++statistics_.sentMessages;
+    statistics_.sentBytes += buffer_.size() - IAVInputServiceChannel::cAVMediaHeaderSize;
+
+    auto promise = SendPromise::defer(strand_);
+    promise->then([]() {}, [this, self = this->shared_from_this()](const error::Error& e) {
+        if(errorHandler_)
+        {
+            errorHandler_(e);
+        }
+    });
+    channel_->sendAVMediaWithTimestampIndication(timestamp_, std::move(buffer_), std::move(promise));
+    buffer_ = common::Data();
+}
+
+const AVInputMediaBatcherStatistics& AVInputMediaBatcher::getStatistics() const
+{
+    return statistics_;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,118 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Channel/AV/UT/AVInputServiceChannel.mock.hpp>
+#include <f1x/aasdk/Channel/AV/AVInputMediaBatcher.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+namespace ut
+{
+
+using ::testing::_;
+using ::testing::An;
+using ::testing::Invoke;
+
+class AVInputMediaBatcherUnitTest
+{
+protected:
+    AVInputMediaBatcherUnitTest()
+        : strand_(ioService_)
+        , channelMock_(std::make_shared<AVInputServiceChannelMock>())
+    {
+        ON_CALL(*channelMock_, acquireAVMediaBuffer(_)).WillByDefault(Invoke([](size_t capacity) {
+            common::Data buffer(IAVInputServiceChannel::cAVMediaHeaderSize);
+            buffer.reserve(buffer.size() + capacity);
+            return buffer;
+        }));
+    }
+
+    void capture(AVInputMediaBatcher& batcher, messenger::Timestamp::ValueType timestamp, uint8_t value)
+    {
+        auto buffer = batcher.beginPeriod(timestamp, 4);
+        std::fill(buffer.data, buffer.data + buffer.size, value);
+        batcher.commitPeriod();
+    }
+
+    void expectSend(messenger::Timestamp::ValueType timestamp, const common::Data& pcm)
+    {
+        EXPECT_CALL(*channelMock_, sendAVMediaWithTimestampIndication(timestamp, An<common::Data&&>(), _))
+                .WillOnce(Invoke([pcm](messenger::Timestamp::ValueType, common::Data&& buffer, SendPromise::Pointer) {
+                    BOOST_TEST(common::Data(buffer.begin() + IAVInputServiceChannel::cAVMediaHeaderSize, buffer.end()) == pcm, boost::test_tools::per_element());
+                }));
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+    std::shared_ptr<AVInputServiceChannelMock> channelMock_;
+};
+
+BOOST_FIXTURE_TEST_CASE(AVInputMediaBatcher_SendsEveryPeriodWithoutBudget, AVInputMediaBatcherUnitTest)
+{
+    auto batcher = std::make_shared<AVInputMediaBatcher>(strand_, channelMock_, nullptr);
+
+    EXPECT_CALL(*channelMock_, acquireAVMediaBuffer(4)).Times(2);
+    this->expectSend(100, common::Data(4, 1));
+    this->expectSend(200, common::Data(4, 2));
+
+    this->capture(*batcher, 100, 1);
+    this->capture(*batcher, 200, 2);
+
+    BOOST_TEST(batcher->getStatistics().sentMessages == 2u);
+}
+
+BOOST_FIXTURE_TEST_CASE(AVInputMediaBatcher_AggregatesPeriods, AVInputMediaBatcherUnitTest)
+{
+    auto batcher = std::make_shared<AVInputMediaBatcher>(strand_, channelMock_, nullptr, 3, std::chrono::milliseconds(100));
+
+    EXPECT_CALL(*channelMock_, acquireAVMediaBuffer(12)).Times(1);
+    this->expectSend(100, common::Data{1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3});
+
+    this->capture(*batcher, 100, 1);
+    this->capture(*batcher, 200, 2);
+    this->capture(*batcher, 300, 3);
+
+    const auto& statistics = batcher->getStatistics();
+    BOOST_TEST(statistics.capturedPeriods == 3u);
+    BOOST_TEST(statistics.sentMessages == 1u);
+    BOOST_TEST(statistics.sentBytes == 12u);
+}
+
+BOOST_FIXTURE_TEST_CASE(AVInputMediaBatcher_FlushesPartialMessageAfterBudget, AVInputMediaBatcherUnitTest)
+{
+    auto batcher = std::make_shared<AVInputMediaBatcher>(strand_, channelMock_, nullptr, 3, std::chrono::milliseconds(1));
+
+    this->expectSend(100, common::Data{5, 5, 5, 5});
+    this->capture(*batcher, 100, 5);
+
+    ioService_.run();
+    BOOST_TEST(batcher->getStatistics().sentMessages == 1u);
+}
+
+}
+}
+}
+}
+}
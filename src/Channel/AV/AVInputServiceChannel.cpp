@@ -16,6 +16,7 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <aasdk_proto/ControlMessageIdsEnum.pb.h>
 #include <aasdk_proto/AVChannelMessageIdsEnum.pb.h>
 #include <f1x/aasdk/Messenger/Timestamp.hpp>
@@ -32,15 +33,17 @@ namespace channel
 namespace av
 {
 
-AVInputServiceChannel::AVInputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::AV_INPUT)
+constexpr size_t IAVInputServiceChannel::cAVMediaHeaderSize;
+
+AVInputServiceChannel::AVInputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, io::DispatchMode dispatchMode)
+    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::AV_INPUT, dispatchMode)
 {
 
 }
 
 void AVInputServiceChannel::receive(IAVInputServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise = messenger::ReceivePromise::defer(strand_);
+    auto receivePromise = messenger::ReceivePromise::defer(strand_, dispatchMode_);
     receivePromise->then(std::bind(&AVInputServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
                         std::bind(&IAVInputServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
 
@@ -117,6 +120,56 @@ void AVInputServiceChannel::sendAVMediaWithTimestampIndication(messenger::Timest
     this->send(std::move(message), std::move(promise));
 }
 
+common::Data AVInputServiceChannel::acquireAVMediaBuffer(size_t capacity)
+{
+    common::Data buffer;
+
+    {
+        std::lock_guard<decltype(avMediaBufferPoolMutex_)> lock(avMediaBufferPoolMutex_);
+        if(!avMediaBufferPool_.empty())
+        {
+            buffer = std::move(avMediaBufferPool_.back());
+            avMediaBufferPool_.pop_back();
+        }
+    }
+
+    buffer.reserve(cAVMediaHeaderSize + capacity);
+    buffer.resize(cAVMediaHeaderSize);
+    return buffer;
+}
+
+void AVInputServiceChannel::sendAVMediaWithTimestampIndication(messenger::Timestamp::ValueType timestamp, common::Data&& buffer, SendPromise::Pointer promise)
+{
+    if(buffer.size() < cAVMediaHeaderSize)
+    {
+        buffer.insert(buffer.begin(), cAVMediaHeaderSize - buffer.size(), 0);
+    }
+
+    // same header bytes as the copying overload, written into the space reserved in front of the media
+    const auto messageIdData = messenger::MessageId(proto::ids::AVChannelMessage::AV_MEDIA_WITH_TIMESTAMP_INDICATION).getData();
+    const auto timestampData = messenger::Timestamp(timestamp).getData();
+    auto header = std::copy(messageIdData.begin(), messageIdData.end(), buffer.begin());
+    std::copy(timestampData.begin(), timestampData.end(), header);
+
+    auto message(std::make_shared<messenger::Message>(channelId_, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
+    message->getPayload() = std::move(buffer);
+
+    auto releaseBuffer = [this, self = this->shared_from_this(), message]() {
+        this->releaseAVMediaBuffer(std::move(message->getPayload()));
+    };
+    this->send(std::move(message), std::move(promise), std::move(releaseBuffer));
+}
+
+void AVInputServiceChannel::releaseAVMediaBuffer(common::Data buffer)
+{
+    std::lock_guard<decltype(avMediaBufferPoolMutex_)> lock(avMediaBufferPoolMutex_);
+    if(avMediaBufferPool_.size() < cMaxPooledAVMediaBuffers)
+    {
+        buffer.clear();
+        avMediaBufferPool_.push_back(std::move(buffer));
+    }
+}
+
 void AVInputServiceChannel::handleAVChannelSetupRequest(const common::DataConstBuffer& payload, IAVInputServiceChannelEventHandler::Pointer eventHandler)
 {
     proto::messages::AVChannelSetupRequest request;
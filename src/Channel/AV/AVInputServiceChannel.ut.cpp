@@ -0,0 +1,163 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <aasdk_proto/AVChannelMessageIdsEnum.pb.h>
+#include <f1x/aasdk/Messenger/UT/Messenger.mock.hpp>
+#include <f1x/aasdk/Messenger/UT/SendPromiseHandler.mock.hpp>
+#include <f1x/aasdk/Channel/AV/AVInputServiceChannel.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+namespace ut
+{
+
+using ::testing::DoAll;
+using ::testing::SaveArg;
+using ::testing::_;
+
+class AVInputServiceChannelUnitTest
+{
+protected:
+    AVInputServiceChannelUnitTest()
+        : strand_(ioService_)
+        , messenger_(&messengerMock_, [](auto*) {})
+        , channel_(std::make_shared<AVInputServiceChannel>(strand_, messenger_))
+    {
+
+    }
+
+    SendPromise::Pointer createSendPromise()
+    {
+        auto promise = SendPromise::defer(strand_);
+        promise->then(std::bind(&messenger::ut::SendPromiseHandlerMock::onResolve, &sendPromiseHandlerMock_),
+                      std::bind(&messenger::ut::SendPromiseHandlerMock::onReject, &sendPromiseHandlerMock_, std::placeholders::_1));
+        return promise;
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+    messenger::ut::MessengerMock messengerMock_;
+    messenger::IMessenger::Pointer messenger_;
+    messenger::ut::SendPromiseHandlerMock sendPromiseHandlerMock_;
+    std::shared_ptr<AVInputServiceChannel> channel_;
+};
+
+BOOST_FIXTURE_TEST_CASE(AVInputServiceChannel_AcquiredBufferSerializesLikeCopyingSend, AVInputServiceChannelUnitTest)
+{
+    const common::Data media{0x10, 0x20, 0x30, 0x40};
+    const messenger::Timestamp::ValueType timestamp = 0x0102030405060708;
+
+    auto buffer = channel_->acquireAVMediaBuffer(media.size());
+    BOOST_TEST(buffer.size() == IAVInputServiceChannel::cAVMediaHeaderSize);
+    BOOST_TEST(buffer.capacity() >= IAVInputServiceChannel::cAVMediaHeaderSize + media.size());
+    buffer.insert(buffer.end(), media.begin(), media.end());
+
+    messenger::Message::Pointer zeroCopyMessage;
+    EXPECT_CALL(messengerMock_, enqueueSend(_, _)).WillOnce(SaveArg<0>(&zeroCopyMessage));
+    channel_->sendAVMediaWithTimestampIndication(timestamp, std::move(buffer), this->createSendPromise());
+
+    messenger::Message::Pointer copiedMessage;
+    EXPECT_CALL(messengerMock_, enqueueSend(_, _)).WillOnce(SaveArg<0>(&copiedMessage));
+    channel_->sendAVMediaWithTimestampIndication(timestamp, media, this->createSendPromise());
+
+    common::Data expectedPayload(messenger::MessageId(proto::ids::AVChannelMessage::AV_MEDIA_WITH_TIMESTAMP_INDICATION).getData());
+    const auto timestampData = messenger::Timestamp(timestamp).getData();
+    expectedPayload.insert(expectedPayload.end(), timestampData.begin(), timestampData.end());
+    expectedPayload.insert(expectedPayload.end(), media.begin(), media.end());
+
+    BOOST_TEST(zeroCopyMessage->getPayload() == expectedPayload, boost::test_tools::per_element());
+    BOOST_TEST(copiedMessage->getPayload() == expectedPayload, boost::test_tools::per_element());
+    BOOST_CHECK(zeroCopyMessage->getChannelId() == messenger::ChannelId::AV_INPUT);
+    BOOST_CHECK(zeroCopyMessage->getEncryptionType() == messenger::EncryptionType::ENCRYPTED);
+}
+
+BOOST_FIXTURE_TEST_CASE(AVInputServiceChannel_SentBufferReturnsToPool, AVInputServiceChannelUnitTest)
+{
+    messenger::Message::Pointer message;
+    messenger::SendPromise::Pointer messengerPromise;
+    EXPECT_CALL(messengerMock_, enqueueSend(_, _)).WillOnce(DoAll(SaveArg<0>(&message), SaveArg<1>(&messengerPromise)));
+
+    auto buffer = channel_->acquireAVMediaBuffer(1024);
+    buffer.resize(buffer.size() + 1024, 0x5E);
+    const auto* storage = buffer.data();
+    channel_->sendAVMediaWithTimestampIndication(1, std::move(buffer), this->createSendPromise());
+
+    // the media is handed to the messenger without a copy
+    BOOST_TEST((message->getPayload().data() == storage));
+    message.reset();
+
+    EXPECT_CALL(sendPromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve());
+    messengerPromise->resolve();
+    ioService_.run();
+
+    auto reusedBuffer = channel_->acquireAVMediaBuffer(16);
+    BOOST_TEST((reusedBuffer.data() == storage));
+    BOOST_TEST(reusedBuffer.size() == IAVInputServiceChannel::cAVMediaHeaderSize);
+}
+
+BOOST_FIXTURE_TEST_CASE(AVInputServiceChannel_PoolKeepsAtMostEightBuffers, AVInputServiceChannelUnitTest)
+{
+    const size_t bufferCount = 10;
+    std::vector<messenger::SendPromise::Pointer> messengerPromises(bufferCount);
+    std::vector<const uint8_t*> storages;
+
+    for(size_t i = 0; i < bufferCount; ++i)
+    {
+        EXPECT_CALL(messengerMock_, enqueueSend(_, _)).WillOnce(SaveArg<1>(&messengerPromises[i])).RetiresOnSaturation();
+
+        auto buffer = channel_->acquireAVMediaBuffer(4096);
+        storages.push_back(buffer.data());
+        channel_->sendAVMediaWithTimestampIndication(i, std::move(buffer), this->createSendPromise());
+    }
+
+    // a failed send hands its buffer back as well
+    const error::Error e(error::ErrorCode::USB_TRANSFER, 4);
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve()).Times(bufferCount - 1);
+    EXPECT_CALL(sendPromiseHandlerMock_, onReject(e));
+    messengerPromises[0]->reject(e);
+    for(size_t i = 1; i < bufferCount; ++i)
+    {
+        messengerPromises[i]->resolve();
+    }
+    ioService_.run();
+
+    size_t reused = 0;
+    std::vector<common::Data> buffers;
+    for(size_t i = 0; i < bufferCount; ++i)
+    {
+        buffers.push_back(channel_->acquireAVMediaBuffer(16));
+        reused += std::count(storages.begin(), storages.end(), buffers.back().data());
+    }
+
+    BOOST_TEST(reused == 8u);
+}
+
+}
+}
+}
+}
+}
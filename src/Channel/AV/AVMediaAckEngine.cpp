@@ -0,0 +1,144 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <f1x/aasdk/Common/Log.hpp>
+#include <f1x/aasdk/Channel/AV/AVMediaAckEngine.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+AVMediaAckEngine::AVMediaAckEngine(boost::asio::io_service::strand& strand, AckSender ackSender, size_t lowWatermark)
+    : strand_(strand)
+    , ackSender_(std::move(ackSender))
+    , lowWatermark_(lowWatermark)
+    , session_(0)
+    , pendingAcks_(0)
+    , stalled_(false)
+    , inFlightSum_(0)
+{
+
+}
+
+void AVMediaAckEngine::onAVChannelSetupResponse(const proto::messages::AVChannelSetupResponse& response)
+{
+    statistics_.maxUnacked = response.max_unacked();
+}
+
+void AVMediaAckEngine::onAVChannelStartIndication(const proto::messages::AVChannelStartIndication& indication)
+{
+    session_ = indication.session();
+}
+
+void AVMediaAckEngine::onAVChannelStopIndication(Clock::time_point now)
+{
+    // the phone drops its window on stop, nothing buffered here needs an ack anymore
+    if(stalled_)
+    {
+        statistics_.stallTime += std::chrono::duration_cast<std::chrono::microseconds>(now - stallStart_);
+        stalled_ = false;
+    }
+
+    pendingAcks_ = 0;
+    statistics_.inFlightFrames = 0;
+}
+
+void AVMediaAckEngine::onMediaReceived(Clock::time_point now)
+{
+    ++statistics_.receivedFrames;
+    ++statistics_.inFlightFrames;
+    statistics_.maxInFlightFrames = std::max(statistics_.maxInFlightFrames, statistics_.inFlightFrames);
+
+    inFlightSum_ += statistics_.inFlightFrames;
+    statistics_.averageInFlightFrames = inFlightSum_ / statistics_.receivedFrames;
+
+    if(!stalled_ && this->isWindowFull())
+    {
+        stalled_ = true;
+        stallStart_ = now;
+        ++statistics_.stallCount;
+    }
+}
+
+void AVMediaAckEngine::onMediaConsumed(size_t count, Clock::time_point now)
+{
+    pendingAcks_ = std::min(pendingAcks_ + count, statistics_.inFlightFrames);
+    const size_t bufferedFrames = statistics_.inFlightFrames - pendingAcks_;
+
+    if(pendingAcks_ >= this->getMaxBatchSize() || bufferedFrames <= lowWatermark_ || this->isWindowFull())
+    {
+        this->flush(now);
+    }
+}
+
+void AVMediaAckEngine::flush(Clock::time_point now)
+{
+    if(pendingAcks_ == 0)
+    {
+        return;
+    }
+
+    proto::messages::AVMediaAckIndication indication;
+    indication.set_session(session_);
+    indication.set_value(static_cast<uint32_t>(pendingAcks_));
+
+    statistics_.inFlightFrames -= pendingAcks_;
+    statistics_.ackedFrames += pendingAcks_;
+    ++statistics_.ackIndications;
+    pendingAcks_ = 0;
+
+    if(stalled_ && !this->isWindowFull())
+    {
+        statistics_.stallTime += std::chrono::duration_cast<std::chrono::microseconds>(now - stallStart_);
+        stalled_ = false;
+    }
+
+    auto promise = SendPromise::defer(strand_);
+    promise->then([]() {}, [](const error::Error& e) {
+        AASDK_LOG(error) << "[AVMediaAckEngine] ack indication failed: " << e.what();
+    });
+
+    ackSender_(indication, std::move(promise));
+}
+
+AVMediaAckStatistics AVMediaAckEngine::getStatistics() const
+{
+    return statistics_;
+}
+
+bool AVMediaAckEngine::isWindowFull() const
+{
+    return statistics_.maxUnacked > 0 && statistics_.inFlightFrames >= statistics_.maxUnacked;
+}
+
+size_t AVMediaAckEngine::getMaxBatchSize() const
+{
+    // keep at least half of the window open for the phone
+    return std::max<size_t>(1, statistics_.maxUnacked / 2);
+}
+
+}
+}
+}
+}
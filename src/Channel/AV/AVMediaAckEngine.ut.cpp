@@ -0,0 +1,143 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Channel/AV/AVMediaAckEngine.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+namespace ut
+{
+
+class AVMediaAckEngineUnitTest
+{
+protected:
+    AVMediaAckEngineUnitTest()
+        : strand_(ioService_)
+        , ackEngine_(strand_, [this](const proto::messages::AVMediaAckIndication& indication, SendPromise::Pointer) { indications_.push_back(indication); })
+    {
+        proto::messages::AVChannelStartIndication startIndication;
+        startIndication.set_session(3);
+        startIndication.set_config(0);
+        ackEngine_.onAVChannelStartIndication(startIndication);
+    }
+
+    void setMaxUnacked(uint32_t maxUnacked)
+    {
+        proto::messages::AVChannelSetupResponse response;
+        response.set_max_unacked(maxUnacked);
+        ackEngine_.onAVChannelSetupResponse(response);
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+    std::vector<proto::messages::AVMediaAckIndication> indications_;
+    AVMediaAckEngine ackEngine_;
+};
+
+BOOST_FIXTURE_TEST_CASE(AVMediaAckEngine_AcksEveryFrameWithoutWindow, AVMediaAckEngineUnitTest)
+{
+    ackEngine_.onMediaReceived();
+    ackEngine_.onMediaReceived();
+    ackEngine_.onMediaConsumed();
+    ackEngine_.onMediaConsumed();
+
+    BOOST_TEST(indications_.size() == 2);
+    BOOST_TEST(indications_[0].session() == 3);
+    BOOST_TEST(indications_[0].value() == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(AVMediaAckEngine_NoAckBeforeConsumption, AVMediaAckEngineUnitTest)
+{
+    this->setMaxUnacked(8);
+
+    for(size_t i = 0; i < 4; ++i)
+    {
+        ackEngine_.onMediaReceived();
+    }
+
+    BOOST_TEST(indications_.empty());
+    BOOST_TEST(ackEngine_.getStatistics().inFlightFrames == 4u);
+}
+
+BOOST_FIXTURE_TEST_CASE(AVMediaAckEngine_CoalescesUntilBufferRunsLow, AVMediaAckEngineUnitTest)
+{
+    this->setMaxUnacked(8);
+
+    for(size_t i = 0; i < 4; ++i)
+    {
+        ackEngine_.onMediaReceived();
+    }
+
+    ackEngine_.onMediaConsumed();
+    ackEngine_.onMediaConsumed();
+    BOOST_TEST(indications_.empty());
+
+    ackEngine_.onMediaConsumed();
+    BOOST_TEST(indications_.size() == 1);
+    BOOST_TEST(indications_[0].value() == 3u);
+
+    const auto statistics = ackEngine_.getStatistics();
+    BOOST_TEST(statistics.inFlightFrames == 1u);
+    BOOST_TEST(statistics.ackedFrames == 3u);
+    BOOST_TEST(statistics.ackIndications == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(AVMediaAckEngine_BatchLimitedToHalfWindow, AVMediaAckEngineUnitTest)
+{
+    this->setMaxUnacked(8);
+
+    for(size_t i = 0; i < 7; ++i)
+    {
+        ackEngine_.onMediaReceived();
+    }
+
+    ackEngine_.onMediaConsumed(4);
+    BOOST_TEST(indications_.size() == 1);
+    BOOST_TEST(indications_[0].value() == 4u);
+}
+
+BOOST_FIXTURE_TEST_CASE(AVMediaAckEngine_MeasuresStallTime, AVMediaAckEngineUnitTest)
+{
+    this->setMaxUnacked(2);
+
+    const auto start = AVMediaAckEngine::Clock::now();
+    ackEngine_.onMediaReceived(start);
+    ackEngine_.onMediaReceived(start);
+
+    ackEngine_.onMediaConsumed(1, start + std::chrono::milliseconds(15));
+    BOOST_TEST(indications_.size() == 1);
+
+    const auto statistics = ackEngine_.getStatistics();
+    BOOST_TEST(statistics.stallCount == 1u);
+    BOOST_TEST(statistics.stallTime.count() == 15000);
+    BOOST_TEST(statistics.maxInFlightFrames == 2u);
+    BOOST_TEST(statistics.averageInFlightFrames == 1.5);
+}
+
+}
+}
+}
+}
+}
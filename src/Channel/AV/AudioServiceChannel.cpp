@@ -31,15 +31,15 @@ namespace channel
 namespace av
 {
 
-AudioServiceChannel::AudioServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, messenger::ChannelId channelId)
-    : ServiceChannel(strand, std::move(messenger), channelId)
+AudioServiceChannel::AudioServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, messenger::ChannelId channelId, io::DispatchMode dispatchMode)
+    : ServiceChannel(strand, std::move(messenger), channelId, dispatchMode)
 {
 
 }
 
 void AudioServiceChannel::receive(IAudioServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise = messenger::ReceivePromise::defer(strand_);
+    auto receivePromise = messenger::ReceivePromise::defer(strand_, dispatchMode_);
     receivePromise->then(std::bind(&AudioServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
                         std::bind(&IAudioServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
 
@@ -0,0 +1,209 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <f1x/aasdk/Channel/AV/H264PayloadParser.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+namespace
+{
+
+const uint8_t* findStartCodeScalar(const uint8_t* begin, const uint8_t* end)
+{
+    for(auto it = begin; it + 2 < end; ++it)
+    {
+        if(it[2] > 1)
+        {
+            // neither it[2] nor anything before it can complete a start code
+            it += 2;
+        }
+        else if(it[0] == 0 && it[1] == 0 && it[2] == 1)
+        {
+            return it;
+        }
+    }
+
+    return end;
+}
+
+}
+
+H264PayloadParser::H264PayloadParser()
+{
+
+}
+
+const uint8_t* H264PayloadParser::findStartCode(const uint8_t* begin, const uint8_t* end)
+{
+    auto it = begin;
+
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi8(1);
+
+    // compare 16 candidate positions at once: byte[i] == 0, byte[i + 1] == 0, byte[i + 2] == 1
+    for(; it + 18 <= end; it += 16)
+    {
+        const __m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it));
+        const __m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 1));
+        const __m128i third = _mm_loadu_si128(reinterpret_cast<const __m128i*>(it + 2));
+
+        const __m128i match = _mm_and_si128(_mm_and_si128(_mm_cmpeq_epi8(first, zero), _mm_cmpeq_epi8(second, zero)),
+                                            _mm_cmpeq_epi8(third, one));
+        const int mask = _mm_movemask_epi8(match);
+
+        if(mask != 0)
+        {
+            return it + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+    const uint8x16_t zero = vdupq_n_u8(0);
+    const uint8x16_t one = vdupq_n_u8(1);
+
+    for(; it + 18 <= end; it += 16)
+    {
+        const uint8x16_t match = vandq_u8(vandq_u8(vceqq_u8(vld1q_u8(it), zero), vceqq_u8(vld1q_u8(it + 1), zero)),
+                                          vceqq_u8(vld1q_u8(it + 2), one));
+        const uint8x8_t folded = vorr_u8(vget_low_u8(match), vget_high_u8(match));
+
+        if(vget_lane_u64(vreinterpret_u64_u8(folded), 0) != 0)
+        {
+            return findStartCodeScalar(it, it + 18);
+        }
+    }
+#endif
+
+    return findStartCodeScalar(it, end);
+}
+
+size_t H264PayloadParser::parse(const common::DataConstBuffer& payload, H264NALUnits& units)
+{
+    const uint8_t* const end = payload.cdata + payload.size;
+    const uint8_t* startCode = findStartCode(payload.cdata, end);
+    size_t count = 0;
+
+    while(startCode != end)
+    {
+        const uint8_t* unitBegin = startCode + 3;
+        const uint8_t* nextStartCode = findStartCode(unitBegin, end);
+        const uint8_t* unitEnd = nextStartCode;
+
+        // drop trailing_zero_8bits and the leading zero of a 4-byte start code
+        while(unitEnd > unitBegin && unitEnd[-1] == 0)
+        {
+            --unitEnd;
+        }
+
+        if(unitEnd > unitBegin)
+        {
+            H264NALUnit unit;
+            unit.type = static_cast<H264NALUnitType>(unitBegin[0] & 0x1F);
+            unit.referenceIndication = (unitBegin[0] >> 5) & 0x03;
+            unit.data = common::DataConstBuffer(unitBegin, unitEnd - unitBegin);
+
+            this->cacheParameterSet(unit);
+            units.push_back(unit);
+            ++count;
+        }
+
+        startCode = nextStartCode;
+    }
+
+    return count;
+}
+
+H264NALUnits H264PayloadParser::parse(const common::DataConstBuffer& payload)
+{
+    H264NALUnits units;
+    this->parse(payload, units);
+    return units;
+}
+
+bool H264PayloadParser::hasParameterSets() const
+{
+    return !sps_.empty() && !pps_.empty();
+}
+
+const common::Data& H264PayloadParser::getSPS() const
+{
+    return sps_;
+}
+
+const common::Data& H264PayloadParser::getPPS() const
+{
+    return pps_;
+}
+
+common::Data H264PayloadParser::getParameterSets() const
+{
+    static const uint8_t startCode[] = {0x00, 0x00, 0x00, 0x01};
+
+    common::Data data;
+    data.reserve(sizeof(startCode) * 2 + sps_.size() + pps_.size());
+
+    if(!sps_.empty())
+    {
+        data.insert(data.end(), std::begin(startCode), std::end(startCode));
+        data.insert(data.end(), sps_.begin(), sps_.end());
+    }
+
+    if(!pps_.empty())
+    {
+        data.insert(data.end(), std::begin(startCode), std::end(startCode));
+        data.insert(data.end(), pps_.begin(), pps_.end());
+    }
+
+    return data;
+}
+
+void H264PayloadParser::reset()
+{
+    sps_.clear();
+    pps_.clear();
+}
+
+void H264PayloadParser::cacheParameterSet(const H264NALUnit& unit)
+{
+    if(unit.type == H264NALUnitType::SPS)
+    {
+        sps_.assign(unit.data.cdata, unit.data.cdata + unit.data.size);
+    }
+    else if(unit.type == H264NALUnitType::PPS)
+    {
+        pps_.assign(unit.data.cdata, unit.data.cdata + unit.data.size);
+    }
+}
+
+}
+}
+}
+}
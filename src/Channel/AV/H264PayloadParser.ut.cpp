@@ -0,0 +1,130 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <random>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Channel/AV/H264PayloadParser.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(H264PayloadParser_SplitsNALUnits)
+{
+    const common::Data payload = {
+        0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0x00, 0x1F,
+        0x00, 0x00, 0x00, 0x01, 0x68, 0xCE, 0x3C, 0x80,
+        0x00, 0x00, 0x01, 0x65, 0x88, 0x84, 0x00, 0x00
+    };
+
+    H264PayloadParser parser;
+    auto units = parser.parse(common::DataConstBuffer(payload));
+
+    BOOST_TEST(units.size() == 3);
+    BOOST_TEST((units[0].type == H264NALUnitType::SPS));
+    BOOST_TEST(units[0].data.size == 4);
+    BOOST_TEST(units[0].data.cdata == &payload[4]);
+    BOOST_TEST((units[1].type == H264NALUnitType::PPS));
+    BOOST_TEST(units[1].data.size == 4);
+    BOOST_TEST((units[2].type == H264NALUnitType::IDR_SLICE));
+    BOOST_TEST(units[2].referenceIndication == 3);
+    // trailing zero bytes do not belong to the slice
+    BOOST_TEST(units[2].data.size == 3);
+}
+
+BOOST_AUTO_TEST_CASE(H264PayloadParser_CachesParameterSets)
+{
+    const common::Data payload = {
+        0x00, 0x00, 0x01, 0x67, 0x42, 0x00, 0x1F,
+        0x00, 0x00, 0x01, 0x68, 0xCE, 0x3C, 0x80,
+        0x00, 0x00, 0x01, 0x41, 0x9A
+    };
+
+    H264PayloadParser parser;
+    BOOST_TEST(!parser.hasParameterSets());
+
+    parser.parse(common::DataConstBuffer(payload));
+    BOOST_TEST(parser.hasParameterSets());
+    BOOST_TEST((parser.getSPS() == common::Data{0x67, 0x42, 0x00, 0x1F}));
+    BOOST_TEST((parser.getPPS() == common::Data{0x68, 0xCE, 0x3C, 0x80}));
+
+    const common::Data expectedParameterSets = {0x00, 0x00, 0x00, 0x01, 0x67, 0x42, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x01, 0x68, 0xCE, 0x3C, 0x80};
+    BOOST_TEST((parser.getParameterSets() == expectedParameterSets));
+
+    // parameter sets survive payloads that carry slices only
+    const common::Data slice = {0x00, 0x00, 0x01, 0x41, 0x9B};
+    parser.parse(common::DataConstBuffer(slice));
+    BOOST_TEST((parser.getSPS() == common::Data{0x67, 0x42, 0x00, 0x1F}));
+
+    parser.reset();
+    BOOST_TEST(!parser.hasParameterSets());
+}
+
+BOOST_AUTO_TEST_CASE(H264PayloadParser_VectorSearchMatchesScalarSearch)
+{
+    std::mt19937 generator(42);
+    std::uniform_int_distribution<int> distribution(0, 3);
+
+    common::Data data(4096);
+    for(auto& byte : data)
+    {
+        // small alphabet so start codes show up at every alignment
+        byte = static_cast<uint8_t>(distribution(generator));
+    }
+
+    const uint8_t* begin = data.data();
+    const uint8_t* end = data.data() + data.size();
+
+    for(auto it = begin; it != end;)
+    {
+        const uint8_t* expected = end;
+        for(auto candidate = it; candidate + 2 < end; ++candidate)
+        {
+            if(candidate[0] == 0 && candidate[1] == 0 && candidate[2] == 1)
+            {
+                expected = candidate;
+                break;
+            }
+        }
+
+        const uint8_t* found = H264PayloadParser::findStartCode(it, end);
+        BOOST_REQUIRE(found == expected);
+        it = found == end ? end : found + 1;
+    }
+}
+
+BOOST_AUTO_TEST_CASE(H264PayloadParser_NoStartCode)
+{
+    const common::Data payload(100, 0x05);
+
+    H264PayloadParser parser;
+    BOOST_TEST(parser.parse(common::DataConstBuffer(payload)).empty());
+}
+
+}
+}
+}
+}
+}
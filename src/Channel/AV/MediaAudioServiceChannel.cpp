@@ -27,8 +27,8 @@ namespace channel
 namespace av
 {
 
-MediaAudioServiceChannel::MediaAudioServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : AudioServiceChannel(strand, std::move(messenger), messenger::ChannelId::MEDIA_AUDIO)
+MediaAudioServiceChannel::MediaAudioServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, io::DispatchMode dispatchMode)
+    : AudioServiceChannel(strand, std::move(messenger), messenger::ChannelId::MEDIA_AUDIO, dispatchMode)
 {
 
 }
@@ -0,0 +1,191 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <f1x/aasdk/Channel/AV/PCMRingBuffer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+constexpr std::chrono::milliseconds PCMRingBuffer::cDefaultCapacity;
+constexpr std::chrono::milliseconds PCMRingBuffer::cDefaultTargetFill;
+
+PCMRingBuffer::PCMRingBuffer(const proto::data::AudioConfig& audioConfig, std::chrono::milliseconds capacity, std::chrono::milliseconds targetFill)
+    : frameSize_(std::max<size_t>(1, audioConfig.bit_depth() / 8 * audioConfig.channel_count()))
+    , capacity_(std::max<size_t>(1, static_cast<uint64_t>(audioConfig.sample_rate()) * capacity.count() / 1000) * frameSize_)
+    , targetFill_(std::min<size_t>(static_cast<uint64_t>(audioConfig.sample_rate()) * targetFill.count() / 1000, capacity_ / frameSize_))
+    , storage_(new common::Data::value_type[capacity_])
+    , writeOffset_(0)
+    , overruns_(0)
+    , droppedFrames_(0)
+    , readOffset_(0)
+    , underruns_(0)
+    , skippedFrames_(0)
+    , repeatedFrames_(0)
+    , primed_(false)
+    , smoothedFill_(0)
+{
+
+}
+
+size_t PCMRingBuffer::write(const common::DataConstBuffer& buffer)
+{
+    const size_t size = buffer.size - buffer.size % frameSize_;
+    const auto writeOffset = writeOffset_.load(std::memory_order_relaxed);
+    const auto readOffset = readOffset_.load(std::memory_order_acquire);
+    const size_t space = capacity_ - static_cast<size_t>(writeOffset - readOffset);
+    const size_t count = std::min(size, space);
+
+    if(count < size)
+    {
+        overruns_.fetch_add(1, std::memory_order_relaxed);
+        droppedFrames_.fetch_add((size - count) / frameSize_, std::memory_order_relaxed);
+    }
+
+    if(count == 0)
+    {
+        return 0;
+    }
+
+    const size_t position = writeOffset % capacity_;
+    const size_t head = std::min(count, capacity_ - position);
+    std::memcpy(&storage_[position], buffer.cdata, head);
+    std::memcpy(&storage_[0], buffer.cdata + head, count - head);
+
+    writeOffset_.store(writeOffset + count, std::memory_order_release);
+    return count;
+}
+
+size_t PCMRingBuffer::read(common::Data::value_type* output, size_t frames)
+{
+    const size_t requested = frames * frameSize_;
+    const auto readOffset = readOffset_.load(std::memory_order_relaxed);
+    const auto writeOffset = writeOffset_.load(std::memory_order_acquire);
+    const size_t available = static_cast<size_t>(writeOffset - readOffset);
+    const size_t fill = available / frameSize_;
+
+    if(!primed_)
+    {
+        if(fill < std::max<size_t>(targetFill_, 1))
+        {
+            std::memset(output, 0, requested);
+            return 0;
+        }
+
+        primed_ = true;
+        smoothedFill_ = fill;
+    }
+
+    smoothedFill_ += (static_cast<double>(fill) - smoothedFill_) * cFillSmoothing;
+
+    if(available < requested)
+    {
+        this->copyOut(output, readOffset, available);
+        std::memset(output + available, 0, requested - available);
+        readOffset_.store(readOffset + available, std::memory_order_release);
+        underruns_.fetch_add(1, std::memory_order_relaxed);
+        primed_ = false;
+        return fill;
+    }
+
+    const double band = targetFill_ / 4.0;
+    size_t consumed = requested;
+
+    if(smoothedFill_ > targetFill_ + band && available >= requested + frameSize_)
+    {
+        this->copyOut(output, readOffset, requested);
+        consumed += frameSize_;
+        skippedFrames_.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if(smoothedFill_ < targetFill_ - band && frames > 1)
+    {
+        consumed -= frameSize_;
+        this->copyOut(output, readOffset, consumed);
+        std::memcpy(output + consumed, output + consumed - frameSize_, frameSize_);
+        repeatedFrames_.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        this->copyOut(output, readOffset, requested);
+    }
+
+    readOffset_.store(readOffset + consumed, std::memory_order_release);
+    return consumed / frameSize_;
+}
+
+void PCMRingBuffer::reset()
+{
+    writeOffset_ = 0;
+    readOffset_ = 0;
+    primed_ = false;
+    smoothedFill_ = 0;
+}
+
+size_t PCMRingBuffer::getFrameSize() const
+{
+    return frameSize_;
+}
+
+size_t PCMRingBuffer::getCapacityFrames() const
+{
+    return capacity_ / frameSize_;
+}
+
+size_t PCMRingBuffer::getTargetFillFrames() const
+{
+    return targetFill_;
+}
+
+size_t PCMRingBuffer::getFillFrames() const
+{
+    const auto readOffset = readOffset_.load(std::memory_order_acquire);
+    const auto writeOffset = writeOffset_.load(std::memory_order_acquire);
+    return static_cast<size_t>(writeOffset - readOffset) / frameSize_;
+}
+
+PCMRingBufferStatistics PCMRingBuffer::getStatistics() const
+{
+    PCMRingBufferStatistics statistics;
+    statistics.underruns = underruns_.load(std::memory_order_relaxed);
+    statistics.overruns = overruns_.load(std::memory_order_relaxed);
+    statistics.droppedFrames = droppedFrames_.load(std::memory_order_relaxed);
+    statistics.skippedFrames = skippedFrames_.load(std::memory_order_relaxed);
+    statistics.repeatedFrames = repeatedFrames_.load(std::memory_order_relaxed);
+    statistics.fillFrames = this->getFillFrames();
+    return statistics;
+}
+
+void PCMRingBuffer::copyOut(common::Data::value_type* output, size_t offset, size_t size) const
+{
+    const size_t position = offset % capacity_;
+    const size_t head = std::min(size, capacity_ - position);
+    std::memcpy(output, &storage_[position], head);
+    std::memcpy(output + head, &storage_[0], size - head);
+}
+
+}
+}
+}
+}
@@ -0,0 +1,165 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Channel/AV/PCMRingBuffer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+namespace ut
+{
+
+class PCMRingBufferUnitTest
+{
+protected:
+    PCMRingBufferUnitTest()
+    {
+        // 1000 frames per second of 16-bit mono, i.e. one frame per millisecond
+        audioConfig_.set_sample_rate(1000);
+        audioConfig_.set_bit_depth(16);
+        audioConfig_.set_channel_count(1);
+    }
+
+    static common::Data frames(size_t count, uint8_t firstValue)
+    {
+        common::Data data;
+
+        for(size_t i = 0; i < count; ++i)
+        {
+            data.push_back(static_cast<uint8_t>(firstValue + i));
+            data.push_back(0);
+        }
+
+        return data;
+    }
+
+    proto::data::AudioConfig audioConfig_;
+};
+
+BOOST_FIXTURE_TEST_CASE(PCMRingBuffer_SizedFromAudioConfig, PCMRingBufferUnitTest)
+{
+    PCMRingBuffer ringBuffer(audioConfig_, std::chrono::milliseconds(100), std::chrono::milliseconds(40));
+
+    BOOST_TEST(ringBuffer.getFrameSize() == 2u);
+    BOOST_TEST(ringBuffer.getCapacityFrames() == 100u);
+    BOOST_TEST(ringBuffer.getTargetFillFrames() == 40u);
+}
+
+BOOST_FIXTURE_TEST_CASE(PCMRingBuffer_PlaysSilenceUntilPrimed, PCMRingBufferUnitTest)
+{
+    PCMRingBuffer ringBuffer(audioConfig_, std::chrono::milliseconds(100), std::chrono::milliseconds(4));
+    common::Data output(8, 0xFF);
+
+    const auto data = frames(3, 1);
+    ringBuffer.write(common::DataConstBuffer(data));
+    BOOST_TEST(ringBuffer.read(output.data(), 4) == 0u);
+    BOOST_TEST(output == common::Data(8, 0), boost::test_tools::per_element());
+    BOOST_TEST(ringBuffer.getStatistics().underruns == 0u);
+
+    const auto more = frames(1, 4);
+    ringBuffer.write(common::DataConstBuffer(more));
+    BOOST_TEST(ringBuffer.read(output.data(), 4) == 4u);
+    BOOST_TEST(output == frames(4, 1), boost::test_tools::per_element());
+}
+
+BOOST_FIXTURE_TEST_CASE(PCMRingBuffer_CountsOverrun, PCMRingBufferUnitTest)
+{
+    PCMRingBuffer ringBuffer(audioConfig_, std::chrono::milliseconds(10), std::chrono::milliseconds(5));
+
+    const auto data = frames(8, 1);
+    BOOST_TEST(ringBuffer.write(common::DataConstBuffer(data)) == 16u);
+    BOOST_TEST(ringBuffer.write(common::DataConstBuffer(data)) == 4u);
+
+    const auto statistics = ringBuffer.getStatistics();
+    BOOST_TEST(statistics.overruns == 1u);
+    BOOST_TEST(statistics.droppedFrames == 6u);
+    BOOST_TEST(statistics.fillFrames == 10u);
+}
+
+BOOST_FIXTURE_TEST_CASE(PCMRingBuffer_CountsUnderrunAndWrapsAround, PCMRingBufferUnitTest)
+{
+    PCMRingBuffer ringBuffer(audioConfig_, std::chrono::milliseconds(10), std::chrono::milliseconds(8));
+    common::Data output(12);
+
+    const auto first = frames(8, 1);
+    ringBuffer.write(common::DataConstBuffer(first));
+    BOOST_TEST(ringBuffer.read(output.data(), 4) == 4u);
+
+    const auto second = frames(4, 9);
+    ringBuffer.write(common::DataConstBuffer(second));
+    BOOST_TEST(ringBuffer.read(output.data(), 6) == 6u);
+    BOOST_TEST(common::Data(output.begin(), output.begin() + 12) == frames(6, 5), boost::test_tools::per_element());
+
+    BOOST_TEST(ringBuffer.read(output.data(), 4) == 2u);
+    BOOST_TEST(common::Data(output.begin(), output.begin() + 8) == (common::Data{11, 0, 12, 0, 0, 0, 0, 0}), boost::test_tools::per_element());
+    BOOST_TEST(ringBuffer.getStatistics().underruns == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(PCMRingBuffer_SkipsFramesWhenProducerRunsFast, PCMRingBufferUnitTest)
+{
+    PCMRingBuffer ringBuffer(audioConfig_, std::chrono::milliseconds(200), std::chrono::milliseconds(40));
+    common::Data output(20);
+
+    // producer keeps 11 frames per 10 consumed, the fill level climbs above the band
+    for(uint8_t i = 0; i < 100; ++i)
+    {
+        const auto data = frames(11, i);
+        ringBuffer.write(common::DataConstBuffer(data));
+        ringBuffer.read(output.data(), 10);
+    }
+
+    const auto statistics = ringBuffer.getStatistics();
+    BOOST_TEST(statistics.skippedFrames > 0u);
+    BOOST_TEST(statistics.repeatedFrames == 0u);
+    BOOST_TEST(statistics.overruns == 0u);
+    BOOST_TEST(statistics.fillFrames < 60u);
+}
+
+BOOST_FIXTURE_TEST_CASE(PCMRingBuffer_RepeatsFramesWhenProducerRunsSlow, PCMRingBufferUnitTest)
+{
+    PCMRingBuffer ringBuffer(audioConfig_, std::chrono::milliseconds(200), std::chrono::milliseconds(40));
+    common::Data output(20);
+
+    const auto preroll = frames(40, 0);
+    ringBuffer.write(common::DataConstBuffer(preroll));
+
+    // producer delivers 9 frames per 10 consumed
+    for(uint8_t i = 0; i < 100; ++i)
+    {
+        const auto data = frames(9, i);
+        ringBuffer.write(common::DataConstBuffer(data));
+        ringBuffer.read(output.data(), 10);
+    }
+
+    const auto statistics = ringBuffer.getStatistics();
+    BOOST_TEST(statistics.repeatedFrames > 0u);
+    BOOST_TEST(statistics.skippedFrames == 0u);
+    BOOST_TEST(statistics.underruns == 0u);
+}
+
+}
+}
+}
+}
+}
@@ -27,8 +27,8 @@ namespace channel
 namespace av
 {
 
-SpeechAudioServiceChannel::SpeechAudioServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : AudioServiceChannel(strand, std::move(messenger), messenger::ChannelId::SPEECH_AUDIO)
+SpeechAudioServiceChannel::SpeechAudioServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, io::DispatchMode dispatchMode)
+    : AudioServiceChannel(strand, std::move(messenger), messenger::ChannelId::SPEECH_AUDIO, dispatchMode)
 {
 
 }
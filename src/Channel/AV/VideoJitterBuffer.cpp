@@ -0,0 +1,144 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Channel/AV/VideoJitterBuffer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+constexpr std::chrono::microseconds VideoJitterBuffer::cDefaultLatencyBudget;
+
+VideoJitterBuffer::VideoJitterBuffer(std::chrono::microseconds latencyBudget)
+    : latencyBudget_(latencyBudget)
+    , anchored_(false)
+    , offset_(0)
+    , delivered_(false)
+    , lastDeliveredTimestamp_(0)
+{
+
+}
+
+bool VideoJitterBuffer::push(messenger::Timestamp::ValueType timestamp, bool reference, common::Data data, Clock::time_point now)
+{
+    ++statistics_.receivedFrames;
+
+    const Clock::duration offset = now.time_since_epoch() - std::chrono::microseconds(timestamp);
+    if(!anchored_ || offset < offset_)
+    {
+        offset_ = offset;
+        anchored_ = true;
+    }
+
+    const auto presentationTime = this->getPresentationTime(timestamp);
+    const bool behindDelivered = delivered_ && timestamp < lastDeliveredTimestamp_;
+
+    if(now > presentationTime || behindDelivered)
+    {
+        const auto lateness = now > presentationTime ? now - presentationTime : Clock::duration(0);
+
+        if(!reference)
+        {
+            ++statistics_.droppedFrames;
+            statistics_.dropLateness.record(toMicroseconds(lateness));
+            return false;
+        }
+
+        offset_ += lateness;
+    }
+
+    frames_.emplace(timestamp, Frame{timestamp, reference, now, std::move(data)});
+    return true;
+}
+
+bool VideoJitterBuffer::pop(Frame& frame, Clock::time_point now)
+{
+    if(frames_.empty() || this->getNextPresentationTime() > now)
+    {
+        return false;
+    }
+
+    auto it = frames_.begin();
+    frame = std::move(it->second);
+    frames_.erase(it);
+
+    delivered_ = true;
+    lastDeliveredTimestamp_ = frame.timestamp;
+    ++statistics_.deliveredFrames;
+    statistics_.bufferingDelay.record(toMicroseconds(now - frame.arrival));
+    return true;
+}
+
+VideoJitterBuffer::Clock::time_point VideoJitterBuffer::getNextPresentationTime() const
+{
+    return frames_.empty() ? Clock::time_point() : this->getPresentationTime(frames_.begin()->first);
+}
+
+bool VideoJitterBuffer::empty() const
+{
+    return frames_.empty();
+}
+
+size_t VideoJitterBuffer::size() const
+{
+    return frames_.size();
+}
+
+void VideoJitterBuffer::reset()
+{
+    frames_.clear();
+    anchored_ = false;
+    offset_ = Clock::duration(0);
+    delivered_ = false;
+    lastDeliveredTimestamp_ = 0;
+}
+
+std::chrono::microseconds VideoJitterBuffer::getLatencyBudget() const
+{
+    return latencyBudget_;
+}
+
+void VideoJitterBuffer::setLatencyBudget(std::chrono::microseconds latencyBudget)
+{
+    latencyBudget_ = latencyBudget;
+}
+
+const VideoJitterBufferStatistics& VideoJitterBuffer::getStatistics() const
+{
+    return statistics_;
+}
+
+VideoJitterBuffer::Clock::time_point VideoJitterBuffer::getPresentationTime(messenger::Timestamp::ValueType timestamp) const
+{
+    return Clock::time_point(offset_ + std::chrono::microseconds(timestamp)) + latencyBudget_;
+}
+
+uint64_t VideoJitterBuffer::toMicroseconds(Clock::duration duration)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+}
+
+}
+}
+}
+}
@@ -0,0 +1,139 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Channel/AV/VideoJitterBuffer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+namespace ut
+{
+
+class VideoJitterBufferUnitTest
+{
+protected:
+    VideoJitterBufferUnitTest()
+        : jitterBuffer_(std::chrono::milliseconds(40))
+        , start_(VideoJitterBuffer::Clock::now())
+    {
+
+    }
+
+    VideoJitterBuffer::Clock::time_point at(int64_t milliseconds) const
+    {
+        return start_ + std::chrono::milliseconds(milliseconds);
+    }
+
+    bool push(int64_t timestampMs, int64_t arrivalMs, bool reference = true)
+    {
+        return jitterBuffer_.push(timestampMs * 1000, reference, common::Data(1, static_cast<uint8_t>(timestampMs)), this->at(arrivalMs));
+    }
+
+    VideoJitterBuffer jitterBuffer_;
+    VideoJitterBuffer::Clock::time_point start_;
+    VideoJitterBuffer::Frame frame_;
+};
+
+BOOST_FIXTURE_TEST_CASE(VideoJitterBuffer_HoldsFrameForLatencyBudget, VideoJitterBufferUnitTest)
+{
+    BOOST_TEST(this->push(1000, 0));
+
+    BOOST_TEST(!jitterBuffer_.pop(frame_, this->at(39)));
+    BOOST_TEST(jitterBuffer_.pop(frame_, this->at(40)));
+    BOOST_TEST(frame_.timestamp == 1000000u);
+
+    const auto& statistics = jitterBuffer_.getStatistics();
+    BOOST_TEST(statistics.deliveredFrames == 1u);
+    BOOST_TEST(statistics.bufferingDelay.getMax() == 40000u);
+}
+
+BOOST_FIXTURE_TEST_CASE(VideoJitterBuffer_ReordersAndPacesByTimestamp, VideoJitterBufferUnitTest)
+{
+    // 30 fps capture with the second and third frames swapped in transit
+    BOOST_TEST(this->push(0, 0));
+    BOOST_TEST(this->push(66, 70));
+    BOOST_TEST(this->push(33, 72));
+    BOOST_TEST(this->push(100, 101));
+
+    BOOST_TEST(jitterBuffer_.pop(frame_, this->at(40)));
+    BOOST_TEST(frame_.timestamp == 0u);
+    BOOST_TEST(!jitterBuffer_.pop(frame_, this->at(72)));
+    BOOST_TEST(jitterBuffer_.pop(frame_, this->at(73)));
+    BOOST_TEST(frame_.timestamp == 33000u);
+    BOOST_TEST(jitterBuffer_.pop(frame_, this->at(106)));
+    BOOST_TEST(frame_.timestamp == 66000u);
+    BOOST_CHECK(jitterBuffer_.getNextPresentationTime() == this->at(140));
+}
+
+BOOST_FIXTURE_TEST_CASE(VideoJitterBuffer_DropsLateNonReferenceFrame, VideoJitterBufferUnitTest)
+{
+    BOOST_TEST(this->push(0, 0));
+    BOOST_TEST(!this->push(33, 83, false));
+
+    const auto& statistics = jitterBuffer_.getStatistics();
+    BOOST_TEST(statistics.droppedFrames == 1u);
+    BOOST_TEST(statistics.dropLateness.getCount() == 1u);
+    BOOST_TEST(statistics.dropLateness.getMax() == 10000u);
+    BOOST_TEST(jitterBuffer_.size() == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(VideoJitterBuffer_LateReferenceFrameShiftsTimeline, VideoJitterBufferUnitTest)
+{
+    BOOST_TEST(this->push(0, 0));
+    BOOST_TEST(jitterBuffer_.pop(frame_, this->at(40)));
+
+    BOOST_TEST(this->push(33, 83));
+    BOOST_CHECK(jitterBuffer_.getNextPresentationTime() == this->at(83));
+    BOOST_TEST(jitterBuffer_.pop(frame_, this->at(83)));
+
+    // the following frame arrives with the same delay and is paced on the shifted timeline
+    BOOST_TEST(this->push(66, 116, false));
+    BOOST_CHECK(jitterBuffer_.getNextPresentationTime() == this->at(116));
+}
+
+BOOST_FIXTURE_TEST_CASE(VideoJitterBuffer_DropsNonReferenceFrameBehindDelivered, VideoJitterBufferUnitTest)
+{
+    BOOST_TEST(this->push(0, 0));
+    BOOST_TEST(this->push(66, 66));
+    BOOST_TEST(jitterBuffer_.pop(frame_, this->at(40)));
+    BOOST_TEST(jitterBuffer_.pop(frame_, this->at(106)));
+
+    BOOST_TEST(!this->push(33, 60, false));
+    BOOST_TEST(jitterBuffer_.getStatistics().dropLateness.getMax() == 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(VideoJitterBuffer_FollowsFastestArrival, VideoJitterBufferUnitTest)
+{
+    // first frame delayed by 20 ms, the second one shows the real transit time
+    BOOST_TEST(this->push(0, 20));
+    BOOST_TEST(this->push(33, 33));
+
+    BOOST_CHECK(jitterBuffer_.getNextPresentationTime() == this->at(40));
+}
+
+}
+}
+}
+}
+}
@@ -0,0 +1,149 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Channel/AV/VideoPresentationPacer.hpp>
+#include <f1x/aasdk/IO/SteadyTimer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+
+VideoPresentationPacer::VideoPresentationPacer(boost::asio::io_service::strand& strand, FrameHandler frameHandler, DropHandler dropHandler,
+                                               std::chrono::microseconds latencyBudget)
+    : VideoPresentationPacer(strand, std::make_shared<io::SteadyTimer>(strand.context()), std::move(frameHandler), std::move(dropHandler), latencyBudget)
+{
+
+}
+
+VideoPresentationPacer::VideoPresentationPacer(boost::asio::io_service::strand& strand, io::ITimer::Pointer timer, FrameHandler frameHandler,
+                                               DropHandler dropHandler, std::chrono::microseconds latencyBudget)
+    : strand_(strand)
+    , timer_(std::move(timer))
+    , frameHandler_(std::move(frameHandler))
+    , dropHandler_(std::move(dropHandler))
+    , jitterBuffer_(latencyBudget)
+    , scheduled_(false)
+{
+
+}
+
+void VideoPresentationPacer::push(messenger::Timestamp::ValueType timestamp, const common::DataConstBuffer& buffer)
+{
+    units_.clear();
+    payloadParser_.parse(buffer, units_);
+
+    common::Data data(buffer.cdata, buffer.cdata + buffer.size);
+    if(!jitterBuffer_.push(timestamp, isReferenceFrame(units_), std::move(data), timer_->now()))
+    {
+        if(dropHandler_)
+        {
+            dropHandler_(timestamp);
+        }
+
+        return;
+    }
+
+    this->schedule();
+}
+
+void VideoPresentationPacer::reset()
+{
+    timer_->cancel();
+    scheduled_ = false;
+    jitterBuffer_.reset();
+}
+
+void VideoPresentationPacer::setLatencyBudget(std::chrono::microseconds latencyBudget)
+{
+    jitterBuffer_.setLatencyBudget(latencyBudget);
+    scheduled_ = false;
+    this->schedule();
+}
+
+const VideoJitterBufferStatistics& VideoPresentationPacer::getStatistics() const
+{
+    return jitterBuffer_.getStatistics();
+}
+
+bool VideoPresentationPacer::isReferenceFrame(const H264NALUnits& units)
+{
+    bool hasSlices = false;
+
+    for(const auto& unit : units)
+    {
+        if(unit.type >= H264NALUnitType::SLICE && unit.type <= H264NALUnitType::IDR_SLICE)
+        {
+            if(unit.referenceIndication != 0)
+            {
+                return true;
+            }
+
+            hasSlices = true;
+        }
+    }
+
+    // payloads without slices carry codec configuration, never drop them
+    return !hasSlices;
+}
+
+void VideoPresentationPacer::schedule()
+{
+    if(jitterBuffer_.empty())
+    {
+        return;
+    }
+
+    const auto presentationTime = jitterBuffer_.getNextPresentationTime();
+    if(scheduled_ && scheduledTime_ <= presentationTime)
+    {
+        return;
+    }
+
+    scheduled_ = true;
+    scheduledTime_ = presentationTime;
+    timer_->expiresAt(presentationTime);
+    timer_->asyncWait(strand_.wrap([this, self = this->shared_from_this()](const boost::system::error_code& e) {
+        if(e != boost::asio::error::operation_aborted)
+        {
+            scheduled_ = false;
+            this->deliver();
+        }
+    }));
+}
+
+void VideoPresentationPacer::deliver()
+{
+    VideoJitterBuffer::Frame frame;
+
+    while(jitterBuffer_.pop(frame, timer_->now()))
+    {
+        frameHandler_(frame.timestamp, common::DataConstBuffer(frame.data));
+    }
+
+    this->schedule();
+}
+
+}
+}
+}
+}
@@ -0,0 +1,183 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/SimulationTimer.hpp>
+#include <f1x/aasdk/IO/VirtualTimeDriver.hpp>
+#include <f1x/aasdk/Channel/AV/VideoPresentationPacer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace av
+{
+namespace ut
+{
+
+// runs the pacer on the virtual clock of the VirtualTimeDriver, whose epoch is the steady clock one
+class VirtualTimer: public io::ITimer
+{
+public:
+    explicit VirtualTimer(boost::asio::io_service& ioService)
+        : timer_(ioService)
+    {
+
+    }
+
+    Clock::time_point now() const override
+    {
+        return Clock::time_point(io::SimulationClock::now().time_since_epoch());
+    }
+
+    void expiresAt(Clock::time_point expiry) override
+    {
+        timer_.expiresAt(io::SimulationTimer::TimePoint(expiry.time_since_epoch()));
+    }
+
+    void asyncWait(WaitHandler handler) override
+    {
+        timer_.asyncWait(std::move(handler));
+    }
+
+    void cancel() override
+    {
+        timer_.cancel();
+    }
+
+private:
+    io::SimulationTimer timer_;
+};
+
+class VideoPresentationPacerUnitTest
+{
+protected:
+    VideoPresentationPacerUnitTest()
+        : driver_(ioService_)
+        , strand_(ioService_)
+        , start_(driver_.now())
+        , pacer_(std::make_shared<VideoPresentationPacer>(strand_, std::make_shared<VirtualTimer>(ioService_),
+                                                          [this](messenger::Timestamp::ValueType timestamp, const common::DataConstBuffer&) {
+                                                              deliveries_.emplace_back(timestamp, this->getElapsedMs());
+                                                          },
+                                                          [this](messenger::Timestamp::ValueType timestamp) {
+                                                              drops_.push_back(timestamp);
+                                                          },
+                                                          std::chrono::milliseconds(40)))
+    {
+
+    }
+
+    ~VideoPresentationPacerUnitTest()
+    {
+        pacer_->reset();
+        driver_.runFor(std::chrono::milliseconds(1));
+    }
+
+    // replays a captured frame: the payload is a single slice with the given NAL header byte
+    void replay(int64_t timestampMs, int64_t arrivalMs, uint8_t nalHeader)
+    {
+        driver_.runUntil(start_ + std::chrono::milliseconds(arrivalMs));
+
+        const common::Data payload{0x00, 0x00, 0x00, 0x01, nalHeader, 0x88, 0x84, 0x21};
+        strand_.post([this, timestampMs, payload]() {
+            pacer_->push(timestampMs * 1000, common::DataConstBuffer(payload));
+        });
+    }
+
+    int64_t getElapsedMs() const
+    {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(driver_.now() - start_).count();
+    }
+
+    static constexpr uint8_t cIDRSlice = 0x65;
+    static constexpr uint8_t cReferenceSlice = 0x41;
+    static constexpr uint8_t cNonReferenceSlice = 0x01;
+
+    boost::asio::io_service ioService_;
+    io::VirtualTimeDriver driver_;
+    boost::asio::io_service::strand strand_;
+    io::VirtualTimeDriver::TimePoint start_;
+    VideoPresentationPacer::Pointer pacer_;
+    std::vector<std::pair<messenger::Timestamp::ValueType, int64_t>> deliveries_;
+    std::vector<messenger::Timestamp::ValueType> drops_;
+};
+
+BOOST_FIXTURE_TEST_CASE(VideoPresentationPacer_DeliversReplayedFramesAtPresentationTime, VideoPresentationPacerUnitTest)
+{
+    // 30 fps capture with the second and third frames swapped in transit
+    this->replay(0, 0, cIDRSlice);
+    this->replay(66, 70, cReferenceSlice);
+    this->replay(33, 72, cReferenceSlice);
+    this->replay(100, 101, cReferenceSlice);
+    driver_.runFor(std::chrono::milliseconds(100));
+
+    const std::vector<std::pair<messenger::Timestamp::ValueType, int64_t>> expectedDeliveries{{0, 40}, {33000, 73}, {66000, 106}, {100000, 140}};
+    BOOST_CHECK(deliveries_ == expectedDeliveries);
+    BOOST_TEST(drops_.empty());
+
+    const auto& statistics = pacer_->getStatistics();
+    BOOST_TEST(statistics.deliveredFrames == 4u);
+    BOOST_TEST(statistics.bufferingDelay.getCount() == 4u);
+    BOOST_TEST(statistics.bufferingDelay.getMin() == 1000u);
+    BOOST_TEST(statistics.bufferingDelay.getMax() == 40000u);
+}
+
+BOOST_FIXTURE_TEST_CASE(VideoPresentationPacer_DropsLateNonReferenceFrame, VideoPresentationPacerUnitTest)
+{
+    this->replay(0, 0, cIDRSlice);
+    // due at 73 ms, dropped
+    this->replay(33, 80, cNonReferenceSlice);
+    // due at 106 ms, kept since the decoder needs it and delivered on arrival
+    this->replay(66, 120, cReferenceSlice);
+    driver_.runFor(std::chrono::milliseconds(100));
+
+    const std::vector<std::pair<messenger::Timestamp::ValueType, int64_t>> expectedDeliveries{{0, 40}, {66000, 120}};
+    BOOST_CHECK(deliveries_ == expectedDeliveries);
+    BOOST_TEST(drops_ == std::vector<messenger::Timestamp::ValueType>({33000}), boost::test_tools::per_element());
+
+    const auto& statistics = pacer_->getStatistics();
+    BOOST_TEST(statistics.droppedFrames == 1u);
+    BOOST_TEST(statistics.dropLateness.getCount() == 1u);
+    BOOST_TEST(statistics.dropLateness.getMax() == 7000u);
+}
+
+BOOST_FIXTURE_TEST_CASE(VideoPresentationPacer_ResetDiscardsBufferedFrames, VideoPresentationPacerUnitTest)
+{
+    this->replay(0, 0, cIDRSlice);
+    driver_.runFor(std::chrono::milliseconds(10));
+
+    strand_.post([this]() { pacer_->reset(); });
+    driver_.runFor(std::chrono::milliseconds(100));
+    BOOST_TEST(deliveries_.empty());
+
+    // a new timeline starts with the next frame
+    this->replay(5000, 200, cIDRSlice);
+    driver_.runFor(std::chrono::milliseconds(100));
+
+    const std::vector<std::pair<messenger::Timestamp::ValueType, int64_t>> expectedDeliveries{{5000000, 240}};
+    BOOST_CHECK(deliveries_ == expectedDeliveries);
+}
+
+}
+}
+}
+}
+}
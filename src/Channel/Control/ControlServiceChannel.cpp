@@ -33,8 +33,8 @@ namespace channel
 namespace control
 {
 
-ControlServiceChannel::ControlServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, messenger, messenger::ChannelId::CONTROL)
+ControlServiceChannel::ControlServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, io::DispatchMode dispatchMode)
+    : ServiceChannel(strand, messenger, messenger::ChannelId::CONTROL, dispatchMode)
 {
 
 }
@@ -126,7 +126,7 @@ void ControlServiceChannel::sendPingRequest(const proto::messages::PingRequest&
 
 void ControlServiceChannel::receive(IControlServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise  = messenger::ReceivePromise::defer(strand_);
+    auto receivePromise  = messenger::ReceivePromise::defer(strand_, dispatchMode_);
     receivePromise->then(std::bind(&ControlServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
                         std::bind(&IControlServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
 
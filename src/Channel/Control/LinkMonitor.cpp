@@ -0,0 +1,203 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <f1x/aasdk/Channel/Control/LinkMonitor.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace control
+{
+
+constexpr std::chrono::milliseconds LinkMonitor::cDefaultPingInterval;
+constexpr std::chrono::milliseconds LinkMonitor::cDefaultDeadLinkTimeout;
+constexpr size_t LinkMonitor::cMaxOutstandingPings;
+constexpr size_t LinkMonitor::cClockSamples;
+
+LinkMonitor::LinkMonitor(boost::asio::io_service::strand& strand, IControlServiceChannel::Pointer channel, DeadLinkHandler deadLinkHandler,
+                         std::chrono::milliseconds pingInterval, std::chrono::milliseconds deadLinkTimeout)
+    : strand_(strand)
+    , pingTimer_(strand_.context())
+    , deadlineTimer_(strand_.context())
+    , channel_(std::move(channel))
+    , deadLinkHandler_(std::move(deadLinkHandler))
+    , pingInterval_(pingInterval)
+    , deadLinkTimeout_(deadLinkTimeout)
+    , started_(false)
+    , clockSampleCount_(0)
+{
+
+}
+
+void LinkMonitor::start()
+{
+    started_ = true;
+    this->armDeadline();
+    this->ping();
+    this->schedulePing();
+}
+
+void LinkMonitor::stop()
+{
+    started_ = false;
+    pingTimer_.cancel();
+    deadlineTimer_.cancel();
+    outstandingPings_.clear();
+}
+
+void LinkMonitor::ping(Clock::time_point now)
+{
+    if(outstandingPings_.size() >= cMaxOutstandingPings)
+    {
+        outstandingPings_.pop_front();
+    }
+
+    const auto timestamp = toMicroseconds(now);
+    outstandingPings_.push_back(timestamp);
+    ++statistics_.sentPings;
+
+    proto::messages::PingRequest request;
+    request.set_timestamp(timestamp);
+
+    auto promise = SendPromise::defer(strand_);
+    promise->then([]() {}, [](const error::Error& e) {
+        AASDK_LOG(debug) << "[LinkMonitor] ping send failed: " << e.what();
+    });
+    channel_->sendPingRequest(request, std::move(promise));
+}
+
+void LinkMonitor::onPingResponse(const proto::messages::PingResponse& response, Clock::time_point now)
+{
+    const auto receiveTime = toMicroseconds(now);
+    const auto it = std::find(outstandingPings_.begin(), outstandingPings_.end(), response.timestamp());
+    int64_t sendTime = 0;
+    bool echo = false;
+
+    if(it != outstandingPings_.end())
+    {
+        // the phone echoed our clock, older pings are considered lost
+        sendTime = *it;
+        echo = true;
+        outstandingPings_.erase(outstandingPings_.begin(), it + 1);
+    }
+    else if(!outstandingPings_.empty())
+    {
+        // the phone answered with its own clock, responses arrive in order
+        sendTime = outstandingPings_.front();
+        outstandingPings_.pop_front();
+    }
+    else
+    {
+        ++statistics_.unmatchedResponses;
+        return;
+    }
+
+    const std::chrono::microseconds roundTripTime(receiveTime - sendTime);
+    ++statistics_.receivedResponses;
+    statistics_.lastRoundTripTime = roundTripTime;
+    statistics_.roundTripTime.record(roundTripTime.count());
+
+    if(roundTripTimeHandler_)
+    {
+        roundTripTimeHandler_(roundTripTime);
+    }
+
+    if(!echo)
+    {
+        const std::chrono::microseconds offset(response.timestamp() - (sendTime + receiveTime) / 2);
+        clockSamples_[clockSampleCount_++ % cClockSamples] = ClockSample{roundTripTime, offset};
+
+        const auto end = clockSamples_.begin() + std::min(clockSampleCount_, cClockSamples);
+        const auto best = std::min_element(clockSamples_.begin(), end, [](const ClockSample& a, const ClockSample& b) {
+            return a.roundTripTime < b.roundTripTime;
+        });
+
+        statistics_.clockOffsetValid = true;
+        statistics_.clockOffset = best->offset;
+    }
+
+    if(started_)
+    {
+        this->armDeadline();
+    }
+}
+
+bool LinkMonitor::toLocalTime(messenger::Timestamp::ValueType timestamp, Clock::time_point& localTime) const
+{
+    if(!statistics_.clockOffsetValid)
+    {
+        return false;
+    }
+
+    localTime = Clock::time_point(std::chrono::microseconds(static_cast<int64_t>(timestamp)) - statistics_.clockOffset);
+    return true;
+}
+
+const LinkMonitorStatistics& LinkMonitor::getStatistics() const
+{
+    return statistics_;
+}
+
+void LinkMonitor::setRoundTripTimeHandler(RoundTripTimeHandler roundTripTimeHandler)
+{
+    roundTripTimeHandler_ = std::move(roundTripTimeHandler);
+}
+
+void LinkMonitor::schedulePing()
+{
+    pingTimer_.expires_from_now(pingInterval_);
+    pingTimer_.async_wait(strand_.wrap([this, self = this->shared_from_this()](const boost::system::error_code& e) {
+        if(e != boost::asio::error::operation_aborted && started_)
+        {
+            this->ping();
+            this->schedulePing();
+        }
+    }));
+}
+
+void LinkMonitor::armDeadline()
+{
+    deadlineTimer_.expires_from_now(deadLinkTimeout_);
+    deadlineTimer_.async_wait(strand_.wrap([this, self = this->shared_from_this()](const boost::system::error_code& e) {
+        if(e != boost::asio::error::operation_aborted && started_)
+        {
+            AASDK_LOG(error) << "[LinkMonitor] no ping response for " << deadLinkTimeout_.count() << " ms, link is dead.";
+            this->stop();
+
+            if(deadLinkHandler_)
+            {
+                deadLinkHandler_();
+            }
+        }
+    }));
+}
+
+int64_t LinkMonitor::toMicroseconds(Clock::time_point timePoint)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(timePoint.time_since_epoch()).count();
+}
+
+}
+}
+}
+}
@@ -0,0 +1,160 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Channel/Control/UT/ControlServiceChannel.mock.hpp>
+#include <f1x/aasdk/Channel/Control/LinkMonitor.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace control
+{
+namespace ut
+{
+
+using ::testing::_;
+using ::testing::Invoke;
+
+class LinkMonitorUnitTest
+{
+protected:
+    LinkMonitorUnitTest()
+        : strand_(ioService_)
+        , channelMock_(std::make_shared<ControlServiceChannelMock>())
+        , deadLinkReported_(false)
+        , start_(LinkMonitor::Clock::now())
+    {
+        ON_CALL(*channelMock_, sendPingRequest(_, _)).WillByDefault(Invoke(
+            [this](const proto::messages::PingRequest& request, SendPromise::Pointer) {
+                requests_.push_back(request);
+            }));
+    }
+
+    LinkMonitor::Pointer createMonitor(std::chrono::milliseconds pingInterval, std::chrono::milliseconds deadLinkTimeout)
+    {
+        return std::make_shared<LinkMonitor>(strand_, channelMock_, [this]() { deadLinkReported_ = true; }, pingInterval, deadLinkTimeout);
+    }
+
+    static proto::messages::PingResponse response(int64_t timestamp)
+    {
+        proto::messages::PingResponse response;
+        response.set_timestamp(timestamp);
+        return response;
+    }
+
+    LinkMonitor::Clock::time_point at(int64_t microseconds) const
+    {
+        return start_ + std::chrono::microseconds(microseconds);
+    }
+
+    int64_t micros(LinkMonitor::Clock::time_point timePoint) const
+    {
+        return std::chrono::duration_cast<std::chrono::microseconds>(timePoint.time_since_epoch()).count();
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+    std::shared_ptr<ControlServiceChannelMock> channelMock_;
+    std::vector<proto::messages::PingRequest> requests_;
+    bool deadLinkReported_;
+    LinkMonitor::Clock::time_point start_;
+};
+
+BOOST_FIXTURE_TEST_CASE(LinkMonitor_MeasuresRoundTripFromEcho, LinkMonitorUnitTest)
+{
+    auto monitor = this->createMonitor(std::chrono::milliseconds(1000), std::chrono::milliseconds(3000));
+    EXPECT_CALL(*channelMock_, sendPingRequest(_, _)).Times(2);
+
+    monitor->ping(this->at(0));
+    monitor->ping(this->at(1000));
+    BOOST_TEST(requests_[0].timestamp() == this->micros(this->at(0)));
+
+    monitor->onPingResponse(response(requests_[1].timestamp()), this->at(3500));
+
+    const auto& statistics = monitor->getStatistics();
+    BOOST_TEST(statistics.receivedResponses == 1u);
+    BOOST_TEST(statistics.lastRoundTripTime.count() == 2500);
+    BOOST_TEST(!statistics.clockOffsetValid);
+
+    monitor->onPingResponse(response(requests_[0].timestamp()), this->at(4000));
+    BOOST_TEST(statistics.unmatchedResponses == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(LinkMonitor_ReportsRoundTripToHandler, LinkMonitorUnitTest)
+{
+    auto monitor = this->createMonitor(std::chrono::milliseconds(1000), std::chrono::milliseconds(3000));
+    std::vector<std::chrono::microseconds> roundTripTimes;
+    monitor->setRoundTripTimeHandler([&](std::chrono::microseconds roundTripTime) { roundTripTimes.push_back(roundTripTime); });
+    EXPECT_CALL(*channelMock_, sendPingRequest(_, _)).Times(2);
+
+    monitor->ping(this->at(0));
+    monitor->ping(this->at(1000));
+    monitor->onPingResponse(response(requests_[0].timestamp()), this->at(1500));
+    monitor->onPingResponse(response(requests_[1].timestamp()), this->at(4000));
+    monitor->onPingResponse(response(requests_[0].timestamp()), this->at(4500));
+
+    BOOST_TEST(roundTripTimes.size() == 2u);
+    BOOST_CHECK(roundTripTimes[0] == std::chrono::microseconds(1500));
+    BOOST_CHECK(roundTripTimes[1] == std::chrono::microseconds(3000));
+}
+
+BOOST_FIXTURE_TEST_CASE(LinkMonitor_EstimatesClockOffsetFromFastestSample, LinkMonitorUnitTest)
+{
+    auto monitor = this->createMonitor(std::chrono::milliseconds(1000), std::chrono::milliseconds(3000));
+    EXPECT_CALL(*channelMock_, sendPingRequest(_, _)).Times(2);
+
+    const int64_t phoneOffset = 5000000;
+
+    // slow round trip with asymmetric delay skews the estimate
+    monitor->ping(this->at(0));
+    monitor->onPingResponse(response(this->micros(this->at(9000)) + phoneOffset), this->at(10000));
+    BOOST_TEST(monitor->getStatistics().clockOffset.count() == phoneOffset + 4000);
+
+    monitor->ping(this->at(20000));
+    monitor->onPingResponse(response(this->micros(this->at(20500)) + phoneOffset), this->at(21000));
+
+    const auto& statistics = monitor->getStatistics();
+    BOOST_TEST(statistics.clockOffsetValid);
+    BOOST_TEST(statistics.clockOffset.count() == phoneOffset);
+    BOOST_TEST(statistics.roundTripTime.getCount() == 2u);
+
+    LinkMonitor::Clock::time_point localTime;
+    BOOST_TEST(monitor->toLocalTime(this->micros(this->at(30000)) + phoneOffset, localTime));
+    BOOST_TEST(this->micros(localTime) == this->micros(this->at(30000)));
+}
+
+BOOST_FIXTURE_TEST_CASE(LinkMonitor_ReportsDeadLink, LinkMonitorUnitTest)
+{
+    auto monitor = this->createMonitor(std::chrono::milliseconds(1), std::chrono::milliseconds(20));
+    EXPECT_CALL(*channelMock_, sendPingRequest(_, _)).Times(::testing::AtLeast(1));
+
+    strand_.dispatch([monitor]() { monitor->start(); });
+    ioService_.run();
+
+    BOOST_TEST(deadLinkReported_);
+}
+
+}
+}
+}
+}
+}
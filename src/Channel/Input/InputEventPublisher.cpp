@@ -0,0 +1,157 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Channel/Input/InputEventPublisher.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace input
+{
+
+InputEventPublisher::InputEventPublisher(boost::asio::io_service::strand& strand, IInputServiceChannel::Pointer channel, ErrorHandler errorHandler)
+    : strand_(strand)
+    , channel_(std::move(channel))
+    , errorHandler_(std::move(errorHandler))
+    , sending_(false)
+    , stopped_(false)
+{
+
+}
+
+void InputEventPublisher::publish(proto::messages::InputEventIndication indication)
+{
+    const auto publishTime = Clock::now();
+
+    strand_.dispatch([this, self = this->shared_from_this(), indication = std::move(indication), publishTime]() mutable {
+        if(!stopped_)
+        {
+            this->enqueue(std::move(indication), publishTime);
+        }
+    });
+}
+
+void InputEventPublisher::stop()
+{
+    stopped_ = true;
+    queue_.clear();
+}
+
+const InputEventPublisherStatistics& InputEventPublisher::getStatistics() const
+{
+    return statistics_;
+}
+
+bool InputEventPublisher::isMergeable(const proto::messages::InputEventIndication& queued, const proto::messages::InputEventIndication& indication)
+{
+    const auto isDragOnly = [](const proto::messages::InputEventIndication& event) {
+        return event.has_touch_event() && event.touch_event().touch_action() == proto::enums::TouchAction::DRAG
+                && !event.has_button_event() && !event.has_absolute_input_event() && !event.has_relative_input_event();
+    };
+
+    if(!isDragOnly(queued) || !isDragOnly(indication) || queued.disp_channel() != indication.disp_channel())
+    {
+        return false;
+    }
+
+    const auto& queuedLocations = queued.touch_event().touch_location();
+    const auto& locations = indication.touch_event().touch_location();
+
+    if(queuedLocations.size() != locations.size())
+    {
+        return false;
+    }
+
+    for(int i = 0; i < locations.size(); ++i)
+    {
+        if(queuedLocations.Get(i).pointer_id() != locations.Get(i).pointer_id())
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void InputEventPublisher::enqueue(proto::messages::InputEventIndication indication, Clock::time_point publishTime)
+{
+    ++statistics_.publishedEvents;
+
+    if(sending_ && !queue_.empty() && isMergeable(queue_.back().indication, indication))
+    {
+        queue_.back().indication = std::move(indication);
+        queue_.back().publishTimes.push_back(publishTime);
+        ++statistics_.mergedEvents;
+        return;
+    }
+
+    queue_.push_back(PendingEvent{std::move(indication), {publishTime}});
+
+    if(!sending_)
+    {
+        this->sendNext();
+    }
+}
+
+void InputEventPublisher::sendNext()
+{
+    if(queue_.empty() || stopped_)
+    {
+        sending_ = false;
+        return;
+    }
+
+    sending_ = true;
+    auto event = std::move(queue_.front());
+    queue_.pop_front();
+
+    auto promise = SendPromise::defer(strand_);
+    promise->then([this, self = this->shared_from_this(), publishTimes = std::move(event.publishTimes)]() {
+                      this->onSent(publishTimes);
+                      this->sendNext();
+                  },
+                  [this, self = this->shared_from_this()](const error::Error& e) {
+                      sending_ = false;
+
+                      if(errorHandler_)
+                      {
+                          errorHandler_(e);
+                      }
+                  });
+
+    ++statistics_.sentIndications;
+    channel_->sendInputEventIndication(event.indication, std::move(promise));
+}
+
+void InputEventPublisher::onSent(const std::vector<Clock::time_point>& publishTimes)
+{
+    const auto now = Clock::now();
+
+    for(const auto& publishTime : publishTimes)
+    {
+        statistics_.queueingLatency.record(std::chrono::duration_cast<std::chrono::microseconds>(now - publishTime).count());
+    }
+}
+
+}
+}
+}
+}
@@ -0,0 +1,139 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Channel/Input/UT/InputServiceChannel.mock.hpp>
+#include <f1x/aasdk/Channel/Input/InputEventPublisher.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace input
+{
+namespace ut
+{
+
+using ::testing::_;
+using ::testing::Invoke;
+
+class InputEventPublisherUnitTest
+{
+protected:
+    InputEventPublisherUnitTest()
+        : strand_(ioService_)
+        , channelMock_(std::make_shared<InputServiceChannelMock>())
+        , publisher_(std::make_shared<InputEventPublisher>(strand_, channelMock_, nullptr))
+    {
+        ON_CALL(*channelMock_, sendInputEventIndication(_, _)).WillByDefault(Invoke(
+            [this](const proto::messages::InputEventIndication& indication, SendPromise::Pointer promise) {
+                sent_.push_back(indication);
+                promises_.push_back(std::move(promise));
+            }));
+    }
+
+    static proto::messages::InputEventIndication touch(proto::enums::TouchAction::Enum action, uint32_t x, uint32_t pointerId = 0)
+    {
+        proto::messages::InputEventIndication indication;
+        indication.set_timestamp(x);
+        indication.mutable_touch_event()->set_touch_action(action);
+        auto location = indication.mutable_touch_event()->add_touch_location();
+        location->set_x(x);
+        location->set_y(0);
+        location->set_pointer_id(pointerId);
+        return indication;
+    }
+
+    void completeSend()
+    {
+        auto promise = std::move(promises_.front());
+        promises_.pop_front();
+        promise->resolve();
+        ioService_.run();
+        ioService_.reset();
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+    std::shared_ptr<InputServiceChannelMock> channelMock_;
+    InputEventPublisher::Pointer publisher_;
+    std::vector<proto::messages::InputEventIndication> sent_;
+    std::deque<SendPromise::Pointer> promises_;
+};
+
+BOOST_FIXTURE_TEST_CASE(InputEventPublisher_MergesDragWhileSendInFlight, InputEventPublisherUnitTest)
+{
+    EXPECT_CALL(*channelMock_, sendInputEventIndication(_, _)).Times(2);
+
+    publisher_->publish(touch(proto::enums::TouchAction::DRAG, 1));
+    publisher_->publish(touch(proto::enums::TouchAction::DRAG, 2));
+    publisher_->publish(touch(proto::enums::TouchAction::DRAG, 3));
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_TEST(sent_.size() == 1u);
+    this->completeSend();
+
+    BOOST_TEST(sent_.size() == 2u);
+    BOOST_TEST(sent_[1].touch_event().touch_location(0).x() == 3u);
+    this->completeSend();
+
+    const auto& statistics = publisher_->getStatistics();
+    BOOST_TEST(statistics.publishedEvents == 3u);
+    BOOST_TEST(statistics.mergedEvents == 1u);
+    BOOST_TEST(statistics.sentIndications == 2u);
+    BOOST_TEST(statistics.queueingLatency.getCount() == 3u);
+}
+
+BOOST_FIXTURE_TEST_CASE(InputEventPublisher_NeverMergesPressAndRelease, InputEventPublisherUnitTest)
+{
+    EXPECT_CALL(*channelMock_, sendInputEventIndication(_, _)).Times(4);
+
+    publisher_->publish(touch(proto::enums::TouchAction::PRESS, 1));
+    publisher_->publish(touch(proto::enums::TouchAction::DRAG, 2));
+    publisher_->publish(touch(proto::enums::TouchAction::RELEASE, 3));
+    publisher_->publish(touch(proto::enums::TouchAction::DRAG, 4));
+    ioService_.run();
+    ioService_.reset();
+
+    while(!promises_.empty())
+    {
+        this->completeSend();
+    }
+
+    BOOST_TEST(sent_.size() == 4u);
+    BOOST_TEST(sent_[2].touch_event().touch_action() == proto::enums::TouchAction::RELEASE);
+    BOOST_TEST(publisher_->getStatistics().mergedEvents == 0u);
+}
+
+BOOST_FIXTURE_TEST_CASE(InputEventPublisher_DoesNotMergeDifferentPointers, InputEventPublisherUnitTest)
+{
+    const auto first = touch(proto::enums::TouchAction::DRAG, 1, 0);
+    const auto second = touch(proto::enums::TouchAction::DRAG, 2, 1);
+
+    BOOST_TEST(!InputEventPublisher::isMergeable(first, second));
+    BOOST_TEST(InputEventPublisher::isMergeable(first, touch(proto::enums::TouchAction::DRAG, 5, 0)));
+}
+
+}
+}
+}
+}
+}
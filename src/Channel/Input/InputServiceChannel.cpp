@@ -32,15 +32,15 @@ namespace channel
 namespace input
 {
 
-InputServiceChannel::InputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::INPUT)
+InputServiceChannel::InputServiceChannel(boost::asio::io_service::strand& strand, messenger::IMessenger::Pointer messenger, io::DispatchMode dispatchMode)
+    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::INPUT, dispatchMode)
 {
 
 }
 
 void InputServiceChannel::receive(IInputServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise = messenger::ReceivePromise::defer(strand_);
+    auto receivePromise = messenger::ReceivePromise::defer(strand_, dispatchMode_);
     receivePromise->then(std::bind(&InputServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
                         std::bind(&IInputServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
 
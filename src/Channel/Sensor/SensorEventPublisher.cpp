@@ -0,0 +1,186 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <google/protobuf/util/message_differencer.h>
+#include <f1x/aasdk/Channel/Sensor/SensorEventPublisher.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace sensor
+{
+
+constexpr std::chrono::milliseconds SensorEventPublisher::cDefaultFlushInterval;
+
+SensorEventPublisher::SensorEventPublisher(boost::asio::io_service::strand& strand, ISensorServiceChannel::Pointer channel, ErrorHandler errorHandler,
+                                           std::chrono::milliseconds flushInterval)
+    : strand_(strand)
+    , timer_(strand_.context())
+    , channel_(std::move(channel))
+    , errorHandler_(std::move(errorHandler))
+    , flushInterval_(flushInterval)
+    , scheduled_(false)
+    , stopped_(false)
+{
+
+}
+
+void SensorEventPublisher::publish(proto::messages::SensorEventIndication readings)
+{
+    strand_.dispatch([this, self = this->shared_from_this(), readings = std::move(readings)]() {
+        if(stopped_)
+        {
+            return;
+        }
+
+        this->store(readings);
+
+        if(flushInterval_.count() == 0)
+        {
+            this->flush();
+        }
+        else
+        {
+            this->schedule();
+        }
+    });
+}
+
+void SensorEventPublisher::flush()
+{
+    const auto* reflection = latest_.GetReflection();
+    const auto* descriptor = latest_.GetDescriptor();
+    proto::messages::SensorEventIndication indication;
+    size_t addedFields = 0;
+
+    for(const auto number : pendingFields_)
+    {
+        const auto* field = descriptor->FindFieldByNumber(number);
+        const auto& value = reflection->GetRepeatedMessage(latest_, field, 0);
+
+        if(reflection->FieldSize(sent_, field) > 0)
+        {
+            auto* sentValue = reflection->MutableRepeatedMessage(&sent_, field, 0);
+            if(google::protobuf::util::MessageDifferencer::Equals(value, *sentValue))
+            {
+                ++statistics_.suppressedReadings;
+                continue;
+            }
+
+            sentValue->CopyFrom(value);
+        }
+        else
+        {
+            reflection->AddMessage(&sent_, field)->CopyFrom(value);
+        }
+
+        reflection->AddMessage(&indication, field)->CopyFrom(value);
+        ++addedFields;
+        ++statistics_.sentReadings;
+    }
+
+    pendingFields_.clear();
+
+    if(addedFields > 0)
+    {
+        ++statistics_.sentIndications;
+
+        auto promise = SendPromise::defer(strand_);
+        promise->then([]() {}, [this, self = this->shared_from_this()](const error::Error& e) {
+            if(errorHandler_)
+            {
+                errorHandler_(e);
+            }
+        });
+        channel_->sendSensorEventIndication(indication, std::move(promise));
+    }
+}
+
+void SensorEventPublisher::reset()
+{
+    sent_.Clear();
+}
+
+void SensorEventPublisher::stop()
+{
+    stopped_ = true;
+    scheduled_ = false;
+    timer_.cancel();
+    pendingFields_.clear();
+}
+
+const SensorEventPublisherStatistics& SensorEventPublisher::getStatistics() const
+{
+    return statistics_;
+}
+
+void SensorEventPublisher::store(const proto::messages::SensorEventIndication& readings)
+{
+    const auto* reflection = readings.GetReflection();
+    std::vector<const google::protobuf::FieldDescriptor*> fields;
+    reflection->ListFields(readings, &fields);
+
+    for(const auto* field : fields)
+    {
+        const auto count = reflection->FieldSize(readings, field);
+        const auto& value = reflection->GetRepeatedMessage(readings, field, count - 1);
+
+        statistics_.publishedReadings += count;
+        statistics_.coalescedReadings += count - 1;
+
+        if(reflection->FieldSize(latest_, field) > 0)
+        {
+            reflection->MutableRepeatedMessage(&latest_, field, 0)->CopyFrom(value);
+        }
+        else
+        {
+            reflection->AddMessage(&latest_, field)->CopyFrom(value);
+        }
+
+        if(!pendingFields_.insert(field->number()).second)
+        {
+            ++statistics_.coalescedReadings;
+        }
+    }
+}
+
+void SensorEventPublisher::schedule()
+{
+    if(scheduled_ || pendingFields_.empty())
+    {
+        return;
+    }
+
+    scheduled_ = true;
+    timer_.expires_from_now(flushInterval_);
+    timer_.async_wait(strand_.wrap([this, self = this->shared_from_this()](const boost::system::error_code& e) {
+        if(e != boost::asio::error::operation_aborted && !stopped_)
+        {
+            scheduled_ = false;
+            this->flush();
+        }
+    }));
+}
+
+}
+}
+}
+}
@@ -0,0 +1,136 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Channel/Sensor/UT/SensorServiceChannel.mock.hpp>
+#include <f1x/aasdk/Channel/Sensor/SensorEventPublisher.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace channel
+{
+namespace sensor
+{
+namespace ut
+{
+
+using ::testing::_;
+using ::testing::SaveArg;
+
+class SensorEventPublisherUnitTest
+{
+protected:
+    SensorEventPublisherUnitTest()
+        : strand_(ioService_)
+        , channelMock_(std::make_shared<SensorServiceChannelMock>())
+    {
+
+    }
+
+    static proto::messages::SensorEventIndication speed(int32_t value)
+    {
+        proto::messages::SensorEventIndication readings;
+        readings.add_speed()->set_speed(value);
+        return readings;
+    }
+
+    static proto::messages::SensorEventIndication nightMode(bool value)
+    {
+        proto::messages::SensorEventIndication readings;
+        readings.add_night_mode()->set_is_night(value);
+        return readings;
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+    std::shared_ptr<SensorServiceChannelMock> channelMock_;
+};
+
+BOOST_FIXTURE_TEST_CASE(SensorEventPublisher_MergesNewestReadingPerType, SensorEventPublisherUnitTest)
+{
+    auto publisher = std::make_shared<SensorEventPublisher>(strand_, channelMock_, nullptr, std::chrono::milliseconds(1));
+
+    proto::messages::SensorEventIndication indication;
+    EXPECT_CALL(*channelMock_, sendSensorEventIndication(_, _)).WillOnce(SaveArg<0>(&indication));
+
+    publisher->publish(speed(10));
+    publisher->publish(speed(11));
+    publisher->publish(nightMode(true));
+    publisher->publish(speed(12));
+    ioService_.run();
+
+    BOOST_TEST(indication.speed_size() == 1);
+    BOOST_TEST(indication.speed(0).speed() == 12);
+    BOOST_TEST(indication.night_mode_size() == 1);
+    BOOST_TEST(indication.night_mode(0).is_night());
+
+    const auto& statistics = publisher->getStatistics();
+    BOOST_TEST(statistics.publishedReadings == 4u);
+    BOOST_TEST(statistics.coalescedReadings == 2u);
+    BOOST_TEST(statistics.sentIndications == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(SensorEventPublisher_SuppressesUnchangedValues, SensorEventPublisherUnitTest)
+{
+    auto publisher = std::make_shared<SensorEventPublisher>(strand_, channelMock_, nullptr, std::chrono::milliseconds(0));
+
+    proto::messages::SensorEventIndication indication;
+    EXPECT_CALL(*channelMock_, sendSensorEventIndication(_, _)).Times(2).WillRepeatedly(SaveArg<0>(&indication));
+
+    publisher->publish(nightMode(false));
+    publisher->publish(nightMode(false));
+    publisher->publish(nightMode(true));
+    ioService_.run();
+
+    BOOST_TEST(indication.night_mode(0).is_night());
+    BOOST_TEST(publisher->getStatistics().suppressedReadings == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(SensorEventPublisher_ResendsAfterReset, SensorEventPublisherUnitTest)
+{
+    auto publisher = std::make_shared<SensorEventPublisher>(strand_, channelMock_, nullptr, std::chrono::milliseconds(0));
+
+    EXPECT_CALL(*channelMock_, sendSensorEventIndication(_, _)).Times(2);
+
+    publisher->publish(speed(50));
+    ioService_.run();
+    ioService_.reset();
+
+    publisher->reset();
+    publisher->publish(speed(50));
+    ioService_.run();
+}
+
+BOOST_FIXTURE_TEST_CASE(SensorEventPublisher_NothingSentAfterStop, SensorEventPublisherUnitTest)
+{
+    auto publisher = std::make_shared<SensorEventPublisher>(strand_, channelMock_, nullptr, std::chrono::milliseconds(1));
+
+    EXPECT_CALL(*channelMock_, sendSensorEventIndication(_, _)).Times(0);
+
+    publisher->publish(speed(50));
+    strand_.post([publisher]() { publisher->stop(); });
+    ioService_.run();
+}
+
+}
+}
+}
+}
+}
@@ -32,15 +32,15 @@ namespace channel
 namespace sensor
 {
 
-SensorServiceChannel::SensorServiceChannel(boost::asio::io_service::strand& strand,  messenger::IMessenger::Pointer messenger)
-    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::SENSOR)
+SensorServiceChannel::SensorServiceChannel(boost::asio::io_service::strand& strand,  messenger::IMessenger::Pointer messenger, io::DispatchMode dispatchMode)
+    : ServiceChannel(strand, std::move(messenger), messenger::ChannelId::SENSOR, dispatchMode)
 {
 
 }
 
 void SensorServiceChannel::receive(ISensorServiceChannelEventHandler::Pointer eventHandler)
 {
-    auto receivePromise = messenger::ReceivePromise::defer(strand_);
+    auto receivePromise = messenger::ReceivePromise::defer(strand_, dispatchMode_);
     receivePromise->then(std::bind(&SensorServiceChannel::messageHandler, this->shared_from_this(), std::placeholders::_1, eventHandler),
                         std::bind(&ISensorServiceChannelEventHandler::onChannelError, eventHandler, std::placeholders::_1));
 
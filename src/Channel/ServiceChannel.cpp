@@ -28,21 +28,39 @@ namespace channel
 
 ServiceChannel::ServiceChannel(boost::asio::io_service::strand& strand,
                                messenger::IMessenger::Pointer messenger,
-                               messenger::ChannelId channelId)
+                               messenger::ChannelId channelId,
+                               io::DispatchMode dispatchMode)
     : strand_(strand)
     , messenger_(std::move(messenger))
     , channelId_(channelId)
+    , dispatchMode_(dispatchMode)
 {
 
 }
 
 void ServiceChannel::send(messenger::Message::Pointer message, SendPromise::Pointer promise)
 {
-    auto sendPromise = messenger::SendPromise::defer(strand_.context());
+    auto sendPromise = dispatchMode_ == io::DispatchMode::INLINE ? messenger::SendPromise::defer(strand_, dispatchMode_)
+                                                                 : messenger::SendPromise::defer(strand_.context());
     io::PromiseLink<>::forward(*sendPromise, std::move(promise));
     messenger_->enqueueSend(std::move(message), std::move(sendPromise));
 }
 
+void ServiceChannel::send(messenger::Message::Pointer message, SendPromise::Pointer promise, std::function<void()> completionHandler)
+{
+    auto sendPromise = dispatchMode_ == io::DispatchMode::INLINE ? messenger::SendPromise::defer(strand_, dispatchMode_)
+                                                                 : messenger::SendPromise::defer(strand_.context());
+    sendPromise->then([promise, completionHandler]() {
+                          completionHandler();
+                          promise->resolve();
+                      },
+                      [promise, completionHandler](const error::Error& e) {
+                          completionHandler();
+                          promise->reject(e);
+                      });
+    messenger_->enqueueSend(std::move(message), std::move(sendPromise));
+}
+
 }
 }
 }
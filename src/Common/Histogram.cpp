@@ -0,0 +1,128 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <f1x/aasdk/Common/Histogram.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+Histogram::Histogram(Bounds upperBounds)
+    : upperBounds_(std::move(upperBounds))
+    , counts_(upperBounds_.size() + 1, 0)
+    , count_(0)
+    , min_(0)
+    , max_(0)
+    , sum_(0)
+{
+    std::sort(upperBounds_.begin(), upperBounds_.end());
+}
+
+void Histogram::record(ValueType value)
+{
+    const auto it = std::lower_bound(upperBounds_.begin(), upperBounds_.end(), value);
+    ++counts_[std::distance(upperBounds_.begin(), it)];
+
+    min_ = count_ == 0 ? value : std::min(min_, value);
+    max_ = count_ == 0 ? value : std::max(max_, value);
+    sum_ += value;
+    ++count_;
+}
+
+void Histogram::reset()
+{
+    std::fill(counts_.begin(), counts_.end(), 0);
+    count_ = 0;
+    min_ = 0;
+    max_ = 0;
+    sum_ = 0;
+}
+
+const Histogram::Bounds& Histogram::getUpperBounds() const
+{
+    return upperBounds_;
+}
+
+const Histogram::Counts& Histogram::getCounts() const
+{
+    return counts_;
+}
+
+uint64_t Histogram::getCount() const
+{
+    return count_;
+}
+
+Histogram::ValueType Histogram::getMin() const
+{
+    return min_;
+}
+
+Histogram::ValueType Histogram::getMax() const
+{
+    return max_;
+}
+
+double Histogram::getMean() const
+{
+    return count_ == 0 ? 0 : sum_ / count_;
+}
+
+Histogram::ValueType Histogram::getPercentile(double percentile) const
+{
+    if(count_ == 0)
+    {
+        return 0;
+    }
+
+    const auto rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(count_ * std::min(percentile, 100.0) / 100.0)));
+    uint64_t accumulated = 0;
+
+    for(size_t i = 0; i < upperBounds_.size(); ++i)
+    {
+        accumulated += counts_[i];
+
+        if(accumulated >= rank)
+        {
+            return std::min(upperBounds_[i], max_);
+        }
+    }
+
+    return max_;
+}
+
+Histogram::Bounds Histogram::getDefaultLatencyBounds()
+{
+    Bounds bounds;
+
+    for(ValueType bound = 250; bound <= 1024000; bound *= 2)
+    {
+        bounds.push_back(bound);
+    }
+
+    return bounds;
+}
+
+}
+}
+}
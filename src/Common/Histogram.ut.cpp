@@ -0,0 +1,106 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Common/Histogram.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(Histogram_CountsIntoBuckets)
+{
+    Histogram histogram({40, 10, 20});
+    BOOST_TEST(histogram.getUpperBounds() == Histogram::Bounds({10, 20, 40}), boost::test_tools::per_element());
+
+    for(auto value : {5, 10, 15, 30, 100})
+    {
+        histogram.record(value);
+    }
+
+    // a value equal to a bound lands in that bound's bucket, 100 overflows
+    BOOST_TEST(histogram.getCounts() == Histogram::Counts({2, 1, 1, 1}), boost::test_tools::per_element());
+    BOOST_TEST(histogram.getCount() == 5u);
+    BOOST_TEST(histogram.getMin() == 5u);
+    BOOST_TEST(histogram.getMax() == 100u);
+    BOOST_TEST(histogram.getMean() == 32.0);
+}
+
+BOOST_AUTO_TEST_CASE(Histogram_PercentileIsBucketUpperBound)
+{
+    Histogram histogram({10, 20, 40});
+
+    for(auto value : {5, 10, 15, 30, 100})
+    {
+        histogram.record(value);
+    }
+
+    BOOST_TEST(histogram.getPercentile(0) == 10u);
+    BOOST_TEST(histogram.getPercentile(40) == 10u);
+    BOOST_TEST(histogram.getPercentile(50) == 20u);
+    BOOST_TEST(histogram.getPercentile(80) == 40u);
+    // the overflow bucket reports the largest sample
+    BOOST_TEST(histogram.getPercentile(90) == 100u);
+    BOOST_TEST(histogram.getPercentile(100) == 100u);
+}
+
+BOOST_AUTO_TEST_CASE(Histogram_PercentileNeverExceedsMax)
+{
+    Histogram histogram({10, 20});
+    histogram.record(3);
+    histogram.record(4);
+
+    BOOST_TEST(histogram.getPercentile(50) == 4u);
+    BOOST_TEST(histogram.getPercentile(99) == 4u);
+}
+
+BOOST_AUTO_TEST_CASE(Histogram_Reset)
+{
+    Histogram histogram({10});
+    histogram.record(7);
+    histogram.record(70);
+    histogram.reset();
+
+    BOOST_TEST(histogram.getCount() == 0u);
+    BOOST_TEST(histogram.getCounts() == Histogram::Counts({0, 0}), boost::test_tools::per_element());
+    BOOST_TEST(histogram.getMean() == 0.0);
+    BOOST_TEST(histogram.getPercentile(50) == 0u);
+
+    histogram.record(8);
+    BOOST_TEST(histogram.getMin() == 8u);
+    BOOST_TEST(histogram.getMax() == 8u);
+}
+
+BOOST_AUTO_TEST_CASE(Histogram_DefaultLatencyBounds)
+{
+    const auto bounds = Histogram::getDefaultLatencyBounds();
+
+    BOOST_TEST(bounds.size() == 13u);
+    BOOST_TEST(bounds.front() == 250u);
+    BOOST_TEST(bounds.back() == 1024000u);
+}
+
+}
+}
+}
+}
@@ -0,0 +1,84 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Common/MemoryBudget.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace common
+{
+
+MemoryBudget::MemoryBudget(size_t limit)
+    : limit_(limit)
+    , usage_(0)
+    , peakUsage_(0)
+    , rejectionCount_(0)
+{
+
+}
+
+bool MemoryBudget::tryAcquire(size_t size)
+{
+    auto usage = usage_.load();
+
+    do
+    {
+        if(limit_ != 0 && (size > limit_ || usage > limit_ - size))
+        {
+            ++rejectionCount_;
+            return false;
+        }
+    }
+    while(!usage_.compare_exchange_weak(usage, usage + size));
+
+    auto peakUsage = peakUsage_.load();
+    while(peakUsage < usage + size && !peakUsage_.compare_exchange_weak(peakUsage, usage + size));
+
+    return true;
+}
+
+void MemoryBudget::release(size_t size)
+{
+    usage_ -= size;
+}
+
+size_t MemoryBudget::getLimit() const
+{
+    return limit_;
+}
+
+size_t MemoryBudget::getUsage() const
+{
+    return usage_;
+}
+
+size_t MemoryBudget::getPeakUsage() const
+{
+    return peakUsage_;
+}
+
+uint64_t MemoryBudget::getRejectionCount() const
+{
+    return rejectionCount_;
+}
+
+}
+}
+}
@@ -0,0 +1,156 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <aasdk_proto/AVChannelSetupResponseMessage.pb.h>
+#include <aasdk_proto/AVMediaAckIndicationMessage.pb.h>
+#include <aasdk_proto/ChannelOpenResponseMessage.pb.h>
+#include <f1x/aasdk/Emulator/AVChannelResponder.hpp>
+#include <f1x/aasdk/IO/SimulationClock.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace emulator
+{
+
+AVChannelResponder::AVChannelResponder(boost::asio::io_service::strand& strand, channel::av::IVideoServiceChannel::Pointer channel, uint32_t maxUnacked, ErrorHandler errorHandler)
+    : strand_(strand)
+    , videoChannel_(std::move(channel))
+    , maxUnacked_(maxUnacked)
+    , errorHandler_(std::move(errorHandler))
+    , session_(0)
+{
+
+}
+
+AVChannelResponder::AVChannelResponder(boost::asio::io_service::strand& strand, channel::av::IAudioServiceChannel::Pointer channel, uint32_t maxUnacked, ErrorHandler errorHandler)
+    : strand_(strand)
+    , audioChannel_(std::move(channel))
+    , maxUnacked_(maxUnacked)
+    , errorHandler_(std::move(errorHandler))
+    , session_(0)
+{
+
+}
+
+template<typename Function>
+void AVChannelResponder::withChannel(Function function)
+{
+    if(videoChannel_ != nullptr)
+    {
+        function(*videoChannel_);
+    }
+    else
+    {
+        function(*audioChannel_);
+    }
+}
+
+void AVChannelResponder::start()
+{
+    this->receive();
+}
+
+const AVChannelResponderStatistics& AVChannelResponder::getStatistics() const
+{
+    return statistics_;
+}
+
+void AVChannelResponder::receive()
+{
+    this->withChannel([this](auto& channel) { channel.receive(this->shared_from_this()); });
+}
+
+void AVChannelResponder::onChannelOpenRequest(const proto::messages::ChannelOpenRequest&)
+{
+    proto::messages::ChannelOpenResponse response;
+    response.set_status(proto::enums::Status::OK);
+
+    this->withChannel([this, &response](auto& channel) { channel.sendChannelOpenResponse(response, this->createSendPromise()); });
+    this->receive();
+}
+
+void AVChannelResponder::onAVChannelSetupRequest(const proto::messages::AVChannelSetupRequest&)
+{
+    proto::messages::AVChannelSetupResponse response;
+    response.set_media_status(proto::enums::AVChannelSetupStatus::OK);
+    response.set_max_unacked(maxUnacked_);
+    response.add_configs(0);
+
+    this->withChannel([this, &response](auto& channel) { channel.sendAVChannelSetupResponse(response, this->createSendPromise()); });
+    this->receive();
+}
+
+void AVChannelResponder::onAVChannelStartIndication(const proto::messages::AVChannelStartIndication& indication)
+{
+    session_ = indication.session();
+    this->receive();
+}
+
+void AVChannelResponder::onAVChannelStopIndication(const proto::messages::AVChannelStopIndication&)
+{
+    this->receive();
+}
+
+void AVChannelResponder::onAVMediaWithTimestampIndication(messenger::Timestamp::ValueType timestamp, const common::DataConstBuffer& buffer)
+{
+    const auto now = std::chrono::duration_cast<std::chrono::microseconds>(io::SimulationClock::now().time_since_epoch()).count();
+    statistics_.latency.record(static_cast<uint64_t>(now) > timestamp ? now - timestamp : 0);
+    this->onMedia(buffer.size);
+}
+
+void AVChannelResponder::onAVMediaIndication(const common::DataConstBuffer& buffer)
+{
+    this->onMedia(buffer.size);
+}
+
+void AVChannelResponder::onMedia(size_t size)
+{
+    ++statistics_.receivedFrames;
+    statistics_.receivedBytes += size;
+
+    proto::messages::AVMediaAckIndication indication;
+    indication.set_session(session_);
+    indication.set_value(1);
+
+    this->withChannel([this, &indication](auto& channel) { channel.sendAVMediaAckIndication(indication, this->createSendPromise()); });
+    this->receive();
+}
+
+void AVChannelResponder::onVideoFocusRequest(const proto::messages::VideoFocusRequest&)
+{
+    this->receive();
+}
+
+void AVChannelResponder::onChannelError(const error::Error& e)
+{
+    errorHandler_(e);
+}
+
+channel::SendPromise::Pointer AVChannelResponder::createSendPromise()
+{
+    auto promise = channel::SendPromise::defer(strand_);
+    promise->then([]() {}, std::bind(&AVChannelResponder::onChannelError, this->shared_from_this(), std::placeholders::_1));
+    return promise;
+}
+
+}
+}
+}
@@ -0,0 +1,265 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <aasdk_proto/AuthCompleteIndicationMessage.pb.h>
+#include <aasdk_proto/ServiceDiscoveryResponseMessage.pb.h>
+#include <f1x/aasdk/Emulator/HeadUnitResponder.hpp>
+#include <f1x/aasdk/Channel/Control/ControlServiceChannel.hpp>
+#include <f1x/aasdk/Channel/AV/VideoServiceChannel.hpp>
+#include <f1x/aasdk/Channel/AV/MediaAudioServiceChannel.hpp>
+#include <f1x/aasdk/Channel/AV/SpeechAudioServiceChannel.hpp>
+#include <f1x/aasdk/Channel/AV/SystemAudioServiceChannel.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace emulator
+{
+
+HeadUnitResponder::HeadUnitResponder(boost::asio::io_service& ioService, messenger::IMessenger::Pointer messenger, messenger::ICryptor::Pointer cryptor,
+                                     ErrorHandler errorHandler, HeadUnitResponderConfiguration configuration)
+    : strand_(ioService)
+    , messenger_(std::move(messenger))
+    , cryptor_(std::move(cryptor))
+    , errorHandler_(std::move(errorHandler))
+    , configuration_(std::move(configuration))
+    , controlServiceChannel_(std::make_shared<channel::control::ControlServiceChannel>(strand_, messenger_))
+{
+
+}
+
+void HeadUnitResponder::start()
+{
+    strand_.dispatch([this, self = this->shared_from_this()]() {
+        try
+        {
+            cryptor_->init();
+        }
+        catch(const error::Error& e)
+        {
+            errorHandler_(e);
+            return;
+        }
+
+        controlServiceChannel_->receive(this->shared_from_this());
+        controlServiceChannel_->sendVersionRequest(this->createSendPromise());
+    });
+}
+
+std::map<messenger::ChannelId, AVChannelResponderStatistics> HeadUnitResponder::getStatistics() const
+{
+    std::map<messenger::ChannelId, AVChannelResponderStatistics> statistics;
+
+    for(const auto& avChannelResponder : avChannelResponders_)
+    {
+        statistics.emplace(avChannelResponder.first, avChannelResponder.second->getStatistics());
+    }
+
+    return statistics;
+}
+
+void HeadUnitResponder::onVersionResponse(uint16_t majorCode, uint16_t minorCode, proto::enums::VersionResponseStatus::Enum status)
+{
+    if(status == proto::enums::VersionResponseStatus::MISMATCH)
+    {
+        AASDK_LOG(error) << "[HeadUnitResponder] version mismatch, phone version: " << majorCode << "." << minorCode;
+        errorHandler_(error::Error(error::ErrorCode::REQUEST_REJECTED));
+        return;
+    }
+
+    try
+    {
+        cryptor_->doHandshake();
+        this->sendHandshake();
+    }
+    catch(const error::Error& e)
+    {
+        errorHandler_(e);
+        return;
+    }
+
+    controlServiceChannel_->receive(this->shared_from_this());
+}
+
+void HeadUnitResponder::onHandshake(const common::DataConstBuffer& payload)
+{
+    try
+    {
+        cryptor_->writeHandshakeBuffer(payload);
+        const bool finished = cryptor_->doHandshake();
+
+        // with TLS 1.3 the client still has its Finished message to send
+        this->sendHandshake();
+
+        if(finished)
+        {
+            proto::messages::AuthCompleteIndication indication;
+            indication.set_status(proto::enums::Status::OK);
+            controlServiceChannel_->sendAuthComplete(indication, this->createSendPromise());
+        }
+    }
+    catch(const error::Error& e)
+    {
+        errorHandler_(e);
+        return;
+    }
+
+    controlServiceChannel_->receive(this->shared_from_this());
+}
+
+void HeadUnitResponder::sendHandshake()
+{
+    auto handshakeBuffer = cryptor_->readHandshakeBuffer();
+    if(!handshakeBuffer.empty())
+    {
+        controlServiceChannel_->sendHandshake(std::move(handshakeBuffer), this->createSendPromise());
+    }
+}
+
+void HeadUnitResponder::onServiceDiscoveryRequest(const proto::messages::ServiceDiscoveryRequest& request)
+{
+    AASDK_LOG(info) << "[HeadUnitResponder] service discovery request from " << request.device_brand() << " " << request.device_name();
+
+    proto::messages::ServiceDiscoveryResponse response;
+    response.set_head_unit_name("aasdk head unit responder");
+    response.set_car_model("aasdk");
+    response.set_car_year("2018");
+    response.set_car_serial("0");
+    response.set_left_hand_drive_vehicle(true);
+    response.set_headunit_manufacturer("f1x");
+    response.set_headunit_model("aasdk");
+    response.set_sw_build("1");
+    response.set_sw_version("1.0");
+    response.set_can_play_native_media_during_vr(false);
+
+    for(const auto channelId : configuration_.avChannels)
+    {
+        auto avChannelResponder = this->createAVChannelResponder(channelId, *response.add_channels());
+
+        if(avChannelResponder != nullptr)
+        {
+            // channel messages are queued by the messenger, starting before the response is sent only saves a round
+            avChannelResponder->start();
+            avChannelResponders_[channelId] = std::move(avChannelResponder);
+        }
+        else
+        {
+            response.mutable_channels()->RemoveLast();
+        }
+    }
+
+    controlServiceChannel_->sendServiceDiscoveryResponse(response, this->createSendPromise());
+    controlServiceChannel_->receive(this->shared_from_this());
+}
+
+AVChannelResponder::Pointer HeadUnitResponder::createAVChannelResponder(messenger::ChannelId channelId, proto::data::ChannelDescriptor& channelDescriptor)
+{
+    channelDescriptor.set_channel_id(static_cast<uint32_t>(channelId));
+    auto* avChannel = channelDescriptor.mutable_av_channel();
+
+    if(channelId == messenger::ChannelId::VIDEO)
+    {
+        avChannel->set_stream_type(proto::enums::AVStreamType::VIDEO);
+        avChannel->set_available_while_in_call(true);
+
+        auto* videoConfig = avChannel->add_video_configs();
+        videoConfig->set_video_resolution(proto::enums::VideoResolution::_480p);
+        videoConfig->set_video_fps(proto::enums::VideoFPS::_30);
+        videoConfig->set_margin_width(0);
+        videoConfig->set_margin_height(0);
+        videoConfig->set_dpi(140);
+
+        return std::make_shared<AVChannelResponder>(strand_, std::make_shared<channel::av::VideoServiceChannel>(strand_, messenger_), configuration_.maxUnacked, errorHandler_);
+    }
+
+    channel::av::IAudioServiceChannel::Pointer audioChannel;
+    auto* audioConfig = avChannel->add_audio_configs();
+    avChannel->set_stream_type(proto::enums::AVStreamType::AUDIO);
+    avChannel->set_available_while_in_call(true);
+    audioConfig->set_bit_depth(16);
+
+    switch(channelId)
+    {
+    case messenger::ChannelId::MEDIA_AUDIO:
+        avChannel->set_audio_type(proto::enums::AudioType::MEDIA);
+        audioConfig->set_sample_rate(48000);
+        audioConfig->set_channel_count(2);
+        audioChannel = std::make_shared<channel::av::MediaAudioServiceChannel>(strand_, messenger_);
+        break;
+    case messenger::ChannelId::SPEECH_AUDIO:
+        avChannel->set_audio_type(proto::enums::AudioType::SPEECH);
+        audioConfig->set_sample_rate(16000);
+        audioConfig->set_channel_count(1);
+        audioChannel = std::make_shared<channel::av::SpeechAudioServiceChannel>(strand_, messenger_);
+        break;
+    case messenger::ChannelId::SYSTEM_AUDIO:
+        avChannel->set_audio_type(proto::enums::AudioType::SYSTEM);
+        audioConfig->set_sample_rate(16000);
+        audioConfig->set_channel_count(1);
+        audioChannel = std::make_shared<channel::av::SystemAudioServiceChannel>(strand_, messenger_);
+        break;
+    default:
+        AASDK_LOG(error) << "[HeadUnitResponder] " << messenger::channelIdToString(channelId) << " is not an AV channel";
+        return nullptr;
+    }
+
+    return std::make_shared<AVChannelResponder>(strand_, std::move(audioChannel), configuration_.maxUnacked, errorHandler_);
+}
+
+void HeadUnitResponder::onAudioFocusRequest(const proto::messages::AudioFocusRequest&)
+{
+    controlServiceChannel_->receive(this->shared_from_this());
+}
+
+void HeadUnitResponder::onShutdownRequest(const proto::messages::ShutdownRequest&)
+{
+    controlServiceChannel_->receive(this->shared_from_this());
+}
+
+void HeadUnitResponder::onShutdownResponse(const proto::messages::ShutdownResponse&)
+{
+    controlServiceChannel_->receive(this->shared_from_this());
+}
+
+void HeadUnitResponder::onNavigationFocusRequest(const proto::messages::NavigationFocusRequest&)
+{
+    controlServiceChannel_->receive(this->shared_from_this());
+}
+
+void HeadUnitResponder::onPingResponse(const proto::messages::PingResponse&)
+{
+    controlServiceChannel_->receive(this->shared_from_this());
+}
+
+void HeadUnitResponder::onChannelError(const error::Error& e)
+{
+    errorHandler_(e);
+}
+
+channel::SendPromise::Pointer HeadUnitResponder::createSendPromise()
+{
+    auto promise = channel::SendPromise::defer(strand_);
+    promise->then([]() {}, std::bind(&HeadUnitResponder::onChannelError, this->shared_from_this(), std::placeholders::_1));
+    return promise;
+}
+
+}
+}
+}
@@ -0,0 +1,510 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <aasdk_proto/ControlMessageIdsEnum.pb.h>
+#include <aasdk_proto/AVChannelMessageIdsEnum.pb.h>
+#include <aasdk_proto/AuthCompleteIndicationMessage.pb.h>
+#include <aasdk_proto/ServiceDiscoveryRequestMessage.pb.h>
+#include <aasdk_proto/ServiceDiscoveryResponseMessage.pb.h>
+#include <aasdk_proto/ChannelOpenRequestMessage.pb.h>
+#include <aasdk_proto/ChannelOpenResponseMessage.pb.h>
+#include <aasdk_proto/AVChannelSetupRequestMessage.pb.h>
+#include <aasdk_proto/AVChannelSetupResponseMessage.pb.h>
+#include <aasdk_proto/AVChannelStartIndicationMessage.pb.h>
+#include <aasdk_proto/AVChannelStopIndicationMessage.pb.h>
+#include <aasdk_proto/AVMediaAckIndicationMessage.pb.h>
+#include <aasdk_proto/PingRequestMessage.pb.h>
+#include <aasdk_proto/PingResponseMessage.pb.h>
+#include <aasdk_proto/VersionResponseStatusEnum.pb.h>
+#include <f1x/aasdk/Emulator/PhoneEmulator.hpp>
+#include <f1x/aasdk/Messenger/MessageId.hpp>
+#include <f1x/aasdk/Messenger/Timestamp.hpp>
+#include <f1x/aasdk/Error/Error.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace emulator
+{
+
+PhoneEmulator::Stream::Stream(boost::asio::io_service& ioService, const MediaStreamConfiguration& configuration)
+    : configuration(configuration)
+    , frameInterval(configuration.bitrate == 0 ? Clock::duration::zero()
+                                               : std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(configuration.frameSize * 8.0 / configuration.bitrate)))
+    , frameTimer(ioService)
+    , started(false)
+    , stalled(false)
+{
+    report.channelId = configuration.channelId;
+}
+
+PhoneEmulator::PhoneEmulator(boost::asio::io_service& ioService, messenger::IMessenger::Pointer messenger, messenger::ICryptor::Pointer cryptor,
+                             PhoneEmulatorConfiguration configuration)
+    : strand_(ioService)
+    , streamingTimer_(ioService)
+    , messenger_(std::move(messenger))
+    , cryptor_(std::move(cryptor))
+    , configuration_(std::move(configuration))
+{
+
+}
+
+void PhoneEmulator::start(Promise::Pointer promise)
+{
+    strand_.dispatch([this, self = this->shared_from_this(), promise = std::move(promise)]() mutable {
+        if(promise_ != nullptr)
+        {
+            promise->reject(error::Error(error::ErrorCode::OPERATION_IN_PROGRESS));
+            return;
+        }
+
+        promise_ = std::move(promise);
+        report_ = PhoneEmulatorReport();
+        streams_.clear();
+
+        size_t maxFrameSize = 0;
+        for(const auto& streamConfiguration : configuration_.streams)
+        {
+            streams_.emplace_back(strand_.context(), streamConfiguration);
+            maxFrameSize = std::max(maxFrameSize, streamConfiguration.frameSize);
+        }
+
+        framePayload_.assign(maxFrameSize, 0);
+        for(size_t i = 0; i < framePayload_.size(); ++i)
+        {
+            framePayload_[i] = static_cast<uint8_t>(i);
+        }
+
+        try
+        {
+            cryptor_->init();
+        }
+        catch(const error::Error& e)
+        {
+            this->fail(e);
+            return;
+        }
+
+        this->receive(messenger::ChannelId::CONTROL);
+    });
+}
+
+void PhoneEmulator::stop()
+{
+    strand_.dispatch([this, self = this->shared_from_this()]() {
+        this->fail(error::Error(error::ErrorCode::OPERATION_ABORTED));
+    });
+}
+
+void PhoneEmulator::receive(messenger::ChannelId channelId)
+{
+    auto promise = messenger::ReceivePromise::defer(strand_);
+    promise->then(std::bind(&PhoneEmulator::messageHandler, this->shared_from_this(), std::placeholders::_1),
+                  std::bind(&PhoneEmulator::fail, this->shared_from_this(), std::placeholders::_1));
+
+    messenger_->enqueueReceive(channelId, std::move(promise));
+}
+
+void PhoneEmulator::messageHandler(messenger::Message::Pointer message)
+{
+    if(promise_ == nullptr)
+    {
+        return;
+    }
+
+    messenger::MessageId messageId(message->getPayload());
+    common::DataConstBuffer payload(message->getPayload(), messageId.getSizeOf());
+
+    try
+    {
+        if(message->getChannelId() == messenger::ChannelId::CONTROL)
+        {
+            this->handleControlMessage(messageId.getId(), payload);
+        }
+        else
+        {
+            auto stream = this->findStream(message->getChannelId());
+            if(stream != streams_.end())
+            {
+                this->handleStreamMessage(*stream, messageId.getId(), payload);
+            }
+        }
+    }
+    catch(const error::Error& e)
+    {
+        this->fail(e);
+    }
+
+    if(promise_ != nullptr)
+    {
+        this->receive(message->getChannelId());
+    }
+}
+
+void PhoneEmulator::handleControlMessage(uint16_t messageId, const common::DataConstBuffer& payload)
+{
+    switch(messageId)
+    {
+    case proto::ids::ControlMessage::VERSION_REQUEST:
+    {
+        versionRequestTime_ = Clock::now();
+
+        // echo the requested version, status is not byte swapped by the head unit
+        common::Data versionBuffer(payload.cdata, payload.cdata + std::min<size_t>(payload.size, 4));
+        versionBuffer.resize(6, 0);
+        const uint16_t status = proto::enums::VersionResponseStatus::MATCH;
+        std::memcpy(&versionBuffer[4], &status, sizeof(status));
+
+        auto message(std::make_shared<messenger::Message>(messenger::ChannelId::CONTROL, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC));
+        message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::VERSION_RESPONSE).getData());
+        message->insertPayload(versionBuffer);
+        this->send(std::move(message));
+        break;
+    }
+    case proto::ids::ControlMessage::SSL_HANDSHAKE:
+        this->handleHandshake(payload);
+        break;
+    case proto::ids::ControlMessage::AUTH_COMPLETE:
+    {
+        proto::messages::AuthCompleteIndication indication;
+        if(!indication.ParseFromArray(payload.cdata, payload.size))
+        {
+            throw error::Error(error::ErrorCode::PARSE_PAYLOAD);
+        }
+        else if(indication.status() != proto::enums::Status::OK)
+        {
+            throw error::Error(error::ErrorCode::SSL_HANDSHAKE, indication.status());
+        }
+
+        authCompleteTime_ = Clock::now();
+        report_.handshakeDuration = std::chrono::duration_cast<std::chrono::microseconds>(authCompleteTime_ - versionRequestTime_);
+
+        proto::messages::ServiceDiscoveryRequest request;
+        request.set_device_name(configuration_.deviceName);
+        request.set_device_brand(configuration_.deviceBrand);
+
+        auto message(std::make_shared<messenger::Message>(messenger::ChannelId::CONTROL, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
+        message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::SERVICE_DISCOVERY_REQUEST).getData());
+        message->insertPayload(request);
+        this->send(std::move(message));
+        break;
+    }
+    case proto::ids::ControlMessage::SERVICE_DISCOVERY_RESPONSE:
+        this->handleServiceDiscoveryResponse(payload);
+        break;
+    case proto::ids::ControlMessage::PING_REQUEST:
+    {
+        proto::messages::PingRequest request;
+        if(request.ParseFromArray(payload.cdata, payload.size))
+        {
+            proto::messages::PingResponse response;
+            response.set_timestamp(request.timestamp());
+
+            auto message(std::make_shared<messenger::Message>(messenger::ChannelId::CONTROL, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC));
+            message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::PING_RESPONSE).getData());
+            message->insertPayload(response);
+            this->send(std::move(message));
+        }
+        break;
+    }
+    default:
+        AASDK_LOG(debug) << "[PhoneEmulator] control message not handled: " << messageId;
+        break;
+    }
+}
+
+void PhoneEmulator::handleHandshake(const common::DataConstBuffer& payload)
+{
+    cryptor_->writeHandshakeBuffer(payload);
+    cryptor_->doHandshake();
+
+    // the server flight, or its Finished message once the client's arrived
+    auto handshakeBuffer = cryptor_->readHandshakeBuffer();
+    if(!handshakeBuffer.empty())
+    {
+        auto message(std::make_shared<messenger::Message>(messenger::ChannelId::CONTROL, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC));
+        message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::SSL_HANDSHAKE).getData());
+        message->insertPayload(handshakeBuffer);
+        this->send(std::move(message));
+    }
+}
+
+void PhoneEmulator::handleServiceDiscoveryResponse(const common::DataConstBuffer& payload)
+{
+    proto::messages::ServiceDiscoveryResponse response;
+    if(!response.ParseFromArray(payload.cdata, payload.size))
+    {
+        throw error::Error(error::ErrorCode::PARSE_PAYLOAD);
+    }
+
+    for(auto stream = streams_.begin(); stream != streams_.end();)
+    {
+        const auto channelId = static_cast<uint32_t>(stream->configuration.channelId);
+        const auto& channels = response.channels();
+        const bool advertised = std::any_of(channels.begin(), channels.end(), [channelId](const proto::data::ChannelDescriptor& channel) {
+            return channel.channel_id() == channelId && channel.has_av_channel();
+        });
+
+        if(advertised)
+        {
+            ++stream;
+        }
+        else
+        {
+            AASDK_LOG(info) << "[PhoneEmulator] head unit does not offer " << messenger::channelIdToString(stream->configuration.channelId) << ", stream skipped";
+            stream = streams_.erase(stream);
+        }
+    }
+
+    if(streams_.empty())
+    {
+        this->startStreaming();
+        return;
+    }
+
+    for(const auto& stream : streams_)
+    {
+        proto::messages::ChannelOpenRequest request;
+        request.set_priority(0);
+        request.set_channel_id(static_cast<int32_t>(stream.configuration.channelId));
+
+        auto message(std::make_shared<messenger::Message>(stream.configuration.channelId, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::CONTROL));
+        message->insertPayload(messenger::MessageId(proto::ids::ControlMessage::CHANNEL_OPEN_REQUEST).getData());
+        message->insertPayload(request);
+        this->send(std::move(message));
+        this->receive(stream.configuration.channelId);
+    }
+}
+
+void PhoneEmulator::handleStreamMessage(Stream& stream, uint16_t messageId, const common::DataConstBuffer& payload)
+{
+    switch(messageId)
+    {
+    case proto::ids::ControlMessage::CHANNEL_OPEN_RESPONSE:
+    {
+        proto::messages::ChannelOpenResponse response;
+        if(!response.ParseFromArray(payload.cdata, payload.size))
+        {
+            throw error::Error(error::ErrorCode::PARSE_PAYLOAD);
+        }
+        else if(response.status() != proto::enums::Status::OK)
+        {
+            throw error::Error(error::ErrorCode::REQUEST_REJECTED, response.status());
+        }
+
+        proto::messages::AVChannelSetupRequest request;
+        request.set_config_index(0);
+
+        auto message(std::make_shared<messenger::Message>(stream.configuration.channelId, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
+        message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::SETUP_REQUEST).getData());
+        message->insertPayload(request);
+        this->send(std::move(message));
+        break;
+    }
+    case proto::ids::AVChannelMessage::SETUP_RESPONSE:
+        this->handleAVChannelSetupResponse(stream, payload);
+        break;
+    case proto::ids::AVChannelMessage::AV_MEDIA_ACK_INDICATION:
+        this->handleAVMediaAckIndication(stream, payload);
+        break;
+    default:
+        AASDK_LOG(debug) << "[PhoneEmulator] " << messenger::channelIdToString(stream.configuration.channelId) << " message not handled: " << messageId;
+        break;
+    }
+}
+
+void PhoneEmulator::handleAVChannelSetupResponse(Stream& stream, const common::DataConstBuffer& payload)
+{
+    proto::messages::AVChannelSetupResponse response;
+    if(!response.ParseFromArray(payload.cdata, payload.size))
+    {
+        throw error::Error(error::ErrorCode::PARSE_PAYLOAD);
+    }
+    else if(response.media_status() != proto::enums::AVChannelSetupStatus::OK)
+    {
+        throw error::Error(error::ErrorCode::REQUEST_REJECTED, response.media_status());
+    }
+
+    stream.report.maxUnacked = std::max<uint32_t>(response.max_unacked(), 1);
+
+    proto::messages::AVChannelStartIndication indication;
+    indication.set_session(static_cast<int32_t>(std::distance(streams_.begin(), this->findStream(stream.configuration.channelId))));
+    indication.set_config(0);
+
+    auto message(std::make_shared<messenger::Message>(stream.configuration.channelId, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
+    message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::START_INDICATION).getData());
+    message->insertPayload(indication);
+    this->send(std::move(message));
+
+    stream.started = true;
+
+    if(std::all_of(streams_.begin(), streams_.end(), [](const Stream& item) { return item.started; }))
+    {
+        this->startStreaming();
+    }
+}
+
+void PhoneEmulator::handleAVMediaAckIndication(Stream& stream, const common::DataConstBuffer& payload)
+{
+    proto::messages::AVMediaAckIndication indication;
+    if(!indication.ParseFromArray(payload.cdata, payload.size))
+    {
+        throw error::Error(error::ErrorCode::PARSE_PAYLOAD);
+    }
+
+    const auto now = Clock::now();
+    const auto ackedFrames = std::min<size_t>(std::max<uint32_t>(indication.value(), 1), stream.unackedFrames.size());
+
+    for(size_t i = 0; i < ackedFrames; ++i)
+    {
+        stream.report.ackLatency.record(std::chrono::duration_cast<std::chrono::microseconds>(now - stream.unackedFrames.front()).count());
+        stream.unackedFrames.pop_front();
+    }
+
+    stream.report.ackedFrames += ackedFrames;
+    stream.report.ackedBytes += ackedFrames * stream.configuration.frameSize;
+
+    if(stream.stalled && ackedFrames > 0)
+    {
+        // the frame that found the window full goes out now, pacing restarts from here
+        stream.stalled = false;
+        this->sendFrame(stream, now);
+        stream.nextFrameTime = now + stream.frameInterval;
+        this->scheduleFrame(stream);
+    }
+}
+
+void PhoneEmulator::startStreaming()
+{
+    streamingStartTime_ = Clock::now();
+    report_.setupDuration = std::chrono::duration_cast<std::chrono::microseconds>(streamingStartTime_ - authCompleteTime_);
+
+    for(auto& stream : streams_)
+    {
+        stream.nextFrameTime = streamingStartTime_;
+        this->scheduleFrame(stream);
+    }
+
+    streamingTimer_.expiresAfter(configuration_.streamingDuration);
+    streamingTimer_.asyncWait(strand_.wrap([this, self = this->shared_from_this()](const boost::system::error_code& e) {
+        if(e != boost::asio::error::operation_aborted)
+        {
+            this->finish();
+        }
+    }));
+}
+
+void PhoneEmulator::scheduleFrame(Stream& stream)
+{
+    stream.frameTimer.expiresAt(stream.nextFrameTime);
+    stream.frameTimer.asyncWait(strand_.wrap([this, self = this->shared_from_this(), &stream](const boost::system::error_code& e) {
+        if(e == boost::asio::error::operation_aborted || promise_ == nullptr)
+        {
+            return;
+        }
+
+        if(stream.unackedFrames.size() >= stream.report.maxUnacked)
+        {
+            ++stream.report.windowStalls;
+            stream.stalled = true;
+            return;
+        }
+
+        this->sendFrame(stream, Clock::now());
+        stream.nextFrameTime += stream.frameInterval;
+        this->scheduleFrame(stream);
+    }));
+}
+
+void PhoneEmulator::sendFrame(Stream& stream, Clock::time_point now)
+{
+    const auto timestamp = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
+
+    auto message(std::make_shared<messenger::Message>(stream.configuration.channelId, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
+    message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::AV_MEDIA_WITH_TIMESTAMP_INDICATION).getData());
+    message->insertPayload(messenger::Timestamp(timestamp).getData());
+    message->insertPayload(common::DataConstBuffer(framePayload_.data(), stream.configuration.frameSize));
+
+    stream.unackedFrames.push_back(now);
+    ++stream.report.sentFrames;
+    stream.report.sentBytes += stream.configuration.frameSize;
+
+    this->send(std::move(message));
+}
+
+void PhoneEmulator::finish()
+{
+    if(promise_ == nullptr)
+    {
+        return;
+    }
+
+    const auto now = Clock::now();
+    report_.streamingDuration = std::chrono::duration_cast<std::chrono::microseconds>(now - streamingStartTime_);
+    const auto seconds = std::chrono::duration<double>(now - streamingStartTime_).count();
+
+    for(auto& stream : streams_)
+    {
+        stream.frameTimer.cancel();
+
+        auto message(std::make_shared<messenger::Message>(stream.configuration.channelId, messenger::EncryptionType::ENCRYPTED, messenger::MessageType::SPECIFIC));
+        message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::STOP_INDICATION).getData());
+        message->insertPayload(proto::messages::AVChannelStopIndication());
+        this->send(std::move(message));
+
+        stream.report.throughput = seconds > 0 ? stream.report.ackedBytes / seconds : 0;
+        report_.streams.push_back(stream.report);
+    }
+
+    auto promise(std::move(promise_));
+    promise->resolve(std::move(report_));
+}
+
+void PhoneEmulator::fail(const error::Error& e)
+{
+    if(promise_ == nullptr)
+    {
+        return;
+    }
+
+    streamingTimer_.cancel();
+    std::for_each(streams_.begin(), streams_.end(), [](Stream& stream) { stream.frameTimer.cancel(); });
+
+    auto promise(std::move(promise_));
+    promise->reject(e);
+}
+
+void PhoneEmulator::send(messenger::Message::Pointer message)
+{
+    auto promise = messenger::SendPromise::defer(strand_);
+    promise->then([]() {}, std::bind(&PhoneEmulator::fail, this->shared_from_this(), std::placeholders::_1));
+    messenger_->enqueueSend(std::move(message), std::move(promise));
+}
+
+PhoneEmulator::Streams::iterator PhoneEmulator::findStream(messenger::ChannelId channelId)
+{
+    return std::find_if(streams_.begin(), streams_.end(), [channelId](const Stream& stream) { return stream.configuration.channelId == channelId; });
+}
+
+}
+}
+}
@@ -0,0 +1,175 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/USB/SimulatedUSBWrapper.hpp>
+#include <f1x/aasdk/USB/AOAPDevice.hpp>
+#include <f1x/aasdk/Transport/USBTransport.hpp>
+#include <f1x/aasdk/Transport/SimulatedPhoneTransport.hpp>
+#include <f1x/aasdk/Transport/SSLWrapper.hpp>
+#include <f1x/aasdk/Messenger/Cryptor.hpp>
+#include <f1x/aasdk/Messenger/MessageInStream.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+#include <f1x/aasdk/Messenger/Messenger.hpp>
+#include <f1x/aasdk/Emulator/PhoneEmulator.hpp>
+#include <f1x/aasdk/Emulator/HeadUnitResponder.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace emulator
+{
+namespace ut
+{
+
+class PhoneEmulatorUnitTest
+{
+protected:
+    PhoneEmulatorUnitTest()
+        : usbWrapper_(ioService_, createPhoneConfiguration())
+        , sslWrapper_(std::make_shared<transport::SSLWrapper>())
+        , headUnitCryptor_(std::make_shared<messenger::Cryptor>(sslWrapper_))
+        , phoneCryptor_(std::make_shared<messenger::Cryptor>(sslWrapper_, messenger::Cryptor::Role::SERVER))
+    {
+        usbWrapper_.connectPhone();
+        ioService_.run();
+        ioService_.reset();
+
+        auto aoapDevice = usb::AOAPDevice::create(usbWrapper_, ioService_, usbWrapper_.openDeviceWithVidPid(0x18D1, 0x2D00));
+        headUnitTransport_ = std::make_shared<transport::USBTransport>(ioService_, std::move(aoapDevice));
+        phoneTransport_ = std::make_shared<transport::SimulatedPhoneTransport>(ioService_, usbWrapper_);
+        headUnitMessenger_ = this->createMessenger(headUnitTransport_, headUnitCryptor_);
+        phoneMessenger_ = this->createMessenger(phoneTransport_, phoneCryptor_);
+    }
+
+    ~PhoneEmulatorUnitTest()
+    {
+        // fail everything still pending so that nothing is kept alive by its own handlers
+        headUnitMessenger_->stop();
+        phoneMessenger_->stop();
+        usbWrapper_.disconnectPhone();
+        phoneTransport_->stop();
+        headUnitResponder_.reset();
+        headUnitMessenger_.reset();
+        phoneMessenger_.reset();
+        headUnitTransport_.reset();
+        phoneTransport_.reset();
+        ioService_.run();
+
+        headUnitCryptor_->deinit();
+        phoneCryptor_->deinit();
+    }
+
+    static usb::SimulatedPhoneConfiguration createPhoneConfiguration()
+    {
+        // enumerate straight in accessory mode, the AOAP switch is covered by the wrapper tests
+        usb::SimulatedPhoneConfiguration configuration;
+        configuration.productId = 0x2D00;
+        configuration.bulkTransferLatency = std::chrono::microseconds(10);
+        return configuration;
+    }
+
+    static PhoneEmulatorConfiguration createEmulatorConfiguration()
+    {
+        PhoneEmulatorConfiguration configuration;
+        configuration.streams = {{messenger::ChannelId::VIDEO, 4000000, 16384}, {messenger::ChannelId::MEDIA_AUDIO, 1536000, 2048}};
+        configuration.streamingDuration = std::chrono::milliseconds(200);
+        return configuration;
+    }
+
+    messenger::IMessenger::Pointer createMessenger(transport::ITransport::Pointer transport, messenger::ICryptor::Pointer cryptor)
+    {
+        return std::make_shared<messenger::Messenger>(ioService_,
+                                                      std::make_shared<messenger::MessageInStream>(ioService_, transport, cryptor),
+                                                      std::make_shared<messenger::MessageOutStream>(ioService_, transport, cryptor));
+    }
+
+    void run(HeadUnitResponderConfiguration headUnitConfiguration)
+    {
+        headUnitResponder_ = std::make_shared<HeadUnitResponder>(ioService_, headUnitMessenger_, headUnitCryptor_,
+                                                                 [](const error::Error& e) { BOOST_TEST_MESSAGE(e.what()); }, std::move(headUnitConfiguration));
+        auto phoneEmulator = std::make_shared<PhoneEmulator>(ioService_, phoneMessenger_, phoneCryptor_, createEmulatorConfiguration());
+
+        auto promise = PhoneEmulator::Promise::defer(ioService_);
+        promise->then([this](PhoneEmulatorReport report) mutable {
+                report_ = std::move(report);
+                headUnitMessenger_->stop();
+                phoneMessenger_->stop();
+            },
+            [](const error::Error& e) { BOOST_FAIL(e.what()); });
+
+        headUnitResponder_->start();
+        phoneEmulator->start(std::move(promise));
+
+        ioService_.run();
+        ioService_.reset();
+    }
+
+    boost::asio::io_service ioService_;
+    usb::SimulatedUSBWrapper usbWrapper_;
+    transport::ISSLWrapper::Pointer sslWrapper_;
+    messenger::ICryptor::Pointer headUnitCryptor_;
+    messenger::ICryptor::Pointer phoneCryptor_;
+    transport::ITransport::Pointer headUnitTransport_;
+    transport::ITransport::Pointer phoneTransport_;
+    messenger::IMessenger::Pointer headUnitMessenger_;
+    messenger::IMessenger::Pointer phoneMessenger_;
+    HeadUnitResponder::Pointer headUnitResponder_;
+    PhoneEmulatorReport report_;
+};
+
+BOOST_FIXTURE_TEST_CASE(PhoneEmulator_StreamsToHeadUnit, PhoneEmulatorUnitTest)
+{
+    this->run(HeadUnitResponderConfiguration());
+
+    BOOST_TEST(report_.handshakeDuration.count() > 0);
+    BOOST_CHECK(report_.streamingDuration >= std::chrono::milliseconds(200));
+    BOOST_REQUIRE(report_.streams.size() == 2);
+
+    const auto headUnitStatistics = headUnitResponder_->getStatistics();
+
+    for(const auto& stream : report_.streams)
+    {
+        BOOST_TEST(stream.maxUnacked == 10);
+        BOOST_TEST(stream.sentFrames > 0);
+        BOOST_TEST(stream.ackedFrames > 0);
+        BOOST_TEST(stream.ackLatency.getCount() == stream.ackedFrames);
+        BOOST_TEST(stream.throughput > 0);
+
+        const auto& channelStatistics = headUnitStatistics.at(stream.channelId);
+        BOOST_TEST(channelStatistics.receivedFrames >= stream.ackedFrames);
+        BOOST_TEST(channelStatistics.latency.getCount() == channelStatistics.receivedFrames);
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(PhoneEmulator_SkipsChannelsNotOffered, PhoneEmulatorUnitTest)
+{
+    HeadUnitResponderConfiguration headUnitConfiguration;
+    headUnitConfiguration.avChannels = {messenger::ChannelId::MEDIA_AUDIO};
+    this->run(std::move(headUnitConfiguration));
+
+    BOOST_REQUIRE(report_.streams.size() == 1);
+    BOOST_CHECK(report_.streams[0].channelId == messenger::ChannelId::MEDIA_AUDIO);
+    BOOST_TEST(report_.streams[0].ackedFrames > 0);
+}
+
+}
+}
+}
+}
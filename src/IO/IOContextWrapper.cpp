@@ -25,9 +25,17 @@ namespace aasdk
 namespace io
 {
 
+namespace
+{
+// nesting level of handlers run in place on the current thread; past the limit
+// handlers are posted again so a long synchronous chain cannot exhaust the stack
+thread_local size_t inlineDepth = 0;
+}
+
 IOContextWrapper::IOContextWrapper()
     : ioService_(nullptr)
     , strand_(nullptr)
+    , dispatchMode_(DispatchMode::POST)
 {
 
 }
@@ -35,13 +43,15 @@ IOContextWrapper::IOContextWrapper()
 IOContextWrapper::IOContextWrapper(boost::asio::io_service& ioService)
     : ioService_(&ioService)
     , strand_(nullptr)
+    , dispatchMode_(DispatchMode::POST)
 {
 
 }
 
-IOContextWrapper::IOContextWrapper(boost::asio::io_service::strand& strand)
+IOContextWrapper::IOContextWrapper(boost::asio::io_service::strand& strand, DispatchMode dispatchMode)
     : ioService_(nullptr)
     , strand_(&strand)
+    , dispatchMode_(dispatchMode)
 {
 
 }
@@ -57,6 +67,21 @@ bool IOContextWrapper::isActive() const
     return ioService_ != nullptr || strand_ != nullptr;
 }
 
+bool IOContextWrapper::canRunInline() const
+{
+    return dispatchMode_ == DispatchMode::INLINE && strand_ != nullptr && strand_->running_in_this_thread() && inlineDepth < cMaxInlineDepth;
+}
+
+IOContextWrapper::InlineScope::InlineScope()
+{
+    ++inlineDepth;
+}
+
+IOContextWrapper::InlineScope::~InlineScope()
+{
+    --inlineDepth;
+}
+
 }
 }
 }
@@ -0,0 +1,189 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <cstring>
+#include <f1x/aasdk/Common/Log.hpp>
+#include <f1x/aasdk/IO/IOThread.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+IOThread::IOThread(IOThreadConfiguration configuration)
+    : configuration_(std::move(configuration))
+    , running_(false)
+    , cpuClockAvailable_(false)
+    , cpuClockId_()
+    , finalCPUTime_(0)
+{
+
+}
+
+IOThread::~IOThread()
+{
+    this->stop();
+    this->join();
+}
+
+void IOThread::start()
+{
+    this->start([this]() {
+        ioService_.run();
+        ioService_.reset();
+    });
+}
+
+void IOThread::start(Routine routine)
+{
+    if(thread_.get_id() == std::this_thread::get_id())
+    {
+        AASDK_LOG(error) << "[IOThread] " << configuration_.name << " cannot be restarted from its own thread.";
+        return;
+    }
+
+    if(running_)
+    {
+        return;
+    }
+
+    // a stopped thread that was not joined yet would pick up running_ again and never exit
+    this->join();
+    running_ = true;
+    work_ = std::make_unique<boost::asio::io_service::work>(ioService_);
+    thread_ = std::thread(&IOThread::run, this, std::move(routine));
+}
+
+void IOThread::stop()
+{
+    running_ = false;
+    work_.reset();
+    ioService_.stop();
+}
+
+void IOThread::join()
+{
+    if(thread_.joinable() && thread_.get_id() != std::this_thread::get_id())
+    {
+        thread_.join();
+    }
+}
+
+boost::asio::io_service& IOThread::getIOService()
+{
+    return ioService_;
+}
+
+const IOThreadConfiguration& IOThread::getConfiguration() const
+{
+    return configuration_;
+}
+
+std::chrono::nanoseconds IOThread::getCPUTime() const
+{
+    return cpuClockAvailable_ ? this->sampleCPUTime() : std::chrono::nanoseconds(finalCPUTime_.load());
+}
+
+void IOThread::run(Routine routine)
+{
+    this->applyConfiguration();
+
+    clockid_t clockId;
+    const bool hasCPUClock = pthread_getcpuclockid(pthread_self(), &clockId) == 0;
+    if(hasCPUClock)
+    {
+        cpuClockId_ = clockId;
+        cpuClockAvailable_ = true;
+    }
+
+    while(running_)
+    {
+        routine();
+    }
+
+    timespec cpuTime;
+    if(hasCPUClock && clock_gettime(clockId, &cpuTime) == 0)
+    {
+        finalCPUTime_ = static_cast<int64_t>(cpuTime.tv_sec) * 1000000000 + cpuTime.tv_nsec;
+    }
+
+    cpuClockAvailable_ = false;
+}
+
+void IOThread::applyConfiguration()
+{
+#ifdef __linux__
+    if(!configuration_.name.empty())
+    {
+        // kernel limits thread names to 15 characters
+        pthread_setname_np(pthread_self(), configuration_.name.substr(0, 15).c_str());
+    }
+
+    if(configuration_.cpuCore >= 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(configuration_.cpuCore, &cpuSet);
+
+        auto result = pthread_setaffinity_np(pthread_self(), sizeof(cpuSet), &cpuSet);
+        if(result != 0)
+        {
+            AASDK_LOG(warning) << "[IOThread] " << configuration_.name << " cannot be pinned to core " << configuration_.cpuCore << ": " << strerror(result);
+        }
+    }
+
+    if(configuration_.realtimePriority > 0)
+    {
+        sched_param param;
+        param.sched_priority = configuration_.realtimePriority;
+
+        auto result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+        if(result != 0)
+        {
+            AASDK_LOG(warning) << "[IOThread] " << configuration_.name << " cannot use SCHED_FIFO priority " << configuration_.realtimePriority << ": " << strerror(result);
+        }
+    }
+#else
+    if(configuration_.cpuCore >= 0 || configuration_.realtimePriority > 0)
+    {
+        AASDK_LOG(warning) << "[IOThread] " << configuration_.name << " affinity and priority are not supported on this platform.";
+    }
+#endif
+}
+
+std::chrono::nanoseconds IOThread::sampleCPUTime() const
+{
+    timespec cpuTime;
+
+    // the thread may exit between the check and the read, its clock then fails with EINVAL
+    if(clock_gettime(cpuClockId_, &cpuTime) != 0)
+    {
+        return std::chrono::nanoseconds(finalCPUTime_.load());
+    }
+
+    return std::chrono::seconds(cpuTime.tv_sec) + std::chrono::nanoseconds(cpuTime.tv_nsec);
+}
+
+}
+}
+}
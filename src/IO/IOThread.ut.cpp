@@ -0,0 +1,144 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <future>
+#include <sched.h>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/IOThread.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(IOThread_RunsHandlersOnOwnThread)
+{
+    IOThread ioThread(IOThreadConfiguration{"aasdk-ut", -1, 0});
+    ioThread.start();
+
+    std::promise<std::thread::id> threadId;
+    ioThread.getIOService().post([&]() { threadId.set_value(std::this_thread::get_id()); });
+
+    auto future = threadId.get_future();
+    BOOST_TEST((future.wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+    BOOST_TEST((future.get() != std::this_thread::get_id()));
+
+    ioThread.stop();
+    ioThread.join();
+}
+
+BOOST_AUTO_TEST_CASE(IOThread_PinnedToConfiguredCore)
+{
+    cpu_set_t allowedCpus;
+    CPU_ZERO(&allowedCpus);
+    sched_getaffinity(0, sizeof(allowedCpus), &allowedCpus);
+
+    int core = CPU_SETSIZE - 1;
+    while(core > 0 && !CPU_ISSET(core, &allowedCpus))
+    {
+        --core;
+    }
+
+    IOThread ioThread(IOThreadConfiguration{"aasdk-ut", core, 0});
+    ioThread.start();
+
+    std::promise<int> cpu;
+    ioThread.getIOService().post([&]() { cpu.set_value(sched_getcpu()); });
+
+    BOOST_TEST(cpu.get_future().get() == core);
+}
+
+BOOST_AUTO_TEST_CASE(IOThread_ReportsCPUTime)
+{
+    IOThread ioThread(IOThreadConfiguration{"aasdk-ut", -1, 0});
+    ioThread.start();
+
+    std::promise<void> done;
+    ioThread.getIOService().post([&]() {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(20);
+        while(std::chrono::steady_clock::now() < deadline);
+        done.set_value();
+    });
+
+    done.get_future().wait();
+    BOOST_TEST(ioThread.getCPUTime().count() > 0);
+
+    ioThread.stop();
+    ioThread.join();
+    BOOST_TEST(ioThread.getCPUTime().count() > 0);
+}
+
+BOOST_AUTO_TEST_CASE(IOThread_RoutineRepeatsUntilStop)
+{
+    IOThread ioThread(IOThreadConfiguration{"aasdk-ut", -1, 0});
+    std::atomic<size_t> iterations(0);
+
+    ioThread.start([&]() {
+        ++iterations;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    });
+
+    while(iterations < 3);
+
+    ioThread.stop();
+    ioThread.join();
+
+    const size_t stoppedIterations = iterations;
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    BOOST_TEST(iterations == stoppedIterations);
+}
+
+BOOST_AUTO_TEST_CASE(IOThread_RestartWithoutJoin)
+{
+    IOThread ioThread(IOThreadConfiguration{"aasdk-ut", -1, 0});
+    ioThread.start();
+    ioThread.stop();
+    ioThread.start();
+
+    std::promise<void> handled;
+    ioThread.getIOService().post([&]() { handled.set_value(); });
+    BOOST_TEST((handled.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+
+    ioThread.stop();
+    ioThread.join();
+}
+
+BOOST_AUTO_TEST_CASE(IOThread_StartFromOwnThreadIgnored)
+{
+    IOThread ioThread(IOThreadConfiguration{"aasdk-ut", -1, 0});
+    ioThread.start();
+
+    std::promise<void> handled;
+    ioThread.getIOService().post([&]() {
+        ioThread.stop();
+        ioThread.start();
+        handled.set_value();
+    });
+
+    BOOST_TEST((handled.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+    ioThread.join();
+}
+
+}
+}
+}
+}
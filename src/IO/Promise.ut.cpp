@@ -0,0 +1,137 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/Promise.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace ut
+{
+
+class PromiseUnitTest
+{
+protected:
+    PromiseUnitTest()
+        : strand_(ioService_)
+    {
+
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+};
+
+BOOST_FIXTURE_TEST_CASE(Promise_InlineResolveOnStrand, PromiseUnitTest)
+{
+    bool resolved = false;
+    bool resolvedInPlace = false;
+
+    strand_.dispatch([&]() {
+        auto promise = Promise<int>::defer(strand_, DispatchMode::INLINE);
+        promise->then([&](int value) { resolved = value == 5; });
+        promise->resolve(5);
+        resolvedInPlace = resolved;
+    });
+
+    ioService_.run();
+
+    BOOST_TEST(resolvedInPlace);
+    BOOST_TEST(resolved);
+}
+
+BOOST_FIXTURE_TEST_CASE(Promise_InlineRejectOnStrand, PromiseUnitTest)
+{
+    bool rejectedInPlace = false;
+
+    strand_.dispatch([&]() {
+        bool rejected = false;
+        auto promise = Promise<void>::defer(strand_, DispatchMode::INLINE);
+        promise->then([]() {}, [&](const error::Error& e) { rejected = e == error::ErrorCode::OPERATION_ABORTED; });
+        promise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+        rejectedInPlace = rejected;
+    });
+
+    ioService_.run();
+
+    BOOST_TEST(rejectedInPlace);
+}
+
+BOOST_FIXTURE_TEST_CASE(Promise_InlinePostsOutsideOfStrand, PromiseUnitTest)
+{
+    bool resolved = false;
+
+    auto promise = Promise<void>::defer(strand_, DispatchMode::INLINE);
+    promise->then([&]() { resolved = true; });
+    promise->resolve();
+
+    BOOST_TEST(!resolved);
+
+    ioService_.run();
+    BOOST_TEST(resolved);
+}
+
+BOOST_FIXTURE_TEST_CASE(Promise_PostModeAlwaysPosts, PromiseUnitTest)
+{
+    bool resolved = false;
+    bool resolvedInPlace = true;
+
+    strand_.dispatch([&]() {
+        auto promise = Promise<void>::defer(strand_);
+        promise->then([&]() { resolved = true; });
+        promise->resolve();
+        resolvedInPlace = resolved;
+    });
+
+    ioService_.run();
+
+    BOOST_TEST(!resolvedInPlace);
+    BOOST_TEST(resolved);
+}
+
+BOOST_FIXTURE_TEST_CASE(Promise_InlineNestingIsBounded, PromiseUnitTest)
+{
+    const size_t chainLength = 1000;
+    size_t resolvedCount = 0;
+
+    std::function<void()> resolveNext = [&]() {
+        if(resolvedCount < chainLength)
+        {
+            auto promise = Promise<void>::defer(strand_, DispatchMode::INLINE);
+            promise->then([&]() {
+                ++resolvedCount;
+                resolveNext();
+            });
+            promise->resolve();
+        }
+    };
+
+    strand_.dispatch(resolveNext);
+    ioService_.run();
+
+    BOOST_TEST(resolvedCount == chainLength);
+}
+
+}
+}
+}
+}
@@ -0,0 +1,66 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/IO/SimulationClock.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+constexpr bool SimulationClock::is_steady;
+std::atomic<bool> SimulationClock::virtual_(false);
+std::atomic<SimulationClock::rep> SimulationClock::virtualNow_(0);
+
+SimulationClock::time_point SimulationClock::now()
+{
+    if(virtual_)
+    {
+        return time_point(duration(virtualNow_.load()));
+    }
+
+    return time_point(std::chrono::steady_clock::now().time_since_epoch());
+}
+
+bool SimulationClock::isVirtual()
+{
+    return virtual_;
+}
+
+void SimulationClock::startVirtualTime()
+{
+    // continue from the current real time so time points taken before the switch stay comparable
+    virtualNow_ = std::chrono::steady_clock::now().time_since_epoch().count();
+    virtual_ = true;
+}
+
+void SimulationClock::stopVirtualTime()
+{
+    virtual_ = false;
+}
+
+void SimulationClock::setVirtualTime(time_point timePoint)
+{
+    virtualNow_ = timePoint.time_since_epoch().count();
+}
+
+}
+}
+}
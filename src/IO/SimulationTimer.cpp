@@ -0,0 +1,115 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/IO/SimulationTimer.hpp>
+#include <f1x/aasdk/IO/VirtualTimeDriver.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+SimulationTimer::SimulationTimer(boost::asio::io_service& ioService)
+    : ioService_(ioService)
+    , timer_(ioService)
+    , expiry_(SimulationClock::now())
+{
+
+}
+
+SimulationTimer::SimulationTimer(boost::asio::io_service& ioService, TimePoint expiry)
+    : SimulationTimer(ioService)
+{
+    this->expiresAt(expiry);
+}
+
+SimulationTimer::SimulationTimer(boost::asio::io_service& ioService, Duration expiry)
+    : SimulationTimer(ioService)
+{
+    this->expiresAfter(expiry);
+}
+
+SimulationTimer::~SimulationTimer()
+{
+    this->cancel();
+}
+
+void SimulationTimer::expiresAt(TimePoint expiry)
+{
+    this->cancel();
+    expiry_ = expiry;
+}
+
+void SimulationTimer::expiresAfter(Duration expiry)
+{
+    this->expiresAt(SimulationClock::now() + expiry);
+}
+
+SimulationTimer::TimePoint SimulationTimer::getExpiry() const
+{
+    return expiry_;
+}
+
+void SimulationTimer::asyncWait(WaitHandler handler)
+{
+    auto driver = VirtualTimeDriver::getActive();
+
+    if(driver == nullptr)
+    {
+        timer_.expires_at(std::chrono::steady_clock::time_point(expiry_.time_since_epoch()));
+        timer_.async_wait(std::move(handler));
+        return;
+    }
+
+    virtualWaits_.remove_if([](const std::weak_ptr<VirtualWait>& wait) { return wait.expired(); });
+
+    auto wait = std::make_shared<VirtualWait>(VirtualWait{std::move(handler), false});
+    virtualWaits_.push_back(wait);
+
+    auto& ioService = ioService_;
+    driver->schedule(expiry_, [&ioService, wait]() {
+        if(!wait->completed)
+        {
+            wait->completed = true;
+            ioService.post([handler = std::move(wait->handler)]() { handler(boost::system::error_code()); });
+        }
+    });
+}
+
+void SimulationTimer::cancel()
+{
+    timer_.cancel();
+
+    for(const auto& weakWait : virtualWaits_)
+    {
+        auto wait = weakWait.lock();
+        if(wait != nullptr && !wait->completed)
+        {
+            wait->completed = true;
+            ioService_.post([handler = std::move(wait->handler)]() { handler(boost::asio::error::operation_aborted); });
+        }
+    }
+
+    virtualWaits_.clear();
+}
+
+}
+}
+}
@@ -0,0 +1,56 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/IO/SteadyTimer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+SteadyTimer::SteadyTimer(boost::asio::io_service& ioService)
+    : timer_(ioService)
+{
+
+}
+
+SteadyTimer::Clock::time_point SteadyTimer::now() const
+{
+    return Clock::now();
+}
+
+void SteadyTimer::expiresAt(Clock::time_point expiry)
+{
+    timer_.expires_at(expiry);
+}
+
+void SteadyTimer::asyncWait(WaitHandler handler)
+{
+    timer_.async_wait(std::move(handler));
+}
+
+void SteadyTimer::cancel()
+{
+    timer_.cancel();
+}
+
+}
+}
+}
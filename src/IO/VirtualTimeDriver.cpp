@@ -0,0 +1,140 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/IO/VirtualTimeDriver.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+VirtualTimeDriver* VirtualTimeDriver::active_ = nullptr;
+
+VirtualTimeDriver::VirtualTimeDriver(boost::asio::io_service& ioService)
+    : ioService_(ioService)
+    , handlerCount_(0)
+{
+    SimulationClock::startVirtualTime();
+    startTime_ = SimulationClock::now();
+    active_ = this;
+}
+
+VirtualTimeDriver::~VirtualTimeDriver()
+{
+    active_ = nullptr;
+    SimulationClock::stopVirtualTime();
+}
+
+VirtualTimeDriver::TimePoint VirtualTimeDriver::now() const
+{
+    return SimulationClock::now();
+}
+
+VirtualTimeDriver::Duration VirtualTimeDriver::getElapsed() const
+{
+    return SimulationClock::now() - startTime_;
+}
+
+size_t VirtualTimeDriver::getHandlerCount() const
+{
+    return handlerCount_;
+}
+
+void VirtualTimeDriver::runFor(Duration duration)
+{
+    this->runUntil(SimulationClock::now() + duration);
+}
+
+void VirtualTimeDriver::runUntil(TimePoint timePoint)
+{
+    while(this->step() || this->advance(timePoint));
+
+    if(SimulationClock::now() < timePoint)
+    {
+        SimulationClock::setVirtualTime(timePoint);
+    }
+}
+
+bool VirtualTimeDriver::runUntil(Condition condition, Duration limit)
+{
+    const auto deadline = SimulationClock::now() + limit;
+
+    while(!condition())
+    {
+        if(!this->step() && !this->advance(deadline))
+        {
+            SimulationClock::setVirtualTime(std::max(SimulationClock::now(), deadline));
+            return condition();
+        }
+    }
+
+    return true;
+}
+
+void VirtualTimeDriver::schedule(TimePoint deadline, std::function<void()> expire)
+{
+    // equal deadlines keep their scheduling order
+    deadlines_.emplace_hint(deadlines_.upper_bound(deadline), deadline, std::move(expire));
+}
+
+VirtualTimeDriver* VirtualTimeDriver::getActive()
+{
+    return active_;
+}
+
+bool VirtualTimeDriver::step()
+{
+    // one handler at a time so conditions are observed at the exact virtual time they became true
+    const auto count = ioService_.poll_one();
+    if(ioService_.stopped())
+    {
+        ioService_.reset();
+    }
+
+    handlerCount_ += count;
+    return count > 0;
+}
+
+bool VirtualTimeDriver::advance(TimePoint limit)
+{
+    if(deadlines_.empty() || deadlines_.begin()->first > limit)
+    {
+        return false;
+    }
+
+    const auto deadline = deadlines_.begin()->first;
+    if(SimulationClock::now() < deadline)
+    {
+        SimulationClock::setVirtualTime(deadline);
+    }
+
+    while(!deadlines_.empty() && deadlines_.begin()->first <= deadline)
+    {
+        auto expire = std::move(deadlines_.begin()->second);
+        deadlines_.erase(deadlines_.begin());
+        expire();
+    }
+
+    return true;
+}
+
+}
+}
+}
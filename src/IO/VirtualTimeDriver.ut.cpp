@@ -0,0 +1,143 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/SimulationTimer.hpp>
+#include <f1x/aasdk/IO/VirtualTimeDriver.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(VirtualTimeDriver_FiresTimersAtVirtualDeadlines)
+{
+    boost::asio::io_service ioService;
+    VirtualTimeDriver driver(ioService);
+    const auto startTime = driver.now();
+    const auto wallClockStart = std::chrono::steady_clock::now();
+
+    std::vector<std::pair<int, VirtualTimeDriver::Duration>> fired;
+    SimulationTimer longTimer(ioService, std::chrono::seconds(30));
+    SimulationTimer shortTimer(ioService, std::chrono::milliseconds(1500));
+
+    longTimer.asyncWait([&](const boost::system::error_code& e) { BOOST_TEST(!e); fired.emplace_back(2, driver.now() - startTime); });
+    shortTimer.asyncWait([&](const boost::system::error_code& e) { BOOST_TEST(!e); fired.emplace_back(1, driver.now() - startTime); });
+
+    driver.runFor(std::chrono::minutes(1));
+
+    BOOST_REQUIRE(fired.size() == 2);
+    BOOST_TEST(fired[0].first == 1);
+    BOOST_CHECK(fired[0].second == std::chrono::milliseconds(1500));
+    BOOST_TEST(fired[1].first == 2);
+    BOOST_CHECK(fired[1].second == std::chrono::seconds(30));
+    BOOST_CHECK(driver.getElapsed() == std::chrono::minutes(1));
+    BOOST_CHECK(std::chrono::steady_clock::now() - wallClockStart < std::chrono::seconds(5));
+}
+
+BOOST_AUTO_TEST_CASE(VirtualTimeDriver_EqualDeadlinesKeepOrder)
+{
+    boost::asio::io_service ioService;
+    VirtualTimeDriver driver(ioService);
+
+    std::vector<int> fired;
+    std::vector<std::unique_ptr<SimulationTimer>> timers;
+
+    for(int i = 0; i < 8; ++i)
+    {
+        timers.emplace_back(new SimulationTimer(ioService, std::chrono::milliseconds(10)));
+        timers.back()->asyncWait([&fired, i](const boost::system::error_code&) { fired.push_back(i); });
+    }
+
+    driver.runFor(std::chrono::milliseconds(10));
+    BOOST_TEST(fired == std::vector<int>({0, 1, 2, 3, 4, 5, 6, 7}), boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(VirtualTimeDriver_CancelledWaitIsAborted)
+{
+    boost::asio::io_service ioService;
+    VirtualTimeDriver driver(ioService);
+
+    boost::system::error_code result;
+    bool completed = false;
+    SimulationTimer timer(ioService, std::chrono::seconds(1));
+    timer.asyncWait([&](const boost::system::error_code& e) { result = e; completed = true; });
+
+    driver.runFor(std::chrono::milliseconds(500));
+    BOOST_TEST(!completed);
+
+    timer.cancel();
+    driver.runFor(std::chrono::seconds(1));
+    BOOST_TEST(completed);
+    BOOST_CHECK(result == boost::asio::error::operation_aborted);
+}
+
+BOOST_AUTO_TEST_CASE(VirtualTimeDriver_RunUntilConditionStopsAtExactTime)
+{
+    boost::asio::io_service ioService;
+    VirtualTimeDriver driver(ioService);
+
+    bool fired = false;
+    SimulationTimer timer(ioService, std::chrono::milliseconds(250));
+    timer.asyncWait([&](const boost::system::error_code&) { fired = true; });
+
+    BOOST_TEST(driver.runUntil([&]() { return fired; }, std::chrono::seconds(1)));
+    BOOST_CHECK(driver.getElapsed() == std::chrono::milliseconds(250));
+
+    BOOST_TEST(!driver.runUntil([]() { return false; }, std::chrono::milliseconds(100)));
+    BOOST_CHECK(driver.getElapsed() == std::chrono::milliseconds(350));
+}
+
+BOOST_AUTO_TEST_CASE(VirtualTimeDriver_PostedHandlersRunBeforeTimeAdvances)
+{
+    boost::asio::io_service ioService;
+    VirtualTimeDriver driver(ioService);
+
+    VirtualTimeDriver::Duration postedAt = std::chrono::seconds(-1);
+    SimulationTimer timer(ioService, std::chrono::milliseconds(20));
+    timer.asyncWait([&](const boost::system::error_code&) {
+        ioService.post([&]() { postedAt = driver.getElapsed(); });
+    });
+
+    driver.runFor(std::chrono::seconds(1));
+    BOOST_CHECK(postedAt == std::chrono::milliseconds(20));
+}
+
+BOOST_AUTO_TEST_CASE(SimulationTimer_UsesRealTimeWithoutDriver)
+{
+    boost::asio::io_service ioService;
+    BOOST_TEST(!SimulationClock::isVirtual());
+
+    const auto startTime = SimulationClock::now();
+    bool fired = false;
+    SimulationTimer timer(ioService, std::chrono::milliseconds(20));
+    timer.asyncWait([&](const boost::system::error_code& e) { fired = !e; });
+
+    ioService.run();
+    BOOST_TEST(fired);
+    BOOST_CHECK(SimulationClock::now() - startTime >= std::chrono::milliseconds(20));
+}
+
+}
+}
+}
+}
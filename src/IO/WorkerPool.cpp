@@ -0,0 +1,117 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/IO/WorkerPool.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+
+WorkerPool::WorkerPool(Configuration configuration)
+{
+    for(auto& workerConfiguration : configuration)
+    {
+        workers_.emplace_back(std::make_unique<IOThread>(std::move(workerConfiguration)));
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    this->stop();
+}
+
+void WorkerPool::start()
+{
+    if(work_ != nullptr)
+    {
+        return;
+    }
+
+    ioService_.reset();
+    work_ = std::make_unique<boost::asio::io_service::work>(ioService_);
+
+    for(auto& worker : workers_)
+    {
+        // run() returns only once the pool is stopped, the IOThread loop then sees its own stop
+        worker->start([this]() {
+            ioService_.run();
+        });
+    }
+}
+
+void WorkerPool::stop()
+{
+    for(auto& worker : workers_)
+    {
+        worker->stop();
+    }
+
+    work_.reset();
+    ioService_.stop();
+
+    for(auto& worker : workers_)
+    {
+        worker->join();
+    }
+}
+
+boost::asio::io_service& WorkerPool::getIOService()
+{
+    return ioService_;
+}
+
+size_t WorkerPool::getSize() const
+{
+    return workers_.size();
+}
+
+const IOThread& WorkerPool::getWorker(size_t index) const
+{
+    return *workers_.at(index);
+}
+
+std::chrono::nanoseconds WorkerPool::getCPUTime() const
+{
+    std::chrono::nanoseconds cpuTime(0);
+
+    for(const auto& worker : workers_)
+    {
+        cpuTime += worker->getCPUTime();
+    }
+
+    return cpuTime;
+}
+
+WorkerPool::Configuration WorkerPool::createConfiguration(size_t size, const std::string& name, int firstCore)
+{
+    Configuration configuration;
+
+    for(size_t i = 0; i < size; ++i)
+    {
+        configuration.push_back(IOThreadConfiguration{name + "-" + std::to_string(i), firstCore < 0 ? -1 : firstCore + static_cast<int>(i), 0});
+    }
+
+    return configuration;
+}
+
+}
+}
+}
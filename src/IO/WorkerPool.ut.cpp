@@ -0,0 +1,113 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <future>
+#include <mutex>
+#include <set>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/IO/WorkerPool.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace io
+{
+namespace ut
+{
+
+BOOST_AUTO_TEST_CASE(WorkerPool_IdleWorkersTakeOverWhileOneIsBusy)
+{
+    WorkerPool workerPool(WorkerPool::createConfiguration(4, "aasdk-ut"));
+    workerPool.start();
+
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    workerPool.getIOService().post([released]() { released.wait(); });
+
+    std::mutex mutex;
+    std::set<std::thread::id> threadIds;
+    std::promise<void> done;
+    size_t remaining = 100;
+
+    for(size_t i = 0; i < 100; ++i)
+    {
+        workerPool.getIOService().post([&]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            threadIds.insert(std::this_thread::get_id());
+            if(--remaining == 0)
+            {
+                done.set_value();
+            }
+        });
+    }
+
+    // completes although the first worker to pick up a handler is still blocked
+    BOOST_TEST((done.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+    release.set_value();
+
+    workerPool.stop();
+    BOOST_TEST(threadIds.count(std::this_thread::get_id()) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(WorkerPool_StrandSerializesAcrossWorkers)
+{
+    WorkerPool workerPool(WorkerPool::createConfiguration(4, "aasdk-ut"));
+    boost::asio::io_service::strand strand(workerPool.getIOService());
+    workerPool.start();
+
+    std::atomic<size_t> inFlight(0);
+    std::atomic<size_t> maxInFlight(0);
+    std::promise<void> done;
+    size_t remaining = 1000;
+
+    for(size_t i = 0; i < 1000; ++i)
+    {
+        strand.post([&]() {
+            maxInFlight = std::max<size_t>(maxInFlight, ++inFlight);
+            --inFlight;
+            if(--remaining == 0)
+            {
+                done.set_value();
+            }
+        });
+    }
+
+    BOOST_TEST((done.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+    BOOST_TEST(maxInFlight.load() == 1u);
+}
+
+BOOST_AUTO_TEST_CASE(WorkerPool_RestartsAfterStop)
+{
+    WorkerPool workerPool(WorkerPool::createConfiguration(2, "aasdk-ut", -1));
+    BOOST_TEST(workerPool.getSize() == 2u);
+    BOOST_TEST(workerPool.getWorker(1).getConfiguration().name == "aasdk-ut-1");
+
+    workerPool.start();
+    workerPool.stop();
+    workerPool.start();
+
+    std::promise<void> done;
+    workerPool.getIOService().post([&]() { done.set_value(); });
+    BOOST_TEST((done.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+}
+
+}
+}
+}
+}
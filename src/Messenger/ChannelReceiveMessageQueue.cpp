@@ -35,6 +35,7 @@ void ChannelReceiveMessageQueue::push(Message::Pointer message)
     }
 
     auto& channelQueue = queue_.at(channelId);
+    payloadSize_ += message->getPayload().size();
     channelQueue.emplace(std::move(message));
 }
 
@@ -43,6 +44,7 @@ Message::Pointer ChannelReceiveMessageQueue::pop(ChannelId channelId)
     auto& channelQueue = queue_.at(channelId);
     auto message(std::move(channelQueue.front()));
     channelQueue.pop();
+    payloadSize_ -= message->getPayload().size();
 
     if(channelQueue.empty())
     {
@@ -60,6 +62,12 @@ bool ChannelReceiveMessageQueue::empty(ChannelId channelId) const
 void ChannelReceiveMessageQueue::clear()
 {
     queue_.clear();
+    payloadSize_ = 0;
+}
+
+size_t ChannelReceiveMessageQueue::getPayloadSize() const
+{
+    return payloadSize_;
 }
 
 }
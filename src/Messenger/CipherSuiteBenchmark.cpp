@@ -0,0 +1,178 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <f1x/aasdk/Messenger/CipherSuiteBenchmark.hpp>
+#include <f1x/aasdk/Error/Error.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+
+namespace
+{
+
+// shuttles the handshake records between both ends until each side reports completion
+void handshake(Cryptor& client, Cryptor& server)
+{
+    static constexpr size_t cMaxRounds = 16;
+
+    bool clientDone = false;
+    bool serverDone = false;
+
+    for(size_t round = 0; !clientDone || !serverDone; ++round)
+    {
+        if(round == cMaxRounds)
+        {
+            throw error::Error(error::ErrorCode::SSL_HANDSHAKE);
+        }
+
+        if(!clientDone)
+        {
+            clientDone = client.doHandshake();
+        }
+
+        const auto clientRecords = client.readHandshakeBuffer();
+        if(!clientRecords.empty())
+        {
+            server.writeHandshakeBuffer(common::DataConstBuffer(clientRecords));
+        }
+
+        if(!serverDone)
+        {
+            serverDone = server.doHandshake();
+        }
+
+        const auto serverRecords = server.readHandshakeBuffer();
+        if(!serverRecords.empty())
+        {
+            client.writeHandshakeBuffer(common::DataConstBuffer(serverRecords));
+        }
+    }
+}
+
+}
+
+CipherSuiteBenchmark::CipherSuiteBenchmark(transport::ISSLWrapper::Pointer sslWrapper, Candidates candidates,
+                                           std::chrono::milliseconds duration, size_t recordSize)
+    : sslWrapper_(std::move(sslWrapper))
+    , candidates_(std::move(candidates))
+    , duration_(duration)
+    , recordSize_(recordSize)
+{
+
+}
+
+CipherSuiteBenchmark::Scores CipherSuiteBenchmark::run()
+{
+    Scores scores;
+
+    for(const auto& candidate : candidates_)
+    {
+        CipherSuiteScore score;
+        if(this->measure(candidate, score))
+        {
+            AASDK_LOG(info) << "[CipherSuiteBenchmark] " << candidate.name << " (" << score.cipherName << "): "
+                            << static_cast<uint64_t>(score.throughput) << " B/s";
+            scores.push_back(std::move(score));
+        }
+    }
+
+    std::stable_sort(scores.begin(), scores.end(), [](const CipherSuiteScore& a, const CipherSuiteScore& b) { return a.throughput > b.throughput; });
+    return scores;
+}
+
+bool CipherSuiteBenchmark::measure(const CipherSuiteCandidate& candidate, CipherSuiteScore& score)
+{
+    typedef std::chrono::steady_clock Clock;
+
+    Cryptor client(sslWrapper_);
+    Cryptor server(sslWrapper_, Cryptor::Role::SERVER);
+    client.setCipherPreference(candidate.ciphers);
+
+    bool measured = false;
+
+    try
+    {
+        client.init();
+        server.init();
+        handshake(client, server);
+
+        const common::Data payload(recordSize_, 0xAA);
+        common::Data record;
+        common::Data output;
+        uint64_t totalSize = 0;
+
+        const auto begin = Clock::now();
+        auto elapsed = Clock::duration::zero();
+
+        do
+        {
+            record.clear();
+            output.clear();
+            client.encrypt(record, common::DataConstBuffer(payload));
+            server.decrypt(output, common::DataConstBuffer(record));
+            totalSize += output.size();
+            elapsed = Clock::now() - begin;
+        }
+        while(elapsed < duration_);
+
+        score.candidate = candidate;
+        score.cipherName = client.getCipherName();
+        score.throughput = totalSize / std::chrono::duration<double>(elapsed).count();
+        measured = true;
+    }
+    catch(const error::Error& e)
+    {
+        AASDK_LOG(info) << "[CipherSuiteBenchmark] " << candidate.name << " not available: " << e.what();
+    }
+
+    client.deinit();
+    server.deinit();
+    return measured;
+}
+
+Cryptor::CipherPreference CipherSuiteBenchmark::getCipherPreference(const Scores& scores)
+{
+    Cryptor::CipherPreference cipherPreference;
+
+    for(const auto& score : scores)
+    {
+        cipherPreference.insert(cipherPreference.end(), score.candidate.ciphers.begin(), score.candidate.ciphers.end());
+    }
+
+    return cipherPreference;
+}
+
+CipherSuiteBenchmark::Candidates CipherSuiteBenchmark::getDefaultCandidates()
+{
+    // the certificate of the head unit carries an RSA key
+    return {
+        {"AES-128-GCM", {"TLS_AES_128_GCM_SHA256", "ECDHE-RSA-AES128-GCM-SHA256"}},
+        {"AES-256-GCM", {"TLS_AES_256_GCM_SHA384", "ECDHE-RSA-AES256-GCM-SHA384"}},
+        {"CHACHA20-POLY1305", {"TLS_CHACHA20_POLY1305_SHA256", "ECDHE-RSA-CHACHA20-POLY1305"}}
+    };
+}
+
+}
+}
+}
@@ -0,0 +1,114 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Transport/SSLWrapper.hpp>
+#include <f1x/aasdk/Messenger/CipherSuiteBenchmark.hpp>
+#include <f1x/aasdk/Error/Error.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace messenger
+{
+namespace ut
+{
+
+class CipherSuiteBenchmarkUnitTest
+{
+protected:
+    CipherSuiteBenchmarkUnitTest()
+        : sslWrapper_(std::make_shared<transport::SSLWrapper>())
+    {
+
+    }
+
+    transport::ISSLWrapper::Pointer sslWrapper_;
+};
+
+BOOST_FIXTURE_TEST_CASE(CipherSuiteBenchmark_RanksCandidates, CipherSuiteBenchmarkUnitTest)
+{
+    CipherSuiteBenchmark benchmark(sslWrapper_, CipherSuiteBenchmark::getDefaultCandidates(), std::chrono::milliseconds(5));
+    const auto scores = benchmark.run();
+
+    BOOST_REQUIRE(!scores.empty());
+
+    for(size_t i = 0; i < scores.size(); ++i)
+    {
+        const auto& ciphers = scores[i].candidate.ciphers;
+        BOOST_TEST(scores[i].throughput > 0);
+        BOOST_TEST((std::find(ciphers.begin(), ciphers.end(), scores[i].cipherName) != ciphers.end()));
+
+        if(i > 0)
+        {
+            BOOST_TEST(scores[i - 1].throughput >= scores[i].throughput);
+        }
+    }
+
+    const auto cipherPreference = CipherSuiteBenchmark::getCipherPreference(scores);
+    BOOST_TEST(cipherPreference.size() == scores.size() * 2);
+    BOOST_TEST(cipherPreference.front() == scores.front().candidate.ciphers.front());
+}
+
+BOOST_FIXTURE_TEST_CASE(CipherSuiteBenchmark_SkipsUnknownCiphers, CipherSuiteBenchmarkUnitTest)
+{
+    CipherSuiteBenchmark::Candidates candidates = {
+        {"UNKNOWN", {"NO-SUCH-CIPHER"}},
+        {"AES-128-GCM", {"TLS_AES_128_GCM_SHA256", "ECDHE-RSA-AES128-GCM-SHA256"}}
+    };
+
+    CipherSuiteBenchmark benchmark(sslWrapper_, std::move(candidates), std::chrono::milliseconds(1));
+    const auto scores = benchmark.run();
+
+    BOOST_REQUIRE(scores.size() == 1);
+    BOOST_TEST(scores[0].candidate.name == "AES-128-GCM");
+}
+
+BOOST_FIXTURE_TEST_CASE(Cryptor_RejectsUnknownCipherPreference, CipherSuiteBenchmarkUnitTest)
+{
+    Cryptor cryptor(sslWrapper_);
+    cryptor.setCipherPreference({"NO-SUCH-CIPHER"});
+
+    BOOST_CHECK_EXCEPTION(cryptor.init(), error::Error, [](const error::Error& e) { return e == error::ErrorCode::SSL_CIPHER_LIST; });
+    cryptor.deinit();
+}
+
+BOOST_FIXTURE_TEST_CASE(Cryptor_RejectsUnknownCipherAmongKnownOnes, CipherSuiteBenchmarkUnitTest)
+{
+    Cryptor tls12Cryptor(sslWrapper_);
+    tls12Cryptor.setCipherPreference({"ECDHE-RSA-AES128-GCM-SHA256", "NO-SUCH-CIPHER"});
+    BOOST_CHECK_EXCEPTION(tls12Cryptor.init(), error::Error, [](const error::Error& e) { return e == error::ErrorCode::SSL_CIPHER_LIST; });
+    tls12Cryptor.deinit();
+
+    Cryptor tls13Cryptor(sslWrapper_);
+    tls13Cryptor.setCipherPreference({"TLS_AES_128_GCM_SHA256", "TLS_NO_SUCH_SUITE"});
+    BOOST_CHECK_EXCEPTION(tls13Cryptor.init(), error::Error, [](const error::Error& e) { return e == error::ErrorCode::SSL_CIPHER_LIST; });
+    tls13Cryptor.deinit();
+
+    Cryptor validCryptor(sslWrapper_);
+    validCryptor.setCipherPreference({"TLS_AES_128_GCM_SHA256", "ECDHE-RSA-AES128-GCM-SHA256"});
+    BOOST_CHECK_NO_THROW(validCryptor.init());
+    validCryptor.deinit();
+}
+
+}
+}
+}
+}
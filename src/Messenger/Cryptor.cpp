@@ -28,8 +28,9 @@ namespace aasdk
 namespace messenger
 {
 
-Cryptor::Cryptor(transport::ISSLWrapper::Pointer sslWrapper)
+Cryptor::Cryptor(transport::ISSLWrapper::Pointer sslWrapper, Role role)
     : sslWrapper_(std::move(sslWrapper))
+    , role_(role)
     , maxBufferSize_(1024 * 20)
     , certificate_(nullptr)
     , privateKey_(nullptr)
@@ -58,7 +59,7 @@ void Cryptor::init()
         throw error::Error(error::ErrorCode::SSL_READ_PRIVATE_KEY);
     }
 
-    auto method = sslWrapper_->getMethod();
+    auto method = role_ == Role::SERVER ? sslWrapper_->getServerMethod() : sslWrapper_->getMethod();
 
     if(method == nullptr)
     {
@@ -82,6 +83,8 @@ void Cryptor::init()
         throw error::Error(error::ErrorCode::SSL_USE_PRIVATE_KEY);
     }
 
+    this->applyCipherPreference();
+
     ssl_ = sslWrapper_->createInstance(context_);
 
     if(ssl_ == nullptr)
@@ -103,7 +106,14 @@ void Cryptor::init()
 
     sslWrapper_->setBIOs(ssl_, bIOs_, maxBufferSize_);
 
-    sslWrapper_->setConnectState(ssl_);
+    if(role_ == Role::SERVER)
+    {
+        sslWrapper_->setAcceptState(ssl_);
+    }
+    else
+    {
+        sslWrapper_->setConnectState(ssl_);
+    }
 }
 
 void Cryptor::deinit()
@@ -137,6 +147,46 @@ void Cryptor::deinit()
     }
 }
 
+void Cryptor::setCipherPreference(CipherPreference cipherPreference)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    cipherPreference_ = std::move(cipherPreference);
+}
+
+Cryptor::CipherPreference Cryptor::getCipherPreference() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return cipherPreference_;
+}
+
+std::string Cryptor::getCipherName() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return isActive_ && ssl_ != nullptr ? sslWrapper_->getCipherName(ssl_) : std::string();
+}
+
+void Cryptor::applyCipherPreference()
+{
+    std::string cipherList;
+    std::string cipherSuites;
+
+    for(const auto& cipher : cipherPreference_)
+    {
+        auto& list = cipher.compare(0, 4, "TLS_") == 0 ? cipherSuites : cipherList;
+        list += list.empty() ? cipher : ":" + cipher;
+    }
+
+    if(!cipherList.empty() && !sslWrapper_->setCipherList(context_, cipherList))
+    {
+        throw error::Error(error::ErrorCode::SSL_CIPHER_LIST);
+    }
+
+    if(!cipherSuites.empty() && !sslWrapper_->setCipherSuites(context_, cipherSuites))
+    {
+        throw error::Error(error::ErrorCode::SSL_CIPHER_LIST);
+    }
+}
+
 bool Cryptor::doHandshake()
 {
     std::lock_guard<decltype(mutex_)> lock(mutex_);
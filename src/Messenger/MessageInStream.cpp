@@ -32,10 +32,30 @@ MessageInStream::MessageInStream(boost::asio::io_service& ioService, transport::
     : strand_(ioService)
     , transport_(std::move(transport))
     , cryptor_(std::move(cryptor))
+    , dispatchMode_(io::DispatchMode::POST)
+    , reassemblyCharge_(0)
 {
 
 }
 
+MessageInStream::MessageInStream(boost::asio::io_service::strand& strand, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor)
+    : strand_(strand)
+    , transport_(std::move(transport))
+    , cryptor_(std::move(cryptor))
+    , dispatchMode_(io::DispatchMode::INLINE)
+    , reassemblyCharge_(0)
+{
+
+}
+
+MessageInStream::~MessageInStream()
+{
+    if(memoryBudget_ != nullptr)
+    {
+        memoryBudget_->release(reassemblyCharge_);
+    }
+}
+
 void MessageInStream::startReceive(ReceivePromise::Pointer promise)
 {
     strand_.dispatch([this, self = this->shared_from_this(), promise = std::move(promise)]() mutable {
@@ -43,14 +63,14 @@ void MessageInStream::startReceive(ReceivePromise::Pointer promise)
         {
             promise_ = std::move(promise);
 
-            auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_);
+            auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_, dispatchMode_);
             transportPromise->then(
                 [this, self = this->shared_from_this()](common::Data data) mutable {
                     this->receiveFrameHeaderHandler(common::DataConstBuffer(data));
                 },
                 [this, self = this->shared_from_this()](const error::Error& e) mutable {
-                    promise_->reject(e);
-                    promise_.reset();
+                    auto promise = std::move(promise_);
+                    promise->reject(e);
                 });
 
             transport_->receive(FrameHeader::getSizeOf(), std::move(transportPromise));
@@ -94,15 +114,16 @@ void MessageInStream::receiveFrameHeaderHandler(const common::DataConstBuffer& b
     recentFrameType_ = frameHeader.getType();
     const size_t frameSize = FrameSize::getSizeOf(frameHeader.getType() == FrameType::FIRST ? FrameSizeType::EXTENDED : FrameSizeType::SHORT);
 
-    auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_);
+    auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_, dispatchMode_);
     transportPromise->then(
         [this, self = this->shared_from_this()](common::Data data) mutable {
             this->receiveFrameSizeHandler(common::DataConstBuffer(data));
         },
         [this, self = this->shared_from_this()](const error::Error& e) mutable {
             message_.reset();
-            promise_->reject(e);
-            promise_.reset();
+            this->updateReassemblyCharge();
+            auto promise = std::move(promise_);
+            promise->reject(e);
         });
 
     transport_->receive(frameSize, std::move(transportPromise));
@@ -110,15 +131,16 @@ void MessageInStream::receiveFrameHeaderHandler(const common::DataConstBuffer& b
 
 void MessageInStream::receiveFrameSizeHandler(const common::DataConstBuffer& buffer)
 {
-    auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_);
+    auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_, dispatchMode_);
     transportPromise->then(
         [this, self = this->shared_from_this()](common::Data data) mutable {
             this->receiveFramePayloadHandler(common::DataConstBuffer(data));
         },
         [this, self = this->shared_from_this()](const error::Error& e) mutable {
             message_.reset();
-            promise_->reject(e);
-            promise_.reset();
+            this->updateReassemblyCharge();
+            auto promise = std::move(promise_);
+            promise->reject(e);
         });
 
     FrameSize frameSize(buffer);
@@ -136,8 +158,9 @@ void MessageInStream::receiveFramePayloadHandler(const common::DataConstBuffer&
         catch(const error::Error& e)
         {
             message_.reset();
-            promise_->reject(e);
-            promise_.reset();
+            this->updateReassemblyCharge();
+            auto promise = std::move(promise_);
+            promise->reject(e);
             return;
         }
     }
@@ -146,28 +169,76 @@ void MessageInStream::receiveFramePayloadHandler(const common::DataConstBuffer&
         message_->insertPayload(buffer);
     }
 
+    if(!this->updateReassemblyCharge())
+    {
+        AASDK_LOG(error) << "[MessageInStream] memory budget exceeded, dropping message on channel " << channelIdToString(message_->getChannelId()) << ".";
+        message_.reset();
+        this->updateReassemblyCharge();
+        auto promise = std::move(promise_);
+        promise->reject(error::Error(error::ErrorCode::MEMORY_BUDGET_EXCEEDED));
+        return;
+    }
+
     if(recentFrameType_ == FrameType::BULK || recentFrameType_ == FrameType::LAST)
     {
-        promise_->resolve(std::move(message_));
-        promise_.reset();
+        // release the stream before completing, the handler may start the next receive in place
+        auto promise = std::move(promise_);
+        auto message = std::move(message_);
+        this->updateReassemblyCharge();
+        promise->resolve(std::move(message));
     }
     else
     {
-        auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_);
+        auto transportPromise = transport::ITransport::ReceivePromise::defer(strand_, dispatchMode_);
         transportPromise->then(
             [this, self = this->shared_from_this()](common::Data data) mutable {
                 this->receiveFrameHeaderHandler(common::DataConstBuffer(data));
             },
             [this, self = this->shared_from_this()](const error::Error& e) mutable {
                 message_.reset();
-                promise_->reject(e);
-                promise_.reset();
+                this->updateReassemblyCharge();
+                auto promise = std::move(promise_);
+                promise->reject(e);
             });
 
         transport_->receive(FrameHeader::getSizeOf(), std::move(transportPromise));
     }
 }
 
+void MessageInStream::setMemoryBudget(common::MemoryBudget::Pointer memoryBudget)
+{
+    memoryBudget_ = std::move(memoryBudget);
+}
+
+bool MessageInStream::updateReassemblyCharge()
+{
+    if(memoryBudget_ == nullptr)
+    {
+        return true;
+    }
+
+    size_t size = message_ != nullptr ? message_->getPayload().size() : 0;
+    for(const auto& assemblyBuffer : channel_assembly_buffers)
+    {
+        size += assemblyBuffer.second->getPayload().size();
+    }
+
+    if(size > reassemblyCharge_)
+    {
+        if(!memoryBudget_->tryAcquire(size - reassemblyCharge_))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        memoryBudget_->release(reassemblyCharge_ - size);
+    }
+
+    reassemblyCharge_ = size;
+    return true;
+}
+
 }
 }
 }
@@ -16,6 +16,7 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <boost/endian/conversion.hpp>
 #include <f1x/aasdk/IO/PromiseLink.hpp>
 #include <f1x/aasdk/Messenger/MessageOutStream.hpp>
@@ -27,12 +28,30 @@ namespace aasdk
 namespace messenger
 {
 
+constexpr size_t MessageOutStream::cDefaultMaxFramePayloadSize;
+constexpr size_t MessageOutStream::cMaxPlainFramePayloadSize;
+constexpr size_t MessageOutStream::cMaxEncryptedFramePayloadSize;
+
 MessageOutStream::MessageOutStream(boost::asio::io_service& ioService, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor)
     : strand_(ioService)
     , transport_(std::move(transport))
     , cryptor_(std::move(cryptor))
     , offset_(0)
     , remainingSize_(0)
+    , dispatchMode_(io::DispatchMode::POST)
+    , maxFramePayloadSize_(cDefaultMaxFramePayloadSize)
+{
+
+}
+
+MessageOutStream::MessageOutStream(boost::asio::io_service::strand& strand, transport::ITransport::Pointer transport, ICryptor::Pointer cryptor)
+    : strand_(strand)
+    , transport_(std::move(transport))
+    , cryptor_(std::move(cryptor))
+    , offset_(0)
+    , remainingSize_(0)
+    , dispatchMode_(io::DispatchMode::INLINE)
+    , maxFramePayloadSize_(cDefaultMaxFramePayloadSize)
 {
 
 }
@@ -49,7 +68,7 @@ void MessageOutStream::stream(Message::Pointer message, SendPromise::Pointer pro
         message_ = std::move(message);
         promise_ = std::move(promise);
 
-        if(message_->getPayload().size() >= cMaxFramePayloadSize)
+        if(message_->getPayload().size() >= this->getFramePayloadSizeLimit())
         {
             offset_ = 0;
             remainingSize_ = message_->getPayload().size();
@@ -60,34 +79,51 @@ void MessageOutStream::stream(Message::Pointer message, SendPromise::Pointer pro
             try
             {
                 auto data(this->compoundFrame(FrameType::BULK, common::DataConstBuffer(message_->getPayload())));
+                this->reset();
 
-                auto transportPromise = transport::ITransport::SendPromise::defer(strand_);
+                auto transportPromise = transport::ITransport::SendPromise::defer(strand_, dispatchMode_);
                 io::PromiseLink<>::forward(*transportPromise, std::move(promise_));
                 transport_->send(std::move(data), std::move(transportPromise));
             }
             catch(const error::Error& e)
             {
-                promise_->reject(e);
-                promise_.reset();
+                this->reset();
+                auto promise = std::move(promise_);
+                promise->reject(e);
             }
-
-            this->reset();
         }
     });
 }
 
+void MessageOutStream::setMaxFramePayloadSize(size_t size)
+{
+    maxFramePayloadSize_ = std::max<size_t>(1, std::min(size, cMaxPlainFramePayloadSize));
+}
+
+size_t MessageOutStream::getMaxFramePayloadSize() const
+{
+    return maxFramePayloadSize_;
+}
+
+size_t MessageOutStream::getFramePayloadSizeLimit() const
+{
+    const size_t maxFramePayloadSize = maxFramePayloadSize_;
+    return message_->getEncryptionType() == EncryptionType::ENCRYPTED ? std::min(maxFramePayloadSize, cMaxEncryptedFramePayloadSize) : maxFramePayloadSize;
+}
+
 void MessageOutStream::streamSplittedMessage()
 {
     try
     {
         const auto& payload = message_->getPayload();
         auto ptr = &payload[offset_];
-        auto size = remainingSize_ < cMaxFramePayloadSize ? remainingSize_ : cMaxFramePayloadSize;
+        const auto framePayloadSizeLimit = this->getFramePayloadSizeLimit();
+        auto size = remainingSize_ < framePayloadSizeLimit ? remainingSize_ : framePayloadSizeLimit;
 
         FrameType frameType = offset_ == 0 ? FrameType::FIRST : (remainingSize_ - size > 0 ? FrameType::MIDDLE : FrameType::LAST);
         auto data(this->compoundFrame(frameType, common::DataConstBuffer(ptr, size)));
 
-        auto transportPromise = transport::ITransport::SendPromise::defer(strand_);
+        auto transportPromise = transport::ITransport::SendPromise::defer(strand_, dispatchMode_);
 
         if(frameType == FrameType::LAST)
         {
@@ -103,8 +139,8 @@ void MessageOutStream::streamSplittedMessage()
                 },
                 [this, self = this->shared_from_this()](const error::Error& e) mutable {
                     this->reset();
-                    promise_->reject(e);
-                    promise_.reset();
+                    auto promise = std::move(promise_);
+                    promise->reject(e);
                 });
         }
 
@@ -113,8 +149,8 @@ void MessageOutStream::streamSplittedMessage()
     catch(const error::Error& e)
     {
         this->reset();
-        promise_->reject(e);
-        promise_.reset();
+        auto promise = std::move(promise_);
+        promise->reject(e);
     }
 }
 
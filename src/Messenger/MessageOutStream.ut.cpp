@@ -223,6 +223,39 @@ BOOST_FIXTURE_TEST_CASE(MessageOutStream_SendSplittedMessage, MessageOutStreamUn
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(MessageOutStream_SendWithConfiguredFramePayloadSize, MessageOutStreamUnitTest)
+{
+    const FrameHeader frameHeader(ChannelId::VIDEO, FrameType::BULK, EncryptionType::PLAIN, MessageType::SPECIFIC);
+    const common::Data payload(0x6000, 0x5E);
+    const FrameSize frameSize(payload.size());
+
+    const auto& frameHeaderData = frameHeader.getData();
+    common::Data expectedData(frameHeaderData.begin(), frameHeaderData.end());
+
+    const auto& frameSizeData = frameSize.getData();
+    expectedData.insert(expectedData.end(), frameSizeData.begin(), frameSizeData.end());
+    expectedData.insert(expectedData.end(), payload.begin(), payload.end());
+
+    transport::ITransport::SendPromise::Pointer transportSendPromise;
+    EXPECT_CALL(transportMock_, send(expectedData, _)).WillOnce(SaveArg<1>(&transportSendPromise));
+
+    auto message(std::make_shared<Message>(ChannelId::VIDEO, EncryptionType::PLAIN, MessageType::SPECIFIC));
+    message->insertPayload(payload);
+
+    auto messageOutStream(std::make_shared<MessageOutStream>(ioService_, transport_, cryptor_));
+    messageOutStream->setMaxFramePayloadSize(0x8000);
+    BOOST_TEST(messageOutStream->getMaxFramePayloadSize() == 0x8000u);
+
+    messageOutStream->stream(std::move(message), std::move(sendPromise_));
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(sendPromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve());
+    transportSendPromise->resolve();
+    ioService_.run();
+}
+
 }
 }
 }
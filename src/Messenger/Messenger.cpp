@@ -33,6 +33,26 @@ Messenger::Messenger(boost::asio::io_service& ioService, IMessageInStream::Point
     , sendStrand_(ioService)
     , messageInStream_(std::move(messageInStream))
     , messageOutStream_(std::move(messageOutStream))
+    , dispatchMode_(io::DispatchMode::POST)
+    , memoryBudgetExceeded_(false)
+{
+
+}
+
+Messenger::Messenger(boost::asio::io_service::strand& strand, IMessageInStream::Pointer messageInStream, IMessageOutStream::Pointer messageOutStream)
+    : Messenger(strand, strand, std::move(messageInStream), std::move(messageOutStream))
+{
+
+}
+
+Messenger::Messenger(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand,
+                     IMessageInStream::Pointer messageInStream, IMessageOutStream::Pointer messageOutStream)
+    : receiveStrand_(receiveStrand)
+    , sendStrand_(sendStrand)
+    , messageInStream_(std::move(messageInStream))
+    , messageOutStream_(std::move(messageOutStream))
+    , dispatchMode_(io::DispatchMode::INLINE)
+    , memoryBudgetExceeded_(false)
 {
 
 }
@@ -40,9 +60,15 @@ Messenger::Messenger(boost::asio::io_service& ioService, IMessageInStream::Point
 void Messenger::enqueueReceive(ChannelId channelId, ReceivePromise::Pointer promise)
 {
     receiveStrand_.dispatch([this, self = this->shared_from_this(), channelId, promise = std::move(promise)]() mutable {
-        if(!channelReceiveMessageQueue_.empty(channelId))
+        if(memoryBudgetExceeded_)
         {
-            this->parseMessage(channelReceiveMessageQueue_.pop(channelId), promise);
+            promise->reject(error::Error(error::ErrorCode::MEMORY_BUDGET_EXCEEDED));
+        }
+        else if(!channelReceiveMessageQueue_.empty(channelId))
+        {
+            auto message(channelReceiveMessageQueue_.pop(channelId));
+            this->releaseMemory(message->getPayload().size());
+            this->parseMessage(std::move(message), promise);
         }
         else
         {
@@ -50,9 +76,9 @@ void Messenger::enqueueReceive(ChannelId channelId, ReceivePromise::Pointer prom
 
             if(channelReceivePromiseQueue_.size() == 1)
             {
-                auto inStreamPromise = ReceivePromise::defer(receiveStrand_);
+                auto inStreamPromise = ReceivePromise::defer(receiveStrand_, dispatchMode_);
                 inStreamPromise->then(std::bind(&Messenger::inStreamMessageHandler, this->shared_from_this(), std::placeholders::_1),
-                                     std::bind(&Messenger::rejectReceivePromiseQueue, this->shared_from_this(), std::placeholders::_1));
+                                     std::bind(&Messenger::inStreamErrorHandler, this->shared_from_this(), std::placeholders::_1));
                 messageInStream_->startReceive(std::move(inStreamPromise));
             }
         }
@@ -62,6 +88,12 @@ void Messenger::enqueueReceive(ChannelId channelId, ReceivePromise::Pointer prom
 void Messenger::enqueueSend(Message::Pointer message, SendPromise::Pointer promise)
 {
     sendStrand_.dispatch([this, self = this->shared_from_this(), message = std::move(message), promise = std::move(promise)]() mutable {
+        if(memoryBudget_ != nullptr && !memoryBudget_->tryAcquire(message->getPayload().size()))
+        {
+            promise->reject(error::Error(error::ErrorCode::MEMORY_BUDGET_EXCEEDED));
+            return;
+        }
+
         channelSendPromiseQueue_.emplace_back(std::make_pair(std::move(message), std::move(promise)));
 
         if(channelSendPromiseQueue_.size() == 1)
@@ -78,22 +110,37 @@ void Messenger::inStreamMessageHandler(Message::Pointer message)
         //AASDK_LOG(debug) << channelIdToString(message->getChannelId()) << ": " << common::dump(message->getPayload());
     }
 
+    ReceivePromise::Pointer promise;
+
     if(channelReceivePromiseQueue_.isPending(channelId))
     {
-        this->parseMessage(message, channelReceivePromiseQueue_.pop(channelId));
+        promise = channelReceivePromiseQueue_.pop(channelId);
+    }
+    else if(memoryBudget_ == nullptr || memoryBudget_->tryAcquire(message->getPayload().size()))
+    {
+        channelReceiveMessageQueue_.push(message);
     }
     else
     {
-        channelReceiveMessageQueue_.push(std::move(message));
+        AASDK_LOG(error) << "[Messenger] memory budget exceeded, dropping message on channel " << channelIdToString(channelId) << ".";
+        this->inStreamErrorHandler(error::Error(error::ErrorCode::MEMORY_BUDGET_EXCEEDED));
+        return;
     }
 
+    // restart the stream before handing the message out, a receiver completed in place
+    // may enqueue again and must see the stream already busy
     if(!channelReceivePromiseQueue_.empty())
     {
-        auto inStreamPromise = ReceivePromise::defer(receiveStrand_);
+        auto inStreamPromise = ReceivePromise::defer(receiveStrand_, dispatchMode_);
         inStreamPromise->then(std::bind(&Messenger::inStreamMessageHandler, this->shared_from_this(), std::placeholders::_1),
-                             std::bind(&Messenger::rejectReceivePromiseQueue, this->shared_from_this(), std::placeholders::_1));
+                             std::bind(&Messenger::inStreamErrorHandler, this->shared_from_this(), std::placeholders::_1));
         messageInStream_->startReceive(std::move(inStreamPromise));
     }
+
+    if(promise != nullptr)
+    {
+        this->parseMessage(std::move(message), std::move(promise));
+    }
 }
 
 void Messenger::parseMessage(Message::Pointer message, ReceivePromise::Pointer promise) {
@@ -106,15 +153,17 @@ void Messenger::parseMessage(Message::Pointer message, ReceivePromise::Pointer p
 void Messenger::doSend()
 {
     auto queueElementIter = channelSendPromiseQueue_.begin();
-    auto outStreamPromise = SendPromise::defer(sendStrand_);
+    auto outStreamPromise = SendPromise::defer(sendStrand_, dispatchMode_);
     outStreamPromise->then(std::bind(&Messenger::outStreamMessageHandler, this->shared_from_this(), queueElementIter),
                            std::bind(&Messenger::rejectSendPromiseQueue, this->shared_from_this(), std::placeholders::_1));
 
-    messageOutStream_->stream(std::move(queueElementIter->first), std::move(outStreamPromise));
+    // the queue keeps its reference so the payload can be released from the budget on completion
+    messageOutStream_->stream(queueElementIter->first, std::move(outStreamPromise));
 }
 
 void Messenger::outStreamMessageHandler(ChannelSendQueue::iterator queueElement)
 {
+    this->releaseMemory(queueElement->first->getPayload().size());
     queueElement->second->resolve();
     channelSendPromiseQueue_.erase(queueElement);
 
@@ -124,20 +173,40 @@ void Messenger::outStreamMessageHandler(ChannelSendQueue::iterator queueElement)
     }
 }
 
+void Messenger::inStreamErrorHandler(const error::Error& e)
+{
+    if(e == error::ErrorCode::MEMORY_BUDGET_EXCEEDED)
+    {
+        // a message is lost, whatever follows on the stream cannot be trusted
+        memoryBudgetExceeded_ = true;
+        this->releaseMemory(channelReceiveMessageQueue_.getPayloadSize());
+        channelReceiveMessageQueue_.clear();
+    }
+
+    this->rejectReceivePromiseQueue(e);
+}
+
 void Messenger::rejectReceivePromiseQueue(const error::Error& e)
 {
-    while(!channelReceivePromiseQueue_.empty())
+    ChannelReceivePromiseQueue channelReceivePromiseQueue;
+    std::swap(channelReceivePromiseQueue, channelReceivePromiseQueue_);
+
+    while(!channelReceivePromiseQueue.empty())
     {
-        channelReceivePromiseQueue_.pop()->reject(e);
+        channelReceivePromiseQueue.pop()->reject(e);
     }
 }
 
 void Messenger::rejectSendPromiseQueue(const error::Error& e)
 {
-    while(!channelSendPromiseQueue_.empty())
+    ChannelSendQueue channelSendPromiseQueue;
+    std::swap(channelSendPromiseQueue, channelSendPromiseQueue_);
+
+    while(!channelSendPromiseQueue.empty())
     {
-        auto queueElement(std::move(channelSendPromiseQueue_.front()));
-        channelSendPromiseQueue_.pop_front();
+        auto queueElement(std::move(channelSendPromiseQueue.front()));
+        channelSendPromiseQueue.pop_front();
+        this->releaseMemory(queueElement.first->getPayload().size());
         queueElement.second->reject(e);
     }
 }
@@ -145,10 +214,24 @@ void Messenger::rejectSendPromiseQueue(const error::Error& e)
 void Messenger::stop()
 {
     receiveStrand_.dispatch([this, self = this->shared_from_this()]() {
+        this->releaseMemory(channelReceiveMessageQueue_.getPayloadSize());
         channelReceiveMessageQueue_.clear();
     });
 }
 
+void Messenger::setMemoryBudget(common::MemoryBudget::Pointer memoryBudget)
+{
+    memoryBudget_ = std::move(memoryBudget);
+}
+
+void Messenger::releaseMemory(size_t size)
+{
+    if(memoryBudget_ != nullptr)
+    {
+        memoryBudget_->release(size);
+    }
+}
+
 }
 }
 }
@@ -226,6 +226,90 @@ BOOST_FIXTURE_TEST_CASE(Messenger_SendFailed, MessengerUnitTest)
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(Messenger_SendOverMemoryBudgetRejected, MessengerUnitTest)
+{
+    auto memoryBudget(std::make_shared<common::MemoryBudget>(100));
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->setMemoryBudget(memoryBudget);
+
+    Message::Pointer message(std::make_shared<Message>(ChannelId::MEDIA_AUDIO, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    message->getPayload().resize(80);
+    themessenger->enqueueSend(message, std::move(sendPromise_));
+
+    SendPromise::Pointer outStreamSendPromise;
+    EXPECT_CALL(messageOutStreamMock_, stream(message, _)).WillOnce(SaveArg<1>(&outStreamSendPromise));
+
+    ioService_.run();
+    ioService_.reset();
+    BOOST_TEST(memoryBudget->getUsage() == 80u);
+
+    SendPromiseHandlerMock overBudgetPromiseHandlerMock;
+    auto overBudgetPromise = SendPromise::defer(ioService_);
+    overBudgetPromise->then(std::bind(&SendPromiseHandlerMock::onResolve, &overBudgetPromiseHandlerMock),
+                           std::bind(&SendPromiseHandlerMock::onReject, &overBudgetPromiseHandlerMock, std::placeholders::_1));
+    themessenger->enqueueSend(message, std::move(overBudgetPromise));
+
+    EXPECT_CALL(overBudgetPromiseHandlerMock, onReject(error::Error(error::ErrorCode::MEMORY_BUDGET_EXCEEDED)));
+    EXPECT_CALL(overBudgetPromiseHandlerMock, onResolve()).Times(0);
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(sendPromiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve());
+    outStreamSendPromise->resolve();
+    ioService_.run();
+
+    BOOST_TEST(memoryBudget->getUsage() == 0u);
+    BOOST_TEST(memoryBudget->getPeakUsage() == 80u);
+    BOOST_TEST(memoryBudget->getRejectionCount() == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(Messenger_ReceiveQueueOverMemoryBudgetIsFatal, MessengerUnitTest)
+{
+    auto memoryBudget(std::make_shared<common::MemoryBudget>(100));
+    auto themessenger(std::make_shared<Messenger>(ioService_, messageInStream_, messageOutStream_));
+    themessenger->setMemoryBudget(memoryBudget);
+    themessenger->enqueueReceive(ChannelId::MEDIA_AUDIO, std::move(receivePromise_));
+
+    ReceivePromise::Pointer inStreamReceivePromise;
+    EXPECT_CALL(messageInStreamMock_, startReceive(_)).Times(2).WillRepeatedly(SaveArg<0>(&inStreamReceivePromise));
+
+    ioService_.run();
+    ioService_.reset();
+
+    // nobody receives on the input channel, its messages pile up in the queue
+    Message::Pointer inputChannelMessage(std::make_shared<Message>(ChannelId::INPUT, EncryptionType::ENCRYPTED, MessageType::SPECIFIC));
+    inputChannelMessage->getPayload().resize(80);
+    inStreamReceivePromise->resolve(inputChannelMessage);
+
+    ioService_.run();
+    ioService_.reset();
+    BOOST_TEST(memoryBudget->getUsage() == 80u);
+
+    inStreamReceivePromise->resolve(inputChannelMessage);
+
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(error::Error(error::ErrorCode::MEMORY_BUDGET_EXCEEDED)));
+    EXPECT_CALL(receivePromiseHandlerMock_, onResolve(_)).Times(0);
+    ioService_.run();
+    ioService_.reset();
+    BOOST_TEST(memoryBudget->getUsage() == 0u);
+
+    // the stream is not restarted, later receives fail as well
+    ReceivePromiseHandlerMock laterReceivePromiseHandlerMock;
+    auto laterReceivePromise = ReceivePromise::defer(ioService_);
+    laterReceivePromise->then(std::bind(&ReceivePromiseHandlerMock::onResolve, &laterReceivePromiseHandlerMock, std::placeholders::_1),
+                              std::bind(&ReceivePromiseHandlerMock::onReject, &laterReceivePromiseHandlerMock, std::placeholders::_1));
+    EXPECT_CALL(laterReceivePromiseHandlerMock, onReject(error::Error(error::ErrorCode::MEMORY_BUDGET_EXCEEDED)));
+    EXPECT_CALL(laterReceivePromiseHandlerMock, onResolve(_)).Times(0);
+    themessenger->enqueueReceive(ChannelId::INPUT, std::move(laterReceivePromise));
+    ioService_.run();
+    ioService_.reset();
+
+    themessenger->stop();
+    ioService_.run();
+    BOOST_TEST(memoryBudget->getUsage() == 0u);
+}
+
 }
 }
 }
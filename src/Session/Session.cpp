@@ -0,0 +1,111 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/USB/AOAPDevice.hpp>
+#include <f1x/aasdk/Transport/USBTransport.hpp>
+#include <f1x/aasdk/Messenger/MessageInStream.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+#include <f1x/aasdk/Messenger/Messenger.hpp>
+#include <f1x/aasdk/Session/Session.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace session
+{
+
+Session::Session(SessionId id, usb::IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, size_t memoryLimit, size_t receiveBufferSize)
+    : id_(id)
+    , usbWrapper_(usbWrapper)
+    , receiveStrand_(ioService)
+    , sendStrand_(ioService)
+    , memoryBudget_(std::make_shared<common::MemoryBudget>(memoryLimit))
+    , receiveBufferSize_(receiveBufferSize)
+    , transportCounters_(std::make_shared<transport::MeteredTransport::Counters>())
+    , startTime_(std::chrono::steady_clock::now())
+{
+
+}
+
+transport::ITransport::Pointer Session::createUSBTransport(usb::DeviceHandle handle)
+{
+    auto aoapDevice(usb::AOAPDevice::create(usbWrapper_, receiveStrand_, sendStrand_, std::move(handle)));
+    return this->meterTransport(std::make_shared<transport::USBTransport>(receiveStrand_, sendStrand_, memoryBudget_, receiveBufferSize_, std::move(aoapDevice)));
+}
+
+transport::ITransport::Pointer Session::meterTransport(transport::ITransport::Pointer transport)
+{
+    return std::make_shared<transport::MeteredTransport>(receiveStrand_, sendStrand_, std::move(transport), transportCounters_);
+}
+
+messenger::IMessenger::Pointer Session::createMessenger(transport::ITransport::Pointer transport, messenger::ICryptor::Pointer cryptor)
+{
+    auto messageInStream(std::make_shared<messenger::MessageInStream>(receiveStrand_, transport, cryptor));
+    messageInStream->setMemoryBudget(memoryBudget_);
+    auto messageOutStream(std::make_shared<messenger::MessageOutStream>(sendStrand_, std::move(transport), std::move(cryptor)));
+    auto messenger(std::make_shared<messenger::Messenger>(receiveStrand_, sendStrand_, std::move(messageInStream), std::move(messageOutStream)));
+    messenger->setMemoryBudget(memoryBudget_);
+    return messenger;
+}
+
+SessionId Session::getId() const
+{
+    return id_;
+}
+
+boost::asio::io_service::strand& Session::getReceiveStrand()
+{
+    return receiveStrand_;
+}
+
+boost::asio::io_service::strand& Session::getSendStrand()
+{
+    return sendStrand_;
+}
+
+const common::MemoryBudget& Session::getMemoryBudget() const
+{
+    return *memoryBudget_;
+}
+
+SessionStatistics Session::getStatistics() const
+{
+    SessionStatistics statistics;
+    statistics.id = id_;
+    statistics.elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime_);
+    statistics.receivedBytes = transportCounters_->receivedBytes;
+    statistics.sentBytes = transportCounters_->sentBytes;
+
+    const double seconds = std::chrono::duration<double>(statistics.elapsed).count();
+    if(seconds > 0)
+    {
+        statistics.receiveThroughput = statistics.receivedBytes / seconds;
+        statistics.sendThroughput = statistics.sentBytes / seconds;
+    }
+
+    statistics.memoryUsage = memoryBudget_->getUsage();
+    statistics.peakMemoryUsage = memoryBudget_->getPeakUsage();
+    statistics.memoryLimit = memoryBudget_->getLimit();
+    statistics.memoryRejections = memoryBudget_->getRejectionCount();
+    return statistics;
+}
+
+}
+}
+}
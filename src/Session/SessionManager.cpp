@@ -0,0 +1,130 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Common/Log.hpp>
+#include <f1x/aasdk/Session/SessionManager.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace session
+{
+
+constexpr size_t SessionManagerConfiguration::cDefaultSessionReceiveBufferSize;
+
+SessionManager::SessionManager(usb::IUSBWrapper& usbWrapper, SessionManagerConfiguration configuration)
+    : usbWrapper_(usbWrapper)
+    , sessionMemoryLimit_(configuration.sessionMemoryLimit)
+    , sessionReceiveBufferSize_(configuration.sessionReceiveBufferSize)
+    , workerPool_(std::move(configuration.workers))
+    , usbEventThread_(std::move(configuration.usbEventThread))
+    , nextSessionId_(0)
+{
+
+}
+
+SessionManager::~SessionManager()
+{
+    this->stop();
+}
+
+void SessionManager::start()
+{
+    workerPool_.start();
+    usbEventThread_.start([this]() {
+        usbWrapper_.handleEvents();
+    });
+}
+
+void SessionManager::stop()
+{
+    usbEventThread_.stop();
+    usbWrapper_.interruptEventHandler();
+    workerPool_.stop();
+    usbEventThread_.join();
+}
+
+Session::Pointer SessionManager::createSession()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    const auto id = nextSessionId_++;
+    auto session(std::make_shared<Session>(id, usbWrapper_, workerPool_.getIOService(), sessionMemoryLimit_, sessionReceiveBufferSize_));
+    sessions_.emplace(id, session);
+
+    AASDK_LOG(info) << "[SessionManager] session " << id << " created, active sessions: " << sessions_.size() << ".";
+    return session;
+}
+
+void SessionManager::releaseSession(SessionId id)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    sessions_.erase(id);
+}
+
+std::vector<Session::Pointer> SessionManager::getSessions() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    std::vector<Session::Pointer> sessions;
+    for(const auto& session : sessions_)
+    {
+        sessions.push_back(session.second);
+    }
+
+    return sessions;
+}
+
+SessionManagerReport SessionManager::getReport() const
+{
+    SessionManagerReport report;
+
+    for(const auto& session : this->getSessions())
+    {
+        auto statistics(session->getStatistics());
+
+        report.aggregate.elapsed = std::max(report.aggregate.elapsed, statistics.elapsed);
+        report.aggregate.receivedBytes += statistics.receivedBytes;
+        report.aggregate.sentBytes += statistics.sentBytes;
+        report.aggregate.receiveThroughput += statistics.receiveThroughput;
+        report.aggregate.sendThroughput += statistics.sendThroughput;
+        report.aggregate.memoryUsage += statistics.memoryUsage;
+        report.aggregate.peakMemoryUsage += statistics.peakMemoryUsage;
+        report.aggregate.memoryLimit += statistics.memoryLimit;
+        report.aggregate.memoryRejections += statistics.memoryRejections;
+        report.sessions.push_back(std::move(statistics));
+    }
+
+    report.workerCPUTime = workerPool_.getCPUTime();
+    return report;
+}
+
+io::WorkerPool& SessionManager::getWorkerPool()
+{
+    return workerPool_;
+}
+
+const io::IOThread& SessionManager::getUSBEventThread() const
+{
+    return usbEventThread_;
+}
+
+}
+}
+}
@@ -0,0 +1,179 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <deque>
+#include <future>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/USB/UT/USBWrapper.mock.hpp>
+#include <f1x/aasdk/Transport/UT/Transport.mock.hpp>
+#include <f1x/aasdk/Messenger/UT/Cryptor.mock.hpp>
+#include <f1x/aasdk/Messenger/FrameHeader.hpp>
+#include <f1x/aasdk/Messenger/FrameSize.hpp>
+#include <f1x/aasdk/Session/SessionManager.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace session
+{
+namespace ut
+{
+
+using ::testing::_;
+using ::testing::AnyNumber;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+class SessionManagerUnitTest
+{
+protected:
+    SessionManagerUnitTest()
+    {
+        ON_CALL(usbWrapperMock_, handleEvents()).WillByDefault(Invoke([]() { std::this_thread::sleep_for(std::chrono::milliseconds(1)); }));
+        configuration_.workers = io::WorkerPool::createConfiguration(4, "aasdk-ut");
+        configuration_.sessionMemoryLimit = 1024;
+    }
+
+    NiceMock<usb::ut::USBWrapperMock> usbWrapperMock_;
+    SessionManagerConfiguration configuration_;
+};
+
+BOOST_FIXTURE_TEST_CASE(SessionManager_ReportsPerSessionAndAggregateThroughput, SessionManagerUnitTest)
+{
+    SessionManager sessionManager(usbWrapperMock_, configuration_);
+    sessionManager.start();
+
+    const size_t sessionCount = 16;
+    std::vector<Session::Pointer> sessions;
+    std::vector<std::unique_ptr<NiceMock<transport::ut::TransportMock>>> transportMocks;
+    std::vector<std::future<void>> received;
+
+    for(size_t i = 0; i < sessionCount; ++i)
+    {
+        sessions.push_back(sessionManager.createSession());
+        transportMocks.push_back(std::make_unique<NiceMock<transport::ut::TransportMock>>());
+
+        // each session's transport completes on a worker with a session specific amount of data
+        const size_t size = 100 * (i + 1);
+        auto& strand = sessions.back()->getReceiveStrand();
+        ON_CALL(*transportMocks.back(), receive(_, _)).WillByDefault(Invoke([&strand, size](size_t, transport::ITransport::ReceivePromise::Pointer promise) {
+            strand.post([promise, size]() { promise->resolve(common::Data(size, 0)); });
+        }));
+
+        auto transport(sessions.back()->meterTransport(transport::ITransport::Pointer(transportMocks.back().get(), [](auto*) {})));
+        auto promise(std::make_shared<std::promise<void>>());
+        received.push_back(promise->get_future());
+
+        auto receivePromise = transport::ITransport::ReceivePromise::defer(sessions.back()->getReceiveStrand());
+        receivePromise->then([promise](common::Data) { promise->set_value(); });
+        transport->receive(size, std::move(receivePromise));
+    }
+
+    for(auto& future : received)
+    {
+        BOOST_TEST((future.wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+    }
+
+    const auto report(sessionManager.getReport());
+    BOOST_TEST(report.sessions.size() == sessionCount);
+    for(size_t i = 0; i < sessionCount; ++i)
+    {
+        BOOST_TEST(report.sessions[i].id == sessions[i]->getId());
+        BOOST_TEST(report.sessions[i].receivedBytes == 100 * (i + 1));
+        BOOST_TEST(report.sessions[i].receiveThroughput > 0);
+        BOOST_TEST(report.sessions[i].memoryLimit == 1024u);
+    }
+
+    BOOST_TEST(report.aggregate.receivedBytes == 100 * sessionCount * (sessionCount + 1) / 2);
+    BOOST_TEST(report.aggregate.sentBytes == 0u);
+
+    sessionManager.stop();
+}
+
+BOOST_FIXTURE_TEST_CASE(SessionManager_ReleasedSessionLeavesReport, SessionManagerUnitTest)
+{
+    SessionManager sessionManager(usbWrapperMock_, configuration_);
+
+    auto first(sessionManager.createSession());
+    auto second(sessionManager.createSession());
+    BOOST_TEST(first->getId() != second->getId());
+    BOOST_TEST(first->getMemoryBudget().getLimit() == 1024u);
+
+    sessionManager.releaseSession(first->getId());
+
+    const auto sessions(sessionManager.getSessions());
+    BOOST_TEST(sessions.size() == 1u);
+    BOOST_TEST(sessions.front() == second);
+    BOOST_TEST(sessionManager.getReport().sessions.size() == 1u);
+}
+
+BOOST_FIXTURE_TEST_CASE(SessionManager_ReassemblyChargedToSession, SessionManagerUnitTest)
+{
+    configuration_.sessionMemoryLimit = 1000;
+    SessionManager sessionManager(usbWrapperMock_, configuration_);
+    sessionManager.start();
+    auto session(sessionManager.createSession());
+    auto& strand = session->getReceiveStrand();
+
+    // one message split into two frames of 600 bytes, the second one does not fit the budget
+    const common::Data framePayload(600, 0x5E);
+    std::deque<common::Data> frames{
+        messenger::FrameHeader(messenger::ChannelId::INPUT, messenger::FrameType::FIRST, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC).getData(),
+        messenger::FrameSize(framePayload.size(), framePayload.size() * 2).getData(),
+        framePayload,
+        messenger::FrameHeader(messenger::ChannelId::INPUT, messenger::FrameType::LAST, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC).getData(),
+        messenger::FrameSize(framePayload.size()).getData(),
+        framePayload
+    };
+
+    NiceMock<transport::ut::TransportMock> transportMock;
+    ON_CALL(transportMock, receive(_, _)).WillByDefault(Invoke([&strand, &frames](size_t, transport::ITransport::ReceivePromise::Pointer promise) {
+        if(!frames.empty())
+        {
+            auto data(std::move(frames.front()));
+            frames.pop_front();
+            strand.post([promise, data]() { promise->resolve(data); });
+        }
+    }));
+
+    NiceMock<messenger::ut::CryptorMock> cryptorMock;
+    auto messenger(session->createMessenger(transport::ITransport::Pointer(&transportMock, [](auto*) {}),
+                                            messenger::ICryptor::Pointer(&cryptorMock, [](auto*) {})));
+
+    std::promise<error::Error> rejected;
+    auto receivePromise = messenger::ReceivePromise::defer(strand);
+    receivePromise->then([](messenger::Message::Pointer) {}, [&rejected](const error::Error& e) { rejected.set_value(e); });
+    messenger->enqueueReceive(messenger::ChannelId::INPUT, std::move(receivePromise));
+
+    auto future(rejected.get_future());
+    BOOST_REQUIRE((future.wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+    BOOST_CHECK(future.get() == error::ErrorCode::MEMORY_BUDGET_EXCEEDED);
+
+    const auto statistics(session->getStatistics());
+    BOOST_TEST(statistics.peakMemoryUsage == 600u);
+    BOOST_TEST(statistics.memoryUsage == 0u);
+    BOOST_TEST(statistics.memoryRejections == 1u);
+
+    sessionManager.stop();
+}
+
+}
+}
+}
+}
@@ -0,0 +1,129 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/USB/AOAPDevice.hpp>
+#include <f1x/aasdk/Transport/USBTransport.hpp>
+#include <f1x/aasdk/Messenger/MessageInStream.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+#include <f1x/aasdk/Messenger/Messenger.hpp>
+#include <f1x/aasdk/Session/SessionRuntime.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace session
+{
+
+SessionRuntime::SessionRuntime(usb::IUSBWrapper& usbWrapper,
+                               io::IOThreadConfiguration usbEventThreadConfiguration,
+                               io::IOThreadConfiguration receiveThreadConfiguration,
+                               io::IOThreadConfiguration sendThreadConfiguration,
+                               io::IOThreadConfiguration audioThreadConfiguration)
+    : usbWrapper_(usbWrapper)
+    , usbEventThread_(std::move(usbEventThreadConfiguration))
+    , receiveThread_(std::move(receiveThreadConfiguration))
+    , sendThread_(std::move(sendThreadConfiguration))
+    , audioThread_(std::move(audioThreadConfiguration))
+    , receiveStrand_(receiveThread_.getIOService())
+    , sendStrand_(sendThread_.getIOService())
+    , audioStrand_(audioThread_.getIOService())
+{
+
+}
+
+SessionRuntime::~SessionRuntime()
+{
+    this->stop();
+}
+
+void SessionRuntime::start()
+{
+    receiveThread_.start();
+    sendThread_.start();
+    audioThread_.start();
+    usbEventThread_.start([this]() {
+        usbWrapper_.handleEvents();
+    });
+}
+
+void SessionRuntime::stop()
+{
+    usbEventThread_.stop();
+    usbWrapper_.interruptEventHandler();
+    receiveThread_.stop();
+    sendThread_.stop();
+    audioThread_.stop();
+
+    usbEventThread_.join();
+    receiveThread_.join();
+    sendThread_.join();
+    audioThread_.join();
+}
+
+transport::ITransport::Pointer SessionRuntime::createUSBTransport(usb::DeviceHandle handle)
+{
+    auto aoapDevice(usb::AOAPDevice::create(usbWrapper_, receiveStrand_, sendStrand_, std::move(handle)));
+    return std::make_shared<transport::USBTransport>(receiveStrand_, sendStrand_, std::move(aoapDevice));
+}
+
+messenger::IMessenger::Pointer SessionRuntime::createMessenger(transport::ITransport::Pointer transport, messenger::ICryptor::Pointer cryptor)
+{
+    auto messageInStream(std::make_shared<messenger::MessageInStream>(receiveStrand_, transport, cryptor));
+    auto messageOutStream(std::make_shared<messenger::MessageOutStream>(sendStrand_, std::move(transport), std::move(cryptor)));
+    return std::make_shared<messenger::Messenger>(receiveStrand_, sendStrand_, std::move(messageInStream), std::move(messageOutStream));
+}
+
+boost::asio::io_service::strand& SessionRuntime::getReceiveStrand()
+{
+    return receiveStrand_;
+}
+
+boost::asio::io_service::strand& SessionRuntime::getSendStrand()
+{
+    return sendStrand_;
+}
+
+boost::asio::io_service::strand& SessionRuntime::getAudioStrand()
+{
+    return audioStrand_;
+}
+
+const io::IOThread& SessionRuntime::getUSBEventThread() const
+{
+    return usbEventThread_;
+}
+
+const io::IOThread& SessionRuntime::getReceiveThread() const
+{
+    return receiveThread_;
+}
+
+const io::IOThread& SessionRuntime::getSendThread() const
+{
+    return sendThread_;
+}
+
+const io::IOThread& SessionRuntime::getAudioThread() const
+{
+    return audioThread_;
+}
+
+}
+}
+}
@@ -0,0 +1,149 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <future>
+#include <pthread.h>
+#include <sched.h>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/USB/UT/USBWrapper.mock.hpp>
+#include <f1x/aasdk/Session/SessionRuntime.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace session
+{
+namespace ut
+{
+
+using ::testing::AtLeast;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+
+class SessionRuntimeUnitTest
+{
+protected:
+    SessionRuntimeUnitTest()
+    {
+        ON_CALL(usbWrapperMock_, handleEvents()).WillByDefault(Invoke([]() { spin(std::chrono::milliseconds(1)); }));
+    }
+
+    static void spin(std::chrono::milliseconds duration)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + duration;
+        while(std::chrono::steady_clock::now() < deadline);
+    }
+
+    static std::string getThreadName()
+    {
+        char name[16] = {0};
+        pthread_getname_np(pthread_self(), name, sizeof(name));
+        return name;
+    }
+
+    NiceMock<usb::ut::USBWrapperMock> usbWrapperMock_;
+};
+
+BOOST_FIXTURE_TEST_CASE(SessionRuntime_StrandsRunOnConfiguredThreads, SessionRuntimeUnitTest)
+{
+    cpu_set_t allowedCpus;
+    CPU_ZERO(&allowedCpus);
+    sched_getaffinity(0, sizeof(allowedCpus), &allowedCpus);
+
+    int core = CPU_SETSIZE - 1;
+    while(core > 0 && !CPU_ISSET(core, &allowedCpus))
+    {
+        --core;
+    }
+
+    SessionRuntime sessionRuntime(usbWrapperMock_,
+                                  io::IOThreadConfiguration{"aasdk-ut-usb", -1, 0},
+                                  io::IOThreadConfiguration{"aasdk-ut-rx", core, 0},
+                                  io::IOThreadConfiguration{"aasdk-ut-tx", -1, 0},
+                                  io::IOThreadConfiguration{"aasdk-ut-audio", -1, 0});
+    sessionRuntime.start();
+
+    std::promise<std::pair<std::string, int>> receive;
+    std::promise<std::string> send;
+    std::promise<std::string> audio;
+    sessionRuntime.getReceiveStrand().post([&]() { receive.set_value(std::make_pair(getThreadName(), sched_getcpu())); });
+    sessionRuntime.getSendStrand().post([&]() { send.set_value(getThreadName()); });
+    sessionRuntime.getAudioStrand().post([&]() { audio.set_value(getThreadName()); });
+
+    const auto receiveThread = receive.get_future().get();
+    BOOST_TEST(receiveThread.first == "aasdk-ut-rx");
+    BOOST_TEST(receiveThread.second == core);
+    BOOST_TEST(send.get_future().get() == "aasdk-ut-tx");
+    BOOST_TEST(audio.get_future().get() == "aasdk-ut-audio");
+
+    sessionRuntime.stop();
+}
+
+BOOST_FIXTURE_TEST_CASE(SessionRuntime_ReportsCPUTimePerThread, SessionRuntimeUnitTest)
+{
+    EXPECT_CALL(usbWrapperMock_, handleEvents()).Times(AtLeast(1));
+    EXPECT_CALL(usbWrapperMock_, interruptEventHandler()).Times(AtLeast(1));
+
+    SessionRuntime sessionRuntime(usbWrapperMock_,
+                                  io::IOThreadConfiguration{"aasdk-ut-usb", -1, 0},
+                                  io::IOThreadConfiguration{"aasdk-ut-rx", -1, 0},
+                                  io::IOThreadConfiguration{"aasdk-ut-tx", -1, 0},
+                                  io::IOThreadConfiguration{"aasdk-ut-audio", -1, 0});
+    sessionRuntime.start();
+
+    std::promise<void> receive;
+    std::promise<void> send;
+    std::promise<void> audio;
+    sessionRuntime.getReceiveStrand().post([&]() { spin(std::chrono::milliseconds(20)); receive.set_value(); });
+    sessionRuntime.getSendStrand().post([&]() { spin(std::chrono::milliseconds(20)); send.set_value(); });
+    sessionRuntime.getAudioStrand().post([&]() { spin(std::chrono::milliseconds(20)); audio.set_value(); });
+
+    receive.get_future().wait();
+    send.get_future().wait();
+    audio.get_future().wait();
+    BOOST_TEST(sessionRuntime.getReceiveThread().getCPUTime().count() > 0);
+
+    sessionRuntime.stop();
+
+    BOOST_TEST(sessionRuntime.getUSBEventThread().getCPUTime().count() > 0);
+    BOOST_TEST(sessionRuntime.getReceiveThread().getCPUTime().count() > 0);
+    BOOST_TEST(sessionRuntime.getSendThread().getCPUTime().count() > 0);
+    BOOST_TEST(sessionRuntime.getAudioThread().getCPUTime().count() > 0);
+}
+
+BOOST_FIXTURE_TEST_CASE(SessionRuntime_RestartsAfterStop, SessionRuntimeUnitTest)
+{
+    SessionRuntime sessionRuntime(usbWrapperMock_,
+                                  io::IOThreadConfiguration{"aasdk-ut-usb", -1, 0},
+                                  io::IOThreadConfiguration{"aasdk-ut-rx", -1, 0},
+                                  io::IOThreadConfiguration{"aasdk-ut-tx", -1, 0},
+                                  io::IOThreadConfiguration{"aasdk-ut-audio", -1, 0});
+    sessionRuntime.start();
+    sessionRuntime.stop();
+    sessionRuntime.start();
+
+    std::promise<void> done;
+    sessionRuntime.getSendStrand().post([&]() { done.set_value(); });
+    BOOST_TEST((done.get_future().wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+}
+
+}
+}
+}
+}
@@ -16,6 +16,7 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <cstring>
 #include <f1x/aasdk/Transport/DataSink.hpp>
 #include <f1x/aasdk/Error/Error.hpp>
@@ -27,28 +28,55 @@ namespace aasdk
 namespace transport
 {
 
-DataSink::DataSink()
-    : data_(common::cStaticDataSize)
+constexpr common::Data::size_type DataSink::cDefaultChunkSize;
+
+DataSink::DataSink(common::Data::size_type chunkSize, common::Data::size_type capacity)
+    : data_(capacity)
+    , chunkSize_(chunkSize)
+    , filledSize_(0)
+{
+}
+
+void DataSink::setChunkSize(common::Data::size_type chunkSize)
+{
+    chunkSize_ = chunkSize;
+}
+
+common::Data::size_type DataSink::getChunkSize() const
 {
+    return chunkSize_;
+}
+
+common::Data::size_type DataSink::getCapacity() const
+{
+    return data_.capacity();
 }
 
 common::DataBuffer DataSink::fill()
 {
     const auto offset = data_.size();
-    data_.resize(data_.size() + cChunkSize);
+    filledSize_ = std::min(chunkSize_, data_.capacity() - offset);
+
+    if(filledSize_ == 0)
+    {
+        throw error::Error(error::ErrorCode::DATA_SINK_FULL);
+    }
+
+    data_.resize(data_.size() + filledSize_);
 
     auto ptr = data_.is_linearized() ? &data_[offset] : data_.linearize() + offset;
-    return common::DataBuffer(ptr, cChunkSize);
+    return common::DataBuffer(ptr, filledSize_);
 }
 
 void DataSink::commit(common::Data::size_type size)
 {
-    if(size > cChunkSize)
+    if(size > filledSize_)
     {
         throw error::Error(error::ErrorCode::DATA_SINK_COMMIT_OVERFLOW);
     }
 
-    data_.erase_end((cChunkSize - size));
+    data_.erase_end((filledSize_ - size));
+    filledSize_ = 0;
 }
 
 common::Data::size_type DataSink::getAvailableSize()
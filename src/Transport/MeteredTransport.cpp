@@ -0,0 +1,79 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <f1x/aasdk/Transport/MeteredTransport.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+
+MeteredTransport::MeteredTransport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand, ITransport::Pointer transport,
+                                   Counters::Pointer counters)
+    : receiveStrand_(receiveStrand)
+    , sendStrand_(sendStrand)
+    , transport_(std::move(transport))
+    , counters_(std::move(counters))
+{
+
+}
+
+void MeteredTransport::receive(size_t size, ReceivePromise::Pointer promise)
+{
+    auto transportPromise = ReceivePromise::defer(receiveStrand_, io::DispatchMode::INLINE);
+    transportPromise->then([this, self = this->shared_from_this(), promise](common::Data data) {
+                               counters_->receivedBytes += data.size();
+                               promise->resolve(std::move(data));
+                           },
+                           [promise](const error::Error& e) {
+                               promise->reject(e);
+                           });
+
+    transport_->receive(size, std::move(transportPromise));
+}
+
+void MeteredTransport::send(common::Data data, SendPromise::Pointer promise)
+{
+    const auto size = data.size();
+    auto transportPromise = SendPromise::defer(sendStrand_, io::DispatchMode::INLINE);
+    transportPromise->then([this, self = this->shared_from_this(), size, promise]() {
+                               counters_->sentBytes += size;
+                               promise->resolve();
+                           },
+                           [promise](const error::Error& e) {
+                               promise->reject(e);
+                           });
+
+    transport_->send(std::move(data), std::move(transportPromise));
+}
+
+void MeteredTransport::stop()
+{
+    transport_->stop();
+}
+
+const MeteredTransport::Counters& MeteredTransport::getCounters() const
+{
+    return *counters_;
+}
+
+}
+}
+}
@@ -0,0 +1,114 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Transport/UT/Transport.mock.hpp>
+#include <f1x/aasdk/Transport/UT/TransportReceivePromiseHandler.mock.hpp>
+#include <f1x/aasdk/Transport/UT/TransportSendPromiseHandler.mock.hpp>
+#include <f1x/aasdk/Transport/MeteredTransport.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+namespace ut
+{
+
+using ::testing::SaveArg;
+using ::testing::_;
+
+class MeteredTransportUnitTest
+{
+protected:
+    MeteredTransportUnitTest()
+        : strand_(ioService_)
+        , transport_(&transportMock_, [](auto*) {})
+        , receivePromise_(ITransport::ReceivePromise::defer(ioService_))
+        , sendPromise_(ITransport::SendPromise::defer(ioService_))
+    {
+        receivePromise_->then(std::bind(&TransportReceivePromiseHandlerMock::onResolve, &receivePromiseHandlerMock_, std::placeholders::_1),
+                             std::bind(&TransportReceivePromiseHandlerMock::onReject, &receivePromiseHandlerMock_, std::placeholders::_1));
+
+        sendPromise_->then(std::bind(&TransportSendPromiseHandlerMock::onResolve, &sendPromiseHandlerMock_),
+                          std::bind(&TransportSendPromiseHandlerMock::onReject, &sendPromiseHandlerMock_, std::placeholders::_1));
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+    TransportMock transportMock_;
+    ITransport::Pointer transport_;
+    TransportReceivePromiseHandlerMock receivePromiseHandlerMock_;
+    ITransport::ReceivePromise::Pointer receivePromise_;
+    TransportSendPromiseHandlerMock sendPromiseHandlerMock_;
+    ITransport::SendPromise::Pointer sendPromise_;
+};
+
+BOOST_FIXTURE_TEST_CASE(MeteredTransport_CountsCompletedTransfers, MeteredTransportUnitTest)
+{
+    auto counters(std::make_shared<MeteredTransport::Counters>());
+    auto meteredTransport(std::make_shared<MeteredTransport>(strand_, strand_, transport_, counters));
+
+    ITransport::ReceivePromise::Pointer transportReceivePromise;
+    EXPECT_CALL(transportMock_, receive(100, _)).WillOnce(SaveArg<1>(&transportReceivePromise));
+    meteredTransport->receive(100, std::move(receivePromise_));
+
+    ITransport::SendPromise::Pointer transportSendPromise;
+    EXPECT_CALL(transportMock_, send(common::Data(30, 0x5E), _)).WillOnce(SaveArg<1>(&transportSendPromise));
+    meteredTransport->send(common::Data(30, 0x5E), std::move(sendPromise_));
+
+    const common::Data receivedData(100, 0x5A);
+    EXPECT_CALL(receivePromiseHandlerMock_, onResolve(receivedData));
+    EXPECT_CALL(sendPromiseHandlerMock_, onResolve());
+    transportReceivePromise->resolve(receivedData);
+    transportSendPromise->resolve();
+    ioService_.run();
+
+    BOOST_TEST(meteredTransport->getCounters().receivedBytes.load() == 100u);
+    BOOST_TEST(meteredTransport->getCounters().sentBytes.load() == 30u);
+    BOOST_TEST(counters->receivedBytes.load() == 100u);
+}
+
+BOOST_FIXTURE_TEST_CASE(MeteredTransport_FailedTransfersAreNotCounted, MeteredTransportUnitTest)
+{
+    auto meteredTransport(std::make_shared<MeteredTransport>(strand_, strand_, transport_));
+
+    ITransport::ReceivePromise::Pointer transportReceivePromise;
+    EXPECT_CALL(transportMock_, receive(100, _)).WillOnce(SaveArg<1>(&transportReceivePromise));
+    meteredTransport->receive(100, std::move(receivePromise_));
+
+    ITransport::SendPromise::Pointer transportSendPromise;
+    EXPECT_CALL(transportMock_, send(_, _)).WillOnce(SaveArg<1>(&transportSendPromise));
+    meteredTransport->send(common::Data(30, 0x5E), std::move(sendPromise_));
+
+    const error::Error e(error::ErrorCode::USB_TRANSFER, 5);
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(e));
+    EXPECT_CALL(sendPromiseHandlerMock_, onReject(e));
+    transportReceivePromise->reject(e);
+    transportSendPromise->reject(e);
+    ioService_.run();
+
+    BOOST_TEST(meteredTransport->getCounters().receivedBytes.load() == 0u);
+    BOOST_TEST(meteredTransport->getCounters().sentBytes.load() == 0u);
+}
+
+}
+}
+}
+}
@@ -16,6 +16,7 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <string>
 #include <openssl/engine.h>
 #include <openssl/err.h>
@@ -78,6 +79,15 @@ const SSL_METHOD* SSLWrapper::getMethod()
 #endif
 }
 
+const SSL_METHOD* SSLWrapper::getServerMethod()
+{
+#if (OPENSSL_VERSION_NUMBER < 0x10100000L)
+    return TLSv1_2_server_method();
+#else
+    return TLS_server_method();
+#endif
+}
+
 SSL_CTX* SSLWrapper::createContext(const SSL_METHOD* method)
 {
     return SSL_CTX_new(method);
@@ -93,6 +103,52 @@ bool SSLWrapper::usePrivateKey(SSL_CTX* context, EVP_PKEY* privateKey)
     return SSL_CTX_use_PrivateKey(context, privateKey) == 1;
 }
 
+bool SSLWrapper::setCipherList(SSL_CTX* context, const std::string& cipherList)
+{
+    // OpenSSL only fails when nothing in the list matched, so every name is tried on its own first
+    for(const auto& name : splitCipherNames(cipherList))
+    {
+        const bool modifier = name.find_first_of("!-+@") == 0;
+        if(!modifier && SSL_CTX_set_cipher_list(context, name.c_str()) != 1)
+        {
+            return false;
+        }
+    }
+
+    return SSL_CTX_set_cipher_list(context, cipherList.c_str()) == 1;
+}
+
+bool SSLWrapper::setCipherSuites(SSL_CTX* context, const std::string& cipherSuites)
+{
+#if (OPENSSL_VERSION_NUMBER >= 0x10101000L)
+    if(SSL_CTX_set_ciphersuites(context, cipherSuites.c_str()) != 1)
+    {
+        return false;
+    }
+
+    // unknown suites are skipped silently, each name has to show up among the enabled ciphers
+    const auto ciphers = SSL_CTX_get_ciphers(context);
+    for(const auto& name : splitCipherNames(cipherSuites))
+    {
+        bool found = false;
+        for(int i = 0; i < sk_SSL_CIPHER_num(ciphers) && !found; ++i)
+        {
+            found = name == SSL_CIPHER_get_name(sk_SSL_CIPHER_value(ciphers, i));
+        }
+
+        if(!found)
+        {
+            return false;
+        }
+    }
+
+    return true;
+#else
+    // no TLS 1.3 support, nothing to restrict
+    return true;
+#endif
+}
+
 SSL* SSLWrapper::createInstance(SSL_CTX* context)
 {
     return SSL_new(context);
@@ -123,6 +179,16 @@ void SSLWrapper::setConnectState(SSL* ssl)
     SSL_set_verify(ssl, SSL_VERIFY_NONE, nullptr);
 }
 
+void SSLWrapper::setAcceptState(SSL* ssl)
+{
+    SSL_set_accept_state(ssl);
+    SSL_set_verify(ssl, SSL_VERIFY_NONE, nullptr);
+#if (OPENSSL_VERSION_NUMBER >= 0x10101000L)
+    // session tickets would trail the handshake and the control channel has no message to carry them
+    SSL_set_num_tickets(ssl, 0);
+#endif
+}
+
 int SSLWrapper::doHandshake(SSL* ssl)
 {
     auto result = SSL_do_handshake(ssl);
@@ -131,6 +197,12 @@ int SSLWrapper::doHandshake(SSL* ssl)
     return errorCode;
 }
 
+std::string SSLWrapper::getCipherName(const SSL* ssl)
+{
+    const auto name = SSL_get_cipher_name(ssl);
+    return name != nullptr ? name : std::string();
+}
+
 void SSLWrapper::free(SSL* ssl)
 {
     SSL_free(ssl);
@@ -191,6 +263,24 @@ int SSLWrapper::getError(SSL* ssl, int returnCode)
     return SSL_get_error(ssl, returnCode);
 }
 
+std::vector<std::string> SSLWrapper::splitCipherNames(const std::string& cipherNames)
+{
+    std::vector<std::string> names;
+    size_t begin = 0;
+
+    while(begin <= cipherNames.size())
+    {
+        const auto end = std::min(cipherNames.find(':', begin), cipherNames.size());
+        if(end > begin)
+        {
+            names.push_back(cipherNames.substr(begin, end - begin));
+        }
+        begin = end + 1;
+    }
+
+    return names;
+}
+
 }
 }
 }
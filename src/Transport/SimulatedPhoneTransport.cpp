@@ -0,0 +1,120 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <f1x/aasdk/Transport/SimulatedPhoneTransport.hpp>
+#include <f1x/aasdk/Error/Error.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+
+SimulatedPhoneTransport::SimulatedPhoneTransport(boost::asio::io_service& ioService, usb::SimulatedUSBWrapper& usbWrapper)
+    : Transport(ioService)
+    , usbWrapper_(usbWrapper)
+    , attached_(false)
+    , stopped_(false)
+{
+
+}
+
+void SimulatedPhoneTransport::enqueueReceive(common::DataBuffer buffer)
+{
+    if(stopped_)
+    {
+        this->rejectReceivePromises(error::Error(error::ErrorCode::OPERATION_ABORTED));
+        return;
+    }
+
+    receiveBuffer_ = buffer;
+
+    if(!attached_)
+    {
+        // head unit data written before the first receive is buffered by the wrapper and delivered here
+        attached_ = true;
+        std::weak_ptr<Transport> weakSelf(this->shared_from_this());
+
+        usbWrapper_.setHeadUnitDataHandler([this, weakSelf](common::Data data) {
+            auto self = weakSelf.lock();
+
+            if(self != nullptr)
+            {
+                receiveStrand_.dispatch([this, self = std::move(self), data = std::move(data)]() {
+                    headUnitData_.insert(headUnitData_.end(), data.begin(), data.end());
+                    this->completeReceive();
+                });
+            }
+        });
+    }
+
+    this->completeReceive();
+}
+
+void SimulatedPhoneTransport::completeReceive()
+{
+    if(receiveBuffer_ == nullptr || headUnitData_.empty())
+    {
+        return;
+    }
+
+    const auto size = std::min(receiveBuffer_.size, headUnitData_.size());
+    memcpy(receiveBuffer_.data, headUnitData_.data(), size);
+    headUnitData_.erase(headUnitData_.begin(), headUnitData_.begin() + size);
+    receiveBuffer_ = common::DataBuffer();
+
+    this->receiveHandler(size);
+}
+
+void SimulatedPhoneTransport::enqueueSend(SendQueue::iterator queueElement)
+{
+    usbWrapper_.sendToHeadUnit(std::move(queueElement->first));
+    queueElement->second->resolve();
+    sendQueue_.erase(queueElement);
+
+    if(!sendQueue_.empty())
+    {
+        this->enqueueSend(sendQueue_.begin());
+    }
+}
+
+void SimulatedPhoneTransport::stop()
+{
+    receiveStrand_.dispatch([this, self = this->shared_from_this()]() {
+        stopped_ = true;
+
+        if(attached_)
+        {
+            usbWrapper_.setHeadUnitDataHandler(nullptr);
+            attached_ = false;
+        }
+
+        if(receiveBuffer_.data != nullptr)
+        {
+            receiveBuffer_ = common::DataBuffer();
+            this->rejectReceivePromises(error::Error(error::ErrorCode::OPERATION_ABORTED));
+        }
+    });
+}
+
+}
+}
+}
@@ -0,0 +1,257 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <aasdk_proto/AVChannelMessageIdsEnum.pb.h>
+#include <aasdk_proto/InputChannelMessageIdsEnum.pb.h>
+#include <aasdk_proto/InputEventIndicationMessage.pb.h>
+#include <f1x/aasdk/IO/VirtualTimeDriver.hpp>
+#include <f1x/aasdk/USB/SimulatedUSBWrapper.hpp>
+#include <f1x/aasdk/USB/AOAPDevice.hpp>
+#include <f1x/aasdk/Transport/USBTransport.hpp>
+#include <f1x/aasdk/Transport/SimulatedPhoneTransport.hpp>
+#include <f1x/aasdk/Messenger/MessageId.hpp>
+#include <f1x/aasdk/Messenger/MessageInStream.hpp>
+#include <f1x/aasdk/Messenger/MessageOutStream.hpp>
+#include <f1x/aasdk/Messenger/Messenger.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+namespace ut
+{
+
+// Head unit on USBTransport and the phone on SimulatedPhoneTransport over a USB 2.0 like link,
+// everything driven in virtual time so the interleaving of the traffic is the same on every run.
+class SimulatedLinkUnitTest
+{
+protected:
+    typedef io::VirtualTimeDriver::Duration Duration;
+
+    SimulatedLinkUnitTest()
+        : driver_(ioService_)
+        , usbWrapper_(ioService_, createPhoneConfiguration(40 * 1024 * 1024))
+    {
+        this->connect();
+    }
+
+    SimulatedLinkUnitTest(size_t bytesPerSecond)
+        : driver_(ioService_)
+        , usbWrapper_(ioService_, createPhoneConfiguration(bytesPerSecond))
+    {
+        this->connect();
+    }
+
+    ~SimulatedLinkUnitTest()
+    {
+        headUnitMessenger_->stop();
+        phoneMessenger_->stop();
+        usbWrapper_.disconnectPhone();
+        phoneTransport_->stop();
+        headUnitMessenger_.reset();
+        phoneMessenger_.reset();
+        headUnitTransport_.reset();
+        phoneTransport_.reset();
+        driver_.runFor(std::chrono::seconds(1));
+    }
+
+    static usb::SimulatedPhoneConfiguration createPhoneConfiguration(size_t bytesPerSecond)
+    {
+        usb::SimulatedPhoneConfiguration configuration;
+        configuration.productId = 0x2D00;
+        configuration.bulkTransferLatency = std::chrono::microseconds(125);
+        configuration.bytesPerSecond = bytesPerSecond;
+        return configuration;
+    }
+
+    void connect()
+    {
+        usbWrapper_.connectPhone();
+        driver_.runFor(std::chrono::milliseconds(1));
+
+        auto aoapDevice = usb::AOAPDevice::create(usbWrapper_, ioService_, usbWrapper_.openDeviceWithVidPid(0x18D1, 0x2D00));
+        headUnitTransport_ = std::make_shared<USBTransport>(ioService_, std::move(aoapDevice));
+        phoneTransport_ = std::make_shared<SimulatedPhoneTransport>(ioService_, usbWrapper_);
+        headUnitMessenger_ = this->createMessenger(headUnitTransport_);
+        phoneMessenger_ = this->createMessenger(phoneTransport_);
+    }
+
+    messenger::IMessenger::Pointer createMessenger(ITransport::Pointer transport)
+    {
+        // plain messages only, no cryptor involved
+        return std::make_shared<messenger::Messenger>(ioService_,
+                                                      std::make_shared<messenger::MessageInStream>(ioService_, transport, nullptr),
+                                                      std::make_shared<messenger::MessageOutStream>(ioService_, transport, nullptr));
+    }
+
+    messenger::Message::Pointer createMediaMessage(messenger::ChannelId channelId, size_t size)
+    {
+        auto message = std::make_shared<messenger::Message>(channelId, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC);
+        message->insertPayload(messenger::MessageId(proto::ids::AVChannelMessage::AV_MEDIA_INDICATION).getData());
+        message->insertPayload(common::Data(size, 0x5A));
+        return message;
+    }
+
+    messenger::Message::Pointer createTouchMessage()
+    {
+        proto::messages::InputEventIndication indication;
+        indication.set_timestamp(0);
+        auto touchEvent = indication.mutable_touch_event();
+        touchEvent->set_touch_action(proto::enums::TouchAction::PRESS);
+        auto touchLocation = touchEvent->add_touch_location();
+        touchLocation->set_x(400);
+        touchLocation->set_y(240);
+        touchLocation->set_pointer_id(0);
+
+        auto message = std::make_shared<messenger::Message>(messenger::ChannelId::INPUT, messenger::EncryptionType::PLAIN, messenger::MessageType::SPECIFIC);
+        message->insertPayload(messenger::MessageId(proto::ids::InputChannelMessage::INPUT_EVENT_INDICATION).getData());
+        message->insertPayload(indication);
+        return message;
+    }
+
+    // resolves the receive on the given messenger and records the virtual time since the start of the test
+    void expectMessage(messenger::IMessenger::Pointer messenger, messenger::ChannelId channelId, Duration& receiveTime)
+    {
+        auto promise = messenger::ReceivePromise::defer(ioService_);
+        promise->then([this, &receiveTime](messenger::Message::Pointer) { receiveTime = driver_.getElapsed(); },
+                      [](const error::Error& e) { BOOST_FAIL(e.what()); });
+        messenger->enqueueReceive(channelId, std::move(promise));
+    }
+
+    void send(messenger::IMessenger::Pointer messenger, messenger::Message::Pointer message)
+    {
+        auto promise = messenger::SendPromise::defer(ioService_);
+        promise->then([]() {}, [](const error::Error& e) { BOOST_FAIL(e.what()); });
+        messenger->enqueueSend(std::move(message), std::move(promise));
+    }
+
+    struct BurstTimings
+    {
+        Duration video;
+        Duration audio;
+        Duration touch;
+    };
+
+    // 1 MB video burst and an audio frame queued by the phone, then a touch from the head unit
+    BurstTimings runVideoBurst()
+    {
+        const auto none = Duration::max();
+        BurstTimings timings{none, none, none};
+        const auto start = driver_.getElapsed();
+
+        this->expectMessage(headUnitMessenger_, messenger::ChannelId::VIDEO, timings.video);
+        this->expectMessage(headUnitMessenger_, messenger::ChannelId::MEDIA_AUDIO, timings.audio);
+        this->expectMessage(phoneMessenger_, messenger::ChannelId::INPUT, timings.touch);
+
+        this->send(phoneMessenger_, this->createMediaMessage(messenger::ChannelId::VIDEO, 1024 * 1024));
+        this->send(phoneMessenger_, this->createMediaMessage(messenger::ChannelId::MEDIA_AUDIO, 2048));
+        this->send(headUnitMessenger_, this->createTouchMessage());
+
+        BOOST_TEST(driver_.runUntil([&]() { return timings.video != none && timings.audio != none && timings.touch != none; }, std::chrono::seconds(1)));
+
+        timings.video -= start;
+        timings.audio -= start;
+        timings.touch -= start;
+        return timings;
+    }
+
+    boost::asio::io_service ioService_;
+    io::VirtualTimeDriver driver_;
+    usb::SimulatedUSBWrapper usbWrapper_;
+    ITransport::Pointer headUnitTransport_;
+    ITransport::Pointer phoneTransport_;
+    messenger::IMessenger::Pointer headUnitMessenger_;
+    messenger::IMessenger::Pointer phoneMessenger_;
+};
+
+BOOST_FIXTURE_TEST_CASE(SimulatedLink_TouchWithinBudgetDuringVideoBurst, SimulatedLinkUnitTest)
+{
+    const auto timings = this->runVideoBurst();
+
+    // the burst occupies the IN direction for tens of milliseconds, the touch must not wait for it
+    BOOST_CHECK(timings.video >= std::chrono::milliseconds(20));
+    BOOST_CHECK(timings.touch <= std::chrono::milliseconds(5));
+    BOOST_CHECK(timings.touch < timings.video);
+    // one send queue per messenger, the audio frame cannot overtake the burst
+    BOOST_CHECK(timings.audio >= timings.video);
+}
+
+BOOST_AUTO_TEST_CASE(SimulatedLink_VideoBurstIsDeterministic)
+{
+    struct Run: SimulatedLinkUnitTest
+    {
+        using SimulatedLinkUnitTest::runVideoBurst;
+        using SimulatedLinkUnitTest::BurstTimings;
+    };
+
+    Run::BurstTimings first;
+    Run::BurstTimings second;
+
+    {
+        Run run;
+        first = run.runVideoBurst();
+    }
+
+    {
+        Run run;
+        second = run.runVideoBurst();
+    }
+
+    BOOST_CHECK(first.video == second.video);
+    BOOST_CHECK(first.audio == second.audio);
+    BOOST_CHECK(first.touch == second.touch);
+}
+
+BOOST_AUTO_TEST_CASE(SimulatedLink_SendTimesOutOnStalledLink)
+{
+    struct Run: SimulatedLinkUnitTest
+    {
+        Run()
+            : SimulatedLinkUnitTest(1000)
+        {
+        }
+
+        using SimulatedLinkUnitTest::driver_;
+        using SimulatedLinkUnitTest::headUnitTransport_;
+        using SimulatedLinkUnitTest::ioService_;
+    };
+
+    Run run;
+    const auto start = run.driver_.getElapsed();
+    io::VirtualTimeDriver::Duration rejectTime = io::VirtualTimeDriver::Duration::max();
+    error::Error rejectError;
+
+    // 16 KB at 1 KB/s cannot make it within the 10 s send timeout of USBTransport
+    auto promise = ITransport::SendPromise::defer(run.ioService_);
+    promise->then([]() { BOOST_FAIL("send should time out"); },
+                  [&](const error::Error& e) { rejectTime = run.driver_.getElapsed(); rejectError = e; });
+    run.headUnitTransport_->send(common::Data(16384, 0), std::move(promise));
+
+    BOOST_TEST(run.driver_.runUntil([&]() { return rejectTime != io::VirtualTimeDriver::Duration::max(); }, std::chrono::seconds(60)));
+    BOOST_CHECK(rejectTime - start == std::chrono::seconds(10));
+    BOOST_CHECK(rejectError == error::ErrorCode::USB_TRANSFER);
+    BOOST_TEST(rejectError.getNativeCode() == LIBUSB_TRANSFER_TIMED_OUT);
+}
+
+}
+}
+}
+}
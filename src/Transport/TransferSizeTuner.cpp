@@ -0,0 +1,122 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <f1x/aasdk/Transport/TransferSizeTuner.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+
+constexpr std::chrono::microseconds TransferSizeTuner::cDefaultLatencyBudget;
+constexpr size_t TransferSizeTuner::cDefaultWindowSize;
+constexpr size_t TransferSizeTuner::cHoldWindows;
+constexpr double TransferSizeTuner::cMinImprovement;
+
+TransferSizeTuner::TransferSizeTuner(size_t minTransferSize, size_t maxTransferSize, size_t initialTransferSize,
+                                     std::chrono::microseconds latencyBudget, size_t windowSize)
+    : minTransferSize_(minTransferSize)
+    , maxTransferSize_(std::max(minTransferSize, maxTransferSize))
+    , latencyBudget_(latencyBudget)
+    , windowSize_(std::max<size_t>(1, windowSize))
+    , transferSize_(std::min(std::max(initialTransferSize, minTransferSize_), maxTransferSize_))
+    , latencyBudgetExceeded_(false)
+    , windowTransfers_(0)
+    , windowBytes_(0)
+    , previousBytesPerTransfer_(0)
+    , grown_(false)
+    , holdWindows_(0)
+{
+
+}
+
+void TransferSizeTuner::onTransferCompleted(size_t bytesTransferred)
+{
+    windowBytes_ += bytesTransferred;
+
+    if(++windowTransfers_ >= windowSize_)
+    {
+        this->evaluateWindow();
+        windowTransfers_ = 0;
+        windowBytes_ = 0;
+    }
+}
+
+void TransferSizeTuner::onControlFrameLatency(Duration latency)
+{
+    if(latency > latencyBudget_)
+    {
+        latencyBudgetExceeded_ = true;
+    }
+}
+
+size_t TransferSizeTuner::getTransferSize() const
+{
+    return transferSize_;
+}
+
+void TransferSizeTuner::evaluateWindow()
+{
+    const double bytesPerTransfer = static_cast<double>(windowBytes_) / windowTransfers_;
+    const size_t transferSize = transferSize_;
+    size_t newTransferSize = transferSize;
+
+    if(latencyBudgetExceeded_.exchange(false))
+    {
+        newTransferSize = std::max(transferSize / 2, minTransferSize_);
+        holdWindows_ = cHoldWindows;
+        grown_ = false;
+    }
+    else if(grown_ && bytesPerTransfer < previousBytesPerTransfer_ * (1 + cMinImprovement))
+    {
+        newTransferSize = std::max(transferSize / 2, minTransferSize_);
+        holdWindows_ = cHoldWindows;
+        grown_ = false;
+    }
+    else if(holdWindows_ > 0)
+    {
+        --holdWindows_;
+        grown_ = false;
+    }
+    else if(transferSize < maxTransferSize_)
+    {
+        newTransferSize = std::min(transferSize * 2, maxTransferSize_);
+        grown_ = true;
+    }
+    else
+    {
+        grown_ = false;
+    }
+
+    previousBytesPerTransfer_ = bytesPerTransfer;
+
+    if(newTransferSize != transferSize)
+    {
+        AASDK_LOG(debug) << "[TransferSizeTuner] transfer size: " << transferSize << " -> " << newTransferSize
+                         << ", bytes per transfer: " << static_cast<uint64_t>(bytesPerTransfer);
+        transferSize_ = newTransferSize;
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,97 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Transport/TransferSizeTuner.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+namespace ut
+{
+
+namespace
+{
+
+void completeWindow(TransferSizeTuner& tuner, size_t windowSize, size_t bytesPerTransfer)
+{
+    for(size_t i = 0; i < windowSize; ++i)
+    {
+        tuner.onTransferCompleted(bytesPerTransfer);
+    }
+}
+
+}
+
+BOOST_AUTO_TEST_CASE(TransferSizeTuner_GrowWhileThroughputImproves)
+{
+    const size_t windowSize = 4;
+    TransferSizeTuner tuner(4096, 65536, 16384, std::chrono::milliseconds(5), windowSize);
+
+    // every transfer fills the whole buffer, so throughput scales with the transfer size
+    for(size_t i = 0; i < 4; ++i)
+    {
+        completeWindow(tuner, windowSize, tuner.getTransferSize());
+    }
+
+    BOOST_TEST(tuner.getTransferSize() == 65536u);
+}
+
+BOOST_AUTO_TEST_CASE(TransferSizeTuner_RevertGrowthWithoutImprovement)
+{
+    const size_t windowSize = 4;
+    TransferSizeTuner tuner(4096, 65536, 16384, std::chrono::milliseconds(5), windowSize);
+
+    completeWindow(tuner, windowSize, 10000);
+    BOOST_TEST(tuner.getTransferSize() == 32768u);
+
+    completeWindow(tuner, windowSize, 10000);
+    BOOST_TEST(tuner.getTransferSize() == 16384u);
+
+    // held at the reverted size for a while
+    completeWindow(tuner, windowSize, 10000);
+    BOOST_TEST(tuner.getTransferSize() == 16384u);
+}
+
+BOOST_AUTO_TEST_CASE(TransferSizeTuner_ShrinkWhenControlFrameLatencyExceedsBudget)
+{
+    const size_t windowSize = 4;
+    TransferSizeTuner tuner(4096, 65536, 16384, std::chrono::milliseconds(5), windowSize);
+
+    tuner.onControlFrameLatency(std::chrono::milliseconds(1));
+    completeWindow(tuner, windowSize, 16384);
+    BOOST_TEST(tuner.getTransferSize() == 32768u);
+
+    tuner.onControlFrameLatency(std::chrono::milliseconds(20));
+    completeWindow(tuner, windowSize, 32768);
+    BOOST_TEST(tuner.getTransferSize() == 16384u);
+
+    tuner.onControlFrameLatency(std::chrono::milliseconds(20));
+    completeWindow(tuner, windowSize, 16384);
+    tuner.onControlFrameLatency(std::chrono::milliseconds(20));
+    completeWindow(tuner, windowSize, 16384);
+    BOOST_TEST(tuner.getTransferSize() == 4096u);
+}
+
+}
+}
+}
+}
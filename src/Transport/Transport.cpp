@@ -28,8 +28,42 @@ namespace transport
 Transport::Transport(boost::asio::io_service& ioService)
     : receiveStrand_(ioService)
     , sendStrand_(ioService)
+    , dispatchMode_(io::DispatchMode::POST)
 {}
 
+Transport::Transport(boost::asio::io_service::strand& strand)
+    : Transport(strand, strand)
+{}
+
+Transport::Transport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand)
+    : receiveStrand_(receiveStrand)
+    , sendStrand_(sendStrand)
+    , dispatchMode_(io::DispatchMode::INLINE)
+{}
+
+Transport::Transport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand,
+                     common::MemoryBudget::Pointer memoryBudget, size_t receiveBufferSize)
+    : receivedDataSink_(DataSink::cDefaultChunkSize, receiveBufferSize)
+    , receiveStrand_(receiveStrand)
+    , sendStrand_(sendStrand)
+    , dispatchMode_(io::DispatchMode::INLINE)
+{
+    if(!memoryBudget->tryAcquire(receivedDataSink_.getCapacity()))
+    {
+        throw error::Error(error::ErrorCode::MEMORY_BUDGET_EXCEEDED);
+    }
+
+    memoryBudget_ = std::move(memoryBudget);
+}
+
+Transport::~Transport()
+{
+    if(memoryBudget_ != nullptr)
+    {
+        memoryBudget_->release(receivedDataSink_.getCapacity());
+    }
+}
+
 void Transport::receive(size_t size, ReceivePromise::Pointer promise)
 {
     receiveStrand_.dispatch([this, self = this->shared_from_this(), size, promise = std::move(promise)]() mutable {
@@ -51,6 +85,12 @@ void Transport::receive(size_t size, ReceivePromise::Pointer promise)
 
 void Transport::receiveHandler(size_t bytesTransferred)
 {
+    if(transferSizeTuner_ != nullptr)
+    {
+        transferSizeTuner_->onTransferCompleted(bytesTransferred);
+        receivedDataSink_.setChunkSize(transferSizeTuner_->getTransferSize());
+    }
+
     try
     {
         receivedDataSink_.commit(bytesTransferred);
@@ -84,12 +124,13 @@ void Transport::distributeReceivedData()
 
 void Transport::rejectReceivePromises(const error::Error& e)
 {
-    for(auto& queueElement : receiveQueue_)
+    ReceiveQueue receiveQueue;
+    std::swap(receiveQueue, receiveQueue_);
+
+    for(auto& queueElement : receiveQueue)
     {
         queueElement.second->reject(e);
     }
-
-    receiveQueue_.clear();
 }
 
 void Transport::send(common::Data data, SendPromise::Pointer promise)
@@ -104,6 +145,25 @@ void Transport::send(common::Data data, SendPromise::Pointer promise)
     });
 }
 
+void Transport::setReceiveChunkSize(size_t chunkSize)
+{
+    receiveStrand_.dispatch([this, self = this->shared_from_this(), chunkSize]() mutable {
+        receivedDataSink_.setChunkSize(chunkSize);
+    });
+}
+
+void Transport::setTransferSizeTuner(TransferSizeTuner::Pointer transferSizeTuner)
+{
+    receiveStrand_.dispatch([this, self = this->shared_from_this(), transferSizeTuner = std::move(transferSizeTuner)]() mutable {
+        transferSizeTuner_ = std::move(transferSizeTuner);
+
+        if(transferSizeTuner_ != nullptr)
+        {
+            receivedDataSink_.setChunkSize(transferSizeTuner_->getTransferSize());
+        }
+    });
+}
+
 }
 }
 }
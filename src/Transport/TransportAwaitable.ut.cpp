@@ -0,0 +1,156 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef AASDK_COROUTINES
+
+#include <future>
+#include <thread>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/Transport/UT/Transport.mock.hpp>
+#include <f1x/aasdk/Transport/TransportAwaitable.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace transport
+{
+namespace ut
+{
+
+using ::testing::Invoke;
+using ::testing::SaveArg;
+using ::testing::_;
+
+class TransportAwaitableUnitTest
+{
+protected:
+    TransportAwaitableUnitTest()
+        : strand_(ioService_)
+        , transport_(&transportMock_, [](auto*) {})
+    {
+
+    }
+
+    io::Task receiveAndEcho(size_t size)
+    {
+        try
+        {
+            auto data = co_await asyncReceive(transport_, size, strand_);
+            co_await asyncSend(transport_, std::move(data), strand_);
+            completed_ = true;
+        }
+        catch(const error::Error& e)
+        {
+            error_ = e;
+        }
+    }
+
+    io::Task receiveAndNotify(size_t size, std::promise<common::Data>& received)
+    {
+        try
+        {
+            received.set_value(co_await asyncReceive(transport_, size, strand_));
+        }
+        catch(const error::Error& e)
+        {
+            error_ = e;
+        }
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+    TransportMock transportMock_;
+    ITransport::Pointer transport_;
+    bool completed_ = false;
+    error::Error error_;
+};
+
+BOOST_FIXTURE_TEST_CASE(TransportAwaitable_ReceiveThenSend, TransportAwaitableUnitTest)
+{
+    const common::Data expectedData(100, 0x5E);
+
+    ITransport::ReceivePromise::Pointer receivePromise;
+    EXPECT_CALL(transportMock_, receive(expectedData.size(), _)).WillOnce(SaveArg<1>(&receivePromise));
+
+    ITransport::SendPromise::Pointer sendPromise;
+    EXPECT_CALL(transportMock_, send(expectedData, _)).WillOnce(SaveArg<1>(&sendPromise));
+
+    this->receiveAndEcho(expectedData.size());
+    BOOST_TEST(receivePromise != nullptr);
+
+    receivePromise->resolve(expectedData);
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_TEST(sendPromise != nullptr);
+    BOOST_TEST(!completed_);
+
+    sendPromise->resolve();
+    ioService_.run();
+
+    BOOST_TEST(completed_);
+    BOOST_CHECK(error_ == error::Error());
+}
+
+BOOST_FIXTURE_TEST_CASE(TransportAwaitable_RejectThrows, TransportAwaitableUnitTest)
+{
+    ITransport::ReceivePromise::Pointer receivePromise;
+    EXPECT_CALL(transportMock_, receive(_, _)).WillOnce(SaveArg<1>(&receivePromise));
+    EXPECT_CALL(transportMock_, send(_, _)).Times(0);
+
+    this->receiveAndEcho(100);
+
+    const error::Error expectedError(error::ErrorCode::OPERATION_ABORTED);
+    receivePromise->reject(expectedError);
+    ioService_.run();
+
+    BOOST_TEST(!completed_);
+    BOOST_CHECK(error_ == expectedError);
+}
+
+BOOST_FIXTURE_TEST_CASE(TransportAwaitable_ResolvedFromAnotherThreadBeforeInitiatorReturns, TransportAwaitableUnitTest)
+{
+    boost::asio::io_service::work work(ioService_);
+    std::thread worker([this]() { ioService_.run(); });
+
+    const common::Data expectedData(100, 0x5E);
+    std::promise<common::Data> received;
+    auto receivedFuture = received.get_future().share();
+
+    // the coroutine resumes on the worker and runs to completion while the transport is still inside receive()
+    EXPECT_CALL(transportMock_, receive(expectedData.size(), _)).WillOnce(Invoke([&](size_t, ITransport::ReceivePromise::Pointer promise) {
+        promise->resolve(expectedData);
+        receivedFuture.wait_for(std::chrono::seconds(5));
+    }));
+
+    this->receiveAndNotify(expectedData.size(), received);
+
+    BOOST_TEST((receivedFuture.wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+    BOOST_TEST(receivedFuture.get() == expectedData, boost::test_tools::per_element());
+
+    ioService_.stop();
+    worker.join();
+}
+
+}
+}
+}
+}
+
+#endif
@@ -30,9 +30,25 @@ USBTransport::USBTransport(boost::asio::io_service& ioService, usb::IAOAPDevice:
     , aoapDevice_(std::move(aoapDevice))
 {}
 
+USBTransport::USBTransport(boost::asio::io_service::strand& strand, usb::IAOAPDevice::Pointer aoapDevice)
+    : Transport(strand)
+    , aoapDevice_(std::move(aoapDevice))
+{}
+
+USBTransport::USBTransport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand, usb::IAOAPDevice::Pointer aoapDevice)
+    : Transport(receiveStrand, sendStrand)
+    , aoapDevice_(std::move(aoapDevice))
+{}
+
+USBTransport::USBTransport(boost::asio::io_service::strand& receiveStrand, boost::asio::io_service::strand& sendStrand,
+                           common::MemoryBudget::Pointer memoryBudget, size_t receiveBufferSize, usb::IAOAPDevice::Pointer aoapDevice)
+    : Transport(receiveStrand, sendStrand, std::move(memoryBudget), receiveBufferSize)
+    , aoapDevice_(std::move(aoapDevice))
+{}
+
 void USBTransport::enqueueReceive(common::DataBuffer buffer)
 {
-    auto usbEndpointPromise = usb::IUSBEndpoint::Promise::defer(receiveStrand_);
+    auto usbEndpointPromise = usb::IUSBEndpoint::Promise::defer(receiveStrand_, dispatchMode_);
     usbEndpointPromise->then([this, self = this->shared_from_this()](auto bytesTransferred) {
             this->receiveHandler(bytesTransferred);
         },
@@ -50,7 +66,7 @@ void USBTransport::enqueueSend(SendQueue::iterator queueElement)
 
 void USBTransport::doSend(SendQueue::iterator queueElement, common::Data::size_type offset)
 {
-    auto usbEndpointPromise = usb::IUSBEndpoint::Promise::defer(sendStrand_);
+    auto usbEndpointPromise = usb::IUSBEndpoint::Promise::defer(sendStrand_, dispatchMode_);
     usbEndpointPromise->then([this, self = this->shared_from_this(), queueElement, offset](size_t bytesTransferred) mutable {
             this->sendHandler(queueElement, offset, bytesTransferred);
         },
@@ -310,6 +310,36 @@ BOOST_FIXTURE_TEST_CASE(USBTransport_SendError, USBTransportUnitTest)
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(USBTransport_ReceiveBufferChargedToMemoryBudget, USBTransportUnitTest)
+{
+    boost::asio::io_service::strand strand(ioService_);
+    auto memoryBudget(std::make_shared<common::MemoryBudget>(1000));
+
+    BOOST_CHECK_EXCEPTION(std::make_shared<USBTransport>(strand, strand, memoryBudget, 2000, aoapDevice_), error::Error,
+                          [](const error::Error& e) { return e == error::ErrorCode::MEMORY_BUDGET_EXCEEDED; });
+    BOOST_TEST(memoryBudget->getUsage() == 0u);
+
+    USBTransport::Pointer transport(std::make_shared<USBTransport>(strand, strand, memoryBudget, 100, aoapDevice_));
+    BOOST_TEST(memoryBudget->getUsage() == 100u);
+
+    // a receive larger than the buffer is served up to its capacity and then fails
+    usb::IUSBEndpoint::Promise::Pointer usbEndpointPromise;
+    common::DataBuffer dataBuffer;
+    EXPECT_CALL(inEndpointMock_, bulkTransfer(_, _, _)).WillOnce(DoAll(SaveArg<0>(&dataBuffer), SaveArg<2>(&usbEndpointPromise)));
+    transport->receive(200, std::move(receivePromise_));
+    ioService_.run();
+    ioService_.reset();
+    BOOST_TEST(dataBuffer.size == 100u);
+
+    EXPECT_CALL(receivePromiseHandlerMock_, onReject(error::Error(error::ErrorCode::DATA_SINK_FULL)));
+    EXPECT_CALL(receivePromiseHandlerMock_, onResolve(_)).Times(0);
+    usbEndpointPromise->resolve(dataBuffer.size);
+    ioService_.run();
+
+    transport.reset();
+    BOOST_TEST(memoryBudget->getUsage() == 0u);
+}
+
 }
 }
 }
@@ -28,20 +28,46 @@ namespace aasdk
 namespace usb
 {
 
-AOAPDevice::AOAPDevice(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle, const libusb_interface_descriptor* interfaceDescriptor)
+constexpr size_t AOAPDevice::cDefaultTransferPoolSize;
+
+AOAPDevice::AOAPDevice(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle, const libusb_interface_descriptor* interfaceDescriptor,
+                       size_t transferPoolSize)
+    : usbWrapper_(usbWrapper)
+    , handle_(std::move(handle))
+    , interfaceDescriptor_(interfaceDescriptor)
+{
+    this->createEndpoints(ioService, ioService, transferPoolSize);
+}
+
+AOAPDevice::AOAPDevice(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& strand, DeviceHandle handle, const libusb_interface_descriptor* interfaceDescriptor,
+                       size_t transferPoolSize)
+    : AOAPDevice(usbWrapper, strand, strand, std::move(handle), interfaceDescriptor, transferPoolSize)
+{
+
+}
+
+AOAPDevice::AOAPDevice(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& inStrand, boost::asio::io_service::strand& outStrand,
+                       DeviceHandle handle, const libusb_interface_descriptor* interfaceDescriptor,
+                       size_t transferPoolSize)
     : usbWrapper_(usbWrapper)
     , handle_(std::move(handle))
     , interfaceDescriptor_(interfaceDescriptor)
 {
-    if((interfaceDescriptor->endpoint[0].bEndpointAddress & LIBUSB_ENDPOINT_DIR_MASK) == LIBUSB_ENDPOINT_IN)
+    this->createEndpoints(inStrand, outStrand, transferPoolSize);
+}
+
+template<typename InExecutionContextType, typename OutExecutionContextType>
+void AOAPDevice::createEndpoints(InExecutionContextType& inExecutionContext, OutExecutionContextType& outExecutionContext, size_t transferPoolSize)
+{
+    if((interfaceDescriptor_->endpoint[0].bEndpointAddress & LIBUSB_ENDPOINT_DIR_MASK) == LIBUSB_ENDPOINT_IN)
     {
-        inEndpoint_ = std::make_shared<USBEndpoint>(usbWrapper_, ioService, handle_, interfaceDescriptor_->endpoint[0].bEndpointAddress);
-        outEndpoint_ = std::make_shared<USBEndpoint>(usbWrapper_, ioService, handle_, interfaceDescriptor_->endpoint[1].bEndpointAddress);
+        inEndpoint_ = std::make_shared<USBEndpoint>(usbWrapper_, inExecutionContext, handle_, interfaceDescriptor_->endpoint[0].bEndpointAddress, transferPoolSize);
+        outEndpoint_ = std::make_shared<USBEndpoint>(usbWrapper_, outExecutionContext, handle_, interfaceDescriptor_->endpoint[1].bEndpointAddress, transferPoolSize);
     }
     else
     {
-        inEndpoint_ = std::make_shared<USBEndpoint>(usbWrapper_, ioService, handle_, interfaceDescriptor_->endpoint[1].bEndpointAddress);
-        outEndpoint_ = std::make_shared<USBEndpoint>(usbWrapper_, ioService, handle_, interfaceDescriptor_->endpoint[0].bEndpointAddress);
+        inEndpoint_ = std::make_shared<USBEndpoint>(usbWrapper_, inExecutionContext, handle_, interfaceDescriptor_->endpoint[1].bEndpointAddress, transferPoolSize);
+        outEndpoint_ = std::make_shared<USBEndpoint>(usbWrapper_, outExecutionContext, handle_, interfaceDescriptor_->endpoint[0].bEndpointAddress, transferPoolSize);
     }
 }
 
@@ -62,7 +88,24 @@ IUSBEndpoint& AOAPDevice::getOutEndpoint()
     return *outEndpoint_;
 }
 
-IAOAPDevice::Pointer AOAPDevice::create(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle)
+IAOAPDevice::Pointer AOAPDevice::create(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle, size_t transferPoolSize)
+{
+    auto interfaceDescriptor = AOAPDevice::claimInterface(usbWrapper, handle);
+    return std::make_unique<AOAPDevice>(usbWrapper, ioService, std::move(handle), interfaceDescriptor, transferPoolSize);
+}
+
+IAOAPDevice::Pointer AOAPDevice::create(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& strand, DeviceHandle handle, size_t transferPoolSize)
+{
+    return AOAPDevice::create(usbWrapper, strand, strand, std::move(handle), transferPoolSize);
+}
+
+IAOAPDevice::Pointer AOAPDevice::create(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& inStrand, boost::asio::io_service::strand& outStrand, DeviceHandle handle, size_t transferPoolSize)
+{
+    auto interfaceDescriptor = AOAPDevice::claimInterface(usbWrapper, handle);
+    return std::make_unique<AOAPDevice>(usbWrapper, inStrand, outStrand, std::move(handle), interfaceDescriptor, transferPoolSize);
+}
+
+const libusb_interface_descriptor* AOAPDevice::claimInterface(IUSBWrapper& usbWrapper, DeviceHandle handle)
 {
     auto configDescriptorHandle = AOAPDevice::getConfigDescriptor(usbWrapper, handle);
     auto interface = AOAPDevice::getInterface(configDescriptorHandle);
@@ -80,7 +123,7 @@ IAOAPDevice::Pointer AOAPDevice::create(IUSBWrapper& usbWrapper, boost::asio::io
         throw error::Error(error::ErrorCode::USB_CLAIM_INTERFACE, result);
     }
 
-    return std::make_unique<AOAPDevice>(usbWrapper, ioService, std::move(handle), interfaceDescriptor);
+    return interfaceDescriptor;
 }
 
 ConfigDescriptorHandle AOAPDevice::getConfigDescriptor(IUSBWrapper& usbWrapper, DeviceHandle handle)
@@ -0,0 +1,176 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <type_traits>
+#include <f1x/aasdk/USB/AccessoryModePipelinedQueryChain.hpp>
+#include <f1x/aasdk/USB/USBEndpoint.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+
+AccessoryModePipelinedQueryChain::AccessoryModePipelinedQueryChain(IUSBWrapper& usbWrapper,
+                                                                   boost::asio::io_service& ioService,
+                                                                   IAccessoryModeQueryFactory& queryFactory)
+    : usbWrapper_(usbWrapper)
+    , strand_(ioService)
+    , queryFactory_(queryFactory)
+    , pendingStrings_(0)
+{
+
+}
+
+void AccessoryModePipelinedQueryChain::start(DeviceHandle handle, Promise::Pointer promise)
+{
+    strand_.dispatch([this, self = this->shared_from_this(), handle = std::move(handle), promise = std::move(promise)]() mutable {
+        if(promise_ != nullptr)
+        {
+            promise->reject(error::Error(error::ErrorCode::OPERATION_IN_PROGRESS));
+        }
+        else
+        {
+            promise_ = std::move(promise);
+            stepTimings_.clear();
+            startTime_ = Clock::now();
+
+            this->startQuery(AccessoryModeQueryType::PROTOCOL_VERSION,
+                             std::make_shared<USBEndpoint>(usbWrapper_, strand_.context(), std::move(handle)));
+        }
+    });
+}
+
+void AccessoryModePipelinedQueryChain::cancel()
+{
+    strand_.dispatch([this, self = this->shared_from_this()]() {
+        auto activeQueries = std::move(activeQueries_);
+        activeQueries_.clear();
+        std::for_each(activeQueries.begin(), activeQueries.end(), std::bind(&IAccessoryModeQuery::cancel, std::placeholders::_1));
+    });
+}
+
+const AccessoryModeQueryStepTimings& AccessoryModePipelinedQueryChain::getStepTimings() const
+{
+    return stepTimings_;
+}
+
+void AccessoryModePipelinedQueryChain::startQuery(AccessoryModeQueryType queryType, IUSBEndpoint::Pointer usbEndpoint)
+{
+    const auto startTime = Clock::now();
+    auto queryPromise = IAccessoryModeQuery::Promise::defer(strand_);
+    queryPromise->then([this, self = this->shared_from_this(), queryType, startTime](IUSBEndpoint::Pointer usbEndpoint) mutable {
+            this->queryHandler(queryType, startTime, std::move(usbEndpoint));
+        },
+        [this, self = this->shared_from_this(), queryType, startTime](const error::Error& e) mutable {
+            this->queryErrorHandler(queryType, startTime, e);
+        });
+
+    activeQueries_.push_back(queryFactory_.createQuery(queryType, std::move(usbEndpoint)));
+    activeQueries_.back()->start(std::move(queryPromise));
+}
+
+void AccessoryModePipelinedQueryChain::queryHandler(AccessoryModeQueryType queryType, Clock::time_point startTime, IUSBEndpoint::Pointer usbEndpoint)
+{
+    stepTimings_.push_back({queryType, std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime), error::ErrorCode::NONE});
+
+    if(promise_ == nullptr)
+    {
+        return;
+    }
+
+    switch(queryType)
+    {
+    case AccessoryModeQueryType::PROTOCOL_VERSION:
+        activeQueries_.clear();
+        this->sendStrings(std::move(usbEndpoint));
+        break;
+
+    case AccessoryModeQueryType::START:
+        activeQueries_.clear();
+        this->logStepTimings();
+        promise_->resolve(usbEndpoint->getDeviceHandle());
+        promise_.reset();
+        break;
+
+    default:
+        if(--pendingStrings_ == 0)
+        {
+            activeQueries_.clear();
+            this->startQuery(AccessoryModeQueryType::START, std::move(usbEndpoint));
+        }
+        break;
+    }
+}
+
+void AccessoryModePipelinedQueryChain::queryErrorHandler(AccessoryModeQueryType queryType, Clock::time_point startTime, const error::Error& e)
+{
+    stepTimings_.push_back({queryType, std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime), e.getCode()});
+
+    if(promise_ == nullptr)
+    {
+        return;
+    }
+
+    AASDK_LOG(error) << "[AccessoryModePipelinedQueryChain] query " << static_cast<int>(queryType) << " failed: " << e.what();
+
+    // the first failure settles the chain, the rest is cancelled and only recorded
+    auto promise = std::move(promise_);
+    promise_.reset();
+    this->cancel();
+    this->logStepTimings();
+    promise->reject(e);
+}
+
+void AccessoryModePipelinedQueryChain::sendStrings(IUSBEndpoint::Pointer usbEndpoint)
+{
+    static const AccessoryModeQueryType cStringQueries[] = {
+        AccessoryModeQueryType::SEND_MANUFACTURER,
+        AccessoryModeQueryType::SEND_MODEL,
+        AccessoryModeQueryType::SEND_DESCRIPTION,
+        AccessoryModeQueryType::SEND_VERSION,
+        AccessoryModeQueryType::SEND_URI,
+        AccessoryModeQueryType::SEND_SERIAL
+    };
+
+    pendingStrings_ = std::extent<decltype(cStringQueries)>::value;
+
+    for(const auto queryType : cStringQueries)
+    {
+        this->startQuery(queryType, usbEndpoint);
+    }
+}
+
+void AccessoryModePipelinedQueryChain::logStepTimings() const
+{
+    for(const auto& stepTiming : stepTimings_)
+    {
+        AASDK_LOG(info) << "[AccessoryModePipelinedQueryChain] query " << static_cast<int>(stepTiming.queryType)
+                        << " took " << stepTiming.duration.count() << " us, error: " << static_cast<int>(stepTiming.errorCode);
+    }
+
+    AASDK_LOG(info) << "[AccessoryModePipelinedQueryChain] total: "
+                    << std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - startTime_).count() << " us";
+}
+
+}
+}
+}
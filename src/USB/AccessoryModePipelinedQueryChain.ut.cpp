@@ -0,0 +1,146 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/USB/UT/USBWrapper.mock.hpp>
+#include <f1x/aasdk/USB/UT/AccessoryModeQueryFactory.mock.hpp>
+#include <f1x/aasdk/USB/UT/AccessoryModeQueryChainPromiseHandler.mock.hpp>
+#include <f1x/aasdk/USB/UT/AccessoryModeQuery.mock.hpp>
+#include <f1x/aasdk/USB/AccessoryModePipelinedQueryChain.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+namespace ut
+{
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::SaveArg;
+
+class AccessoryModePipelinedQueryChainUnitTest
+{
+protected:
+    AccessoryModePipelinedQueryChainUnitTest()
+        : deviceHandle_(reinterpret_cast<libusb_device_handle*>(&dummyDeviceHandle_), [](auto*) {})
+        , queryMock_(std::make_shared<AccessoryModeQueryMock>())
+        , promise_(IAccessoryModeQueryChain::Promise::defer(ioService_))
+    {
+        promise_->then(std::bind(&AccessoryModeQueryChainPromiseHandlerMock::onResolve, &promiseHandlerMock_, std::placeholders::_1),
+                      std::bind(&AccessoryModeQueryChainPromiseHandlerMock::onReject, &promiseHandlerMock_, std::placeholders::_1));
+
+        EXPECT_CALL(*queryMock_, start(_)).WillRepeatedly(Invoke([this](IAccessoryModeQuery::Promise::Pointer promise) {
+            queryPromises_.push_back(std::move(promise));
+        }));
+    }
+
+    void startChain(AccessoryModePipelinedQueryChain::Pointer queryChain)
+    {
+        EXPECT_CALL(queryFactoryMock_, createQuery(AccessoryModeQueryType::PROTOCOL_VERSION, _)).WillOnce(DoAll(SaveArg<1>(&usbEndpoint_), Return(queryMock_)));
+        queryChain->start(deviceHandle_, std::move(promise_));
+        ioService_.run();
+        ioService_.reset();
+
+        EXPECT_CALL(queryFactoryMock_, createQuery(AccessoryModeQueryType::SEND_MANUFACTURER, _)).WillOnce(Return(queryMock_));
+        EXPECT_CALL(queryFactoryMock_, createQuery(AccessoryModeQueryType::SEND_MODEL, _)).WillOnce(Return(queryMock_));
+        EXPECT_CALL(queryFactoryMock_, createQuery(AccessoryModeQueryType::SEND_DESCRIPTION, _)).WillOnce(Return(queryMock_));
+        EXPECT_CALL(queryFactoryMock_, createQuery(AccessoryModeQueryType::SEND_VERSION, _)).WillOnce(Return(queryMock_));
+        EXPECT_CALL(queryFactoryMock_, createQuery(AccessoryModeQueryType::SEND_URI, _)).WillOnce(Return(queryMock_));
+        EXPECT_CALL(queryFactoryMock_, createQuery(AccessoryModeQueryType::SEND_SERIAL, _)).WillOnce(Return(queryMock_));
+
+        auto protocolVersionPromise = std::move(queryPromises_.back());
+        queryPromises_.clear();
+        protocolVersionPromise->resolve(usbEndpoint_);
+        ioService_.run();
+        ioService_.reset();
+    }
+
+    boost::asio::io_service ioService_;
+    USBWrapperMock usbWrapperMock_;
+    AccessoryModeQueryFactoryMock queryFactoryMock_;
+    USBWrapperMock::DummyDeviceHandle dummyDeviceHandle_;
+    DeviceHandle deviceHandle_;
+    std::shared_ptr<AccessoryModeQueryMock> queryMock_;
+    AccessoryModeQueryChainPromiseHandlerMock promiseHandlerMock_;
+    IAccessoryModeQueryChain::Promise::Pointer promise_;
+    IUSBEndpoint::Pointer usbEndpoint_;
+    std::vector<IAccessoryModeQuery::Promise::Pointer> queryPromises_;
+};
+
+BOOST_FIXTURE_TEST_CASE(AccessoryModePipelinedQueryChain_SubmitsStringsTogether, AccessoryModePipelinedQueryChainUnitTest)
+{
+    auto queryChain = std::make_shared<AccessoryModePipelinedQueryChain>(usbWrapperMock_, ioService_, queryFactoryMock_);
+    this->startChain(queryChain);
+
+    BOOST_TEST(queryPromises_.size() == 6u);
+
+    auto stringPromises = std::move(queryPromises_);
+    queryPromises_.clear();
+
+    for(auto& promise : stringPromises)
+    {
+        promise->resolve(usbEndpoint_);
+    }
+
+    EXPECT_CALL(queryFactoryMock_, createQuery(AccessoryModeQueryType::START, usbEndpoint_)).WillOnce(Return(queryMock_));
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_TEST(queryPromises_.size() == 1u);
+    queryPromises_.back()->resolve(usbEndpoint_);
+    EXPECT_CALL(promiseHandlerMock_, onResolve(deviceHandle_));
+    EXPECT_CALL(promiseHandlerMock_, onReject(_)).Times(0);
+    ioService_.run();
+
+    const auto& stepTimings = queryChain->getStepTimings();
+    BOOST_TEST(stepTimings.size() == 8u);
+    BOOST_CHECK(stepTimings.front().queryType == AccessoryModeQueryType::PROTOCOL_VERSION);
+    BOOST_CHECK(stepTimings.back().queryType == AccessoryModeQueryType::START);
+}
+
+BOOST_FIXTURE_TEST_CASE(AccessoryModePipelinedQueryChain_RejectsWithFailingStep, AccessoryModePipelinedQueryChainUnitTest)
+{
+    auto queryChain = std::make_shared<AccessoryModePipelinedQueryChain>(usbWrapperMock_, ioService_, queryFactoryMock_);
+    this->startChain(queryChain);
+
+    auto stringPromises = std::move(queryPromises_);
+    queryPromises_.clear();
+
+    const error::Error e(error::ErrorCode::USB_TRANSFER, 5);
+    stringPromises[0]->resolve(usbEndpoint_);
+    stringPromises[1]->reject(e);
+
+    EXPECT_CALL(*queryMock_, cancel()).Times(6);
+    EXPECT_CALL(queryFactoryMock_, createQuery(AccessoryModeQueryType::START, _)).Times(0);
+    EXPECT_CALL(promiseHandlerMock_, onResolve(_)).Times(0);
+    EXPECT_CALL(promiseHandlerMock_, onReject(e));
+    ioService_.run();
+
+    const auto& stepTimings = queryChain->getStepTimings();
+    BOOST_CHECK(stepTimings.back().queryType == AccessoryModeQueryType::SEND_MODEL);
+    BOOST_CHECK(stepTimings.back().errorCode == error::ErrorCode::USB_TRANSFER);
+}
+
+}
+}
+}
+}
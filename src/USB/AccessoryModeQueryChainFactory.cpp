@@ -18,6 +18,7 @@
 
 #include <f1x/aasdk/USB/AccessoryModeQueryChainFactory.hpp>
 #include <f1x/aasdk/USB/AccessoryModeQueryChain.hpp>
+#include <f1x/aasdk/USB/AccessoryModePipelinedQueryChain.hpp>
 
 namespace f1x
 {
@@ -28,16 +29,23 @@ namespace usb
 
 AccessoryModeQueryChainFactory::AccessoryModeQueryChainFactory(IUSBWrapper& usbWrapper,
                                                                boost::asio::io_service& ioService,
-                                                               IAccessoryModeQueryFactory& queryFactory)
+                                                               IAccessoryModeQueryFactory& queryFactory,
+                                                               bool pipelined)
     : usbWrapper_(usbWrapper)
     , ioService_(ioService)
     , queryFactory_(queryFactory)
+    , pipelined_(pipelined)
 {
 
 }
 
 IAccessoryModeQueryChain::Pointer AccessoryModeQueryChainFactory::create()
 {
+    if(pipelined_)
+    {
+        return std::make_shared<AccessoryModePipelinedQueryChain>(usbWrapper_, ioService_, queryFactory_);
+    }
+
     return std::make_shared<AccessoryModeQueryChain>(usbWrapper_, ioService_, queryFactory_);
 }
 
@@ -16,6 +16,7 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <f1x/aasdk/USB/ConnectedAccessoriesEnumerator.hpp>
 
 namespace f1x
@@ -25,10 +26,47 @@ namespace aasdk
 namespace usb
 {
 
+bool ConnectedAccessoriesFilter::empty() const
+{
+    return deniedDeviceClasses.empty() && allowedVendorIds.empty() && deniedVendorIds.empty();
+}
+
+bool ConnectedAccessoriesFilter::accepts(const libusb_device_descriptor& deviceDescriptor) const
+{
+    if(deniedVendorIds.count(deviceDescriptor.idVendor) != 0)
+    {
+        return false;
+    }
+
+    if(!allowedVendorIds.empty())
+    {
+        return allowedVendorIds.count(deviceDescriptor.idVendor) != 0;
+    }
+
+    return deniedDeviceClasses.count(deviceDescriptor.bDeviceClass) == 0;
+}
+
+ConnectedAccessoriesFilter ConnectedAccessoriesFilter::createDefault()
+{
+    ConnectedAccessoriesFilter filter;
+    filter.deniedDeviceClasses = {LIBUSB_CLASS_HUB, LIBUSB_CLASS_HID};
+    return filter;
+}
+
 ConnectedAccessoriesEnumerator::ConnectedAccessoriesEnumerator(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, IAccessoryModeQueryChainFactory& queryChainFactory)
+    : ConnectedAccessoriesEnumerator(usbWrapper, ioService, queryChainFactory, ConnectedAccessoriesFilter(), 1)
+{
+
+}
+
+ConnectedAccessoriesEnumerator::ConnectedAccessoriesEnumerator(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, IAccessoryModeQueryChainFactory& queryChainFactory,
+                                                               ConnectedAccessoriesFilter filter, size_t maxConcurrentQueries)
     : usbWrapper_(usbWrapper)
     , strand_(ioService)
     , queryChainFactory_(queryChainFactory)
+    , filter_(std::move(filter))
+    , maxConcurrentQueries_(std::max<size_t>(1, maxConcurrentQueries))
+    , enumerationId_(0)
 {
 
 }
@@ -43,6 +81,7 @@ void ConnectedAccessoriesEnumerator::enumerate(Promise::Pointer promise)
         else
         {
             promise_ = std::move(promise);
+            ++enumerationId_;
 
             auto result = usbWrapper_.getDeviceList(deviceListHandle_);
 
@@ -66,41 +105,71 @@ void ConnectedAccessoriesEnumerator::enumerate(Promise::Pointer promise)
 void ConnectedAccessoriesEnumerator::cancel()
 {
     strand_.dispatch([this, self = this->shared_from_this()]() mutable {
-        if(queryChain_ != nullptr)
-        {
-            queryChain_->cancel();
-        }
+        this->cancelQueryChains();
     });
 }
 
 void ConnectedAccessoriesEnumerator::queryNextDevice()
 {
-    auto deviceHandle = this->getNextDeviceHandle();
-
-    if(deviceHandle != nullptr)
+    while(queryChains_.size() < maxConcurrentQueries_)
     {
-        queryChain_ = queryChainFactory_.create();
+        auto deviceHandle = this->getNextDeviceHandle();
+
+        if(deviceHandle == nullptr)
+        {
+            break;
+        }
+
+        queryChains_.push_back(queryChainFactory_.create());
+        const auto* queryChain = queryChains_.back().get();
         auto queryChainPromise = IAccessoryModeQueryChain::Promise::defer(strand_);
 
-        queryChainPromise->then([this, self = this->shared_from_this()](DeviceHandle) mutable {
-                promise_->resolve(true);
-                this->reset();
+        const auto enumerationId = enumerationId_;
+
+        queryChainPromise->then([this, self = this->shared_from_this(), queryChain, enumerationId](DeviceHandle) mutable {
+                if(enumerationId != enumerationId_)
+                {
+                    return;
+                }
+
+                this->removeQueryChain(queryChain);
+
+                if(promise_ != nullptr)
+                {
+                    this->cancelQueryChains();
+                    promise_->resolve(true);
+                    this->reset();
+                }
             },
-            [this, self = this->shared_from_this()](const error::Error& e) mutable {
+            [this, self = this->shared_from_this(), queryChain, enumerationId](const error::Error& e) mutable {
+                if(enumerationId != enumerationId_)
+                {
+                    return;
+                }
+
+                this->removeQueryChain(queryChain);
+
+                if(promise_ == nullptr)
+                {
+                    return;
+                }
+
                 if(e != error::ErrorCode::OPERATION_ABORTED)
                 {
                     this->queryNextDevice();
                 }
                 else
                 {
+                    this->cancelQueryChains();
                     promise_->reject(e);
                     this->reset();
                 }
             });
 
-        queryChain_->start(std::move(deviceHandle), std::move(queryChainPromise));
+        queryChains_.back()->start(std::move(deviceHandle), std::move(queryChainPromise));
     }
-    else if(actualDeviceIter_ == deviceListHandle_->end())
+
+    if(queryChains_.empty() && actualDeviceIter_ == deviceListHandle_->end())
     {
         promise_->resolve(false);
         this->reset();
@@ -113,9 +182,16 @@ DeviceHandle ConnectedAccessoriesEnumerator::getNextDeviceHandle()
 
     while(actualDeviceIter_ != deviceListHandle_->end())
     {
-        auto openResult = usbWrapper_.open(*actualDeviceIter_, handle);
+        auto device = *actualDeviceIter_;
         ++actualDeviceIter_;
 
+        if(this->isFilteredOut(device))
+        {
+            continue;
+        }
+
+        auto openResult = usbWrapper_.open(device, handle);
+
         if(openResult == 0)
         {
             break;
@@ -125,9 +201,36 @@ DeviceHandle ConnectedAccessoriesEnumerator::getNextDeviceHandle()
     return handle;
 }
 
+bool ConnectedAccessoriesEnumerator::isFilteredOut(libusb_device* device) const
+{
+    if(filter_.empty())
+    {
+        return false;
+    }
+
+    libusb_device_descriptor deviceDescriptor;
+    return usbWrapper_.getDeviceDescriptor(device, deviceDescriptor) != 0 || !filter_.accepts(deviceDescriptor);
+}
+
+void ConnectedAccessoriesEnumerator::removeQueryChain(const IAccessoryModeQueryChain* queryChain)
+{
+    const auto it = std::find_if(queryChains_.begin(), queryChains_.end(),
+                                 [queryChain](const IAccessoryModeQueryChain::Pointer& item) { return item.get() == queryChain; });
+
+    if(it != queryChains_.end())
+    {
+        queryChains_.erase(it);
+    }
+}
+
+void ConnectedAccessoriesEnumerator::cancelQueryChains()
+{
+    std::for_each(queryChains_.begin(), queryChains_.end(), std::bind(&IAccessoryModeQueryChain::cancel, std::placeholders::_1));
+}
+
 void ConnectedAccessoriesEnumerator::reset()
 {
-    queryChain_.reset();
+    queryChains_.clear();
     deviceListHandle_.reset();
     actualDeviceIter_ = DeviceList::iterator();
     promise_.reset();
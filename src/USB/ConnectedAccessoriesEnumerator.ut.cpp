@@ -231,6 +231,148 @@ BOOST_FIXTURE_TEST_CASE(ConnectedAccessoriesEnumerator_CancelEnumeration, Connec
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(ConnectedAccessoriesEnumerator_FilteredDevicesAreNotOpened, ConnectedAccessoriesEnumeratorUnitTest)
+{
+    deviceList_.push_back(reinterpret_cast<libusb_device*>(1));
+    deviceList_.push_back(reinterpret_cast<libusb_device*>(2));
+    deviceList_.push_back(reinterpret_cast<libusb_device*>(3));
+
+    ConnectedAccessoriesFilter filter = ConnectedAccessoriesFilter::createDefault();
+    filter.deniedVendorIds.insert(0x1234);
+    auto connectedAccessoriesEnumerator(std::make_shared<ConnectedAccessoriesEnumerator>(usbWrapperMock_, ioService_, queryChainFactoryMock_, filter, 1));
+
+    libusb_device_descriptor hubDescriptor{};
+    hubDescriptor.bDeviceClass = LIBUSB_CLASS_HUB;
+    libusb_device_descriptor deniedVendorDescriptor{};
+    deniedVendorDescriptor.idVendor = 0x1234;
+    libusb_device_descriptor phoneDescriptor{};
+    phoneDescriptor.idVendor = 0x18D1;
+
+    EXPECT_CALL(usbWrapperMock_, getDeviceDescriptor(reinterpret_cast<libusb_device*>(1), _)).WillOnce(DoAll(SetArgReferee<1>(hubDescriptor), Return(0)));
+    EXPECT_CALL(usbWrapperMock_, getDeviceDescriptor(reinterpret_cast<libusb_device*>(2), _)).WillOnce(DoAll(SetArgReferee<1>(deniedVendorDescriptor), Return(0)));
+    EXPECT_CALL(usbWrapperMock_, getDeviceDescriptor(reinterpret_cast<libusb_device*>(3), _)).WillOnce(DoAll(SetArgReferee<1>(phoneDescriptor), Return(0)));
+    EXPECT_CALL(usbWrapperMock_, open(reinterpret_cast<libusb_device*>(1), _)).Times(0);
+    EXPECT_CALL(usbWrapperMock_, open(reinterpret_cast<libusb_device*>(2), _)).Times(0);
+    EXPECT_CALL(usbWrapperMock_, open(reinterpret_cast<libusb_device*>(3), _)).WillOnce(DoAll(SetArgReferee<1>(deviceHandle_), Return(0)));
+
+    EXPECT_CALL(queryChainFactoryMock_, create()).WillOnce(Return(queryChain_));
+    IAccessoryModeQueryChain::Promise::Pointer queryChainPromise;
+    EXPECT_CALL(queryChainMock_, start(deviceHandle_, _)).WillOnce(SaveArg<1>(&queryChainPromise));
+
+    EXPECT_CALL(usbWrapperMock_, getDeviceList(_)).WillOnce(DoAll(SetArgReferee<0>(deviceListHandle_), Return(0)));
+    connectedAccessoriesEnumerator->enumerate(std::move(promise_));
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(promiseHandlerMock_, onResolve(true));
+    EXPECT_CALL(promiseHandlerMock_, onReject(_)).Times(0);
+    queryChainPromise->resolve(deviceHandle_);
+    ioService_.run();
+}
+
+BOOST_FIXTURE_TEST_CASE(ConnectedAccessoriesEnumerator_ConcurrentQueries, ConnectedAccessoriesEnumeratorUnitTest)
+{
+    deviceList_.push_back(reinterpret_cast<libusb_device*>(1));
+    deviceList_.push_back(reinterpret_cast<libusb_device*>(2));
+    deviceList_.push_back(reinterpret_cast<libusb_device*>(3));
+    auto connectedAccessoriesEnumerator(std::make_shared<ConnectedAccessoriesEnumerator>(usbWrapperMock_, ioService_, queryChainFactoryMock_, ConnectedAccessoriesFilter(), 2));
+
+    AccessoryModeQueryChainMock queryChainMock2;
+    IAccessoryModeQueryChain::Pointer queryChain2(&queryChainMock2, [](auto*) {});
+    USBWrapperMock::DummyDeviceHandle dummyDeviceHandle2;
+    DeviceHandle deviceHandle2(reinterpret_cast<libusb_device_handle*>(&dummyDeviceHandle2), [](auto*) {});
+
+    EXPECT_CALL(usbWrapperMock_, getDeviceDescriptor(_, _)).Times(0);
+    EXPECT_CALL(usbWrapperMock_, open(reinterpret_cast<libusb_device*>(1), _)).WillOnce(DoAll(SetArgReferee<1>(deviceHandle_), Return(0)));
+    EXPECT_CALL(usbWrapperMock_, open(reinterpret_cast<libusb_device*>(2), _)).WillOnce(DoAll(SetArgReferee<1>(deviceHandle2), Return(0)));
+    EXPECT_CALL(usbWrapperMock_, open(reinterpret_cast<libusb_device*>(3), _)).Times(0);
+    EXPECT_CALL(queryChainFactoryMock_, create()).WillOnce(Return(queryChain_)).WillOnce(Return(queryChain2));
+
+    IAccessoryModeQueryChain::Promise::Pointer queryChainPromise;
+    EXPECT_CALL(queryChainMock_, start(deviceHandle_, _)).WillOnce(SaveArg<1>(&queryChainPromise));
+    IAccessoryModeQueryChain::Promise::Pointer queryChainPromise2;
+    EXPECT_CALL(queryChainMock2, start(deviceHandle2, _)).WillOnce(SaveArg<1>(&queryChainPromise2));
+
+    EXPECT_CALL(usbWrapperMock_, getDeviceList(_)).WillOnce(DoAll(SetArgReferee<0>(deviceListHandle_), Return(0)));
+    connectedAccessoriesEnumerator->enumerate(std::move(promise_));
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(queryChainMock_, cancel());
+    EXPECT_CALL(promiseHandlerMock_, onResolve(true));
+    EXPECT_CALL(promiseHandlerMock_, onReject(_)).Times(0);
+    queryChainPromise2->resolve(deviceHandle2);
+    ioService_.run();
+    ioService_.reset();
+
+    queryChainPromise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+    ioService_.run();
+}
+
+BOOST_FIXTURE_TEST_CASE(ConnectedAccessoriesEnumerator_CancelledChainDoesNotCompleteNextEnumeration, ConnectedAccessoriesEnumeratorUnitTest)
+{
+    deviceList_.push_back(reinterpret_cast<libusb_device*>(1));
+    deviceList_.push_back(reinterpret_cast<libusb_device*>(2));
+    auto connectedAccessoriesEnumerator(std::make_shared<ConnectedAccessoriesEnumerator>(usbWrapperMock_, ioService_, queryChainFactoryMock_, ConnectedAccessoriesFilter(), 2));
+
+    AccessoryModeQueryChainMock queryChainMock2;
+    IAccessoryModeQueryChain::Pointer queryChain2(&queryChainMock2, [](auto*) {});
+    USBWrapperMock::DummyDeviceHandle dummyDeviceHandle2;
+    DeviceHandle deviceHandle2(reinterpret_cast<libusb_device_handle*>(&dummyDeviceHandle2), [](auto*) {});
+
+    AccessoryModeQueryChainMock queryChainMock3;
+    IAccessoryModeQueryChain::Pointer queryChain3(&queryChainMock3, [](auto*) {});
+    DeviceList deviceList3{reinterpret_cast<libusb_device*>(3)};
+    DeviceListHandle deviceListHandle3(&deviceList3, [](auto*) {});
+    USBWrapperMock::DummyDeviceHandle dummyDeviceHandle3;
+    DeviceHandle deviceHandle3(reinterpret_cast<libusb_device_handle*>(&dummyDeviceHandle3), [](auto*) {});
+
+    EXPECT_CALL(usbWrapperMock_, open(reinterpret_cast<libusb_device*>(1), _)).WillOnce(DoAll(SetArgReferee<1>(deviceHandle_), Return(0)));
+    EXPECT_CALL(usbWrapperMock_, open(reinterpret_cast<libusb_device*>(2), _)).WillOnce(DoAll(SetArgReferee<1>(deviceHandle2), Return(0)));
+    EXPECT_CALL(usbWrapperMock_, open(reinterpret_cast<libusb_device*>(3), _)).WillOnce(DoAll(SetArgReferee<1>(deviceHandle3), Return(0)));
+    EXPECT_CALL(queryChainFactoryMock_, create()).WillOnce(Return(queryChain_)).WillOnce(Return(queryChain2)).WillOnce(Return(queryChain3));
+    EXPECT_CALL(usbWrapperMock_, getDeviceList(_))
+            .WillOnce(DoAll(SetArgReferee<0>(deviceListHandle_), Return(0)))
+            .WillOnce(DoAll(SetArgReferee<0>(deviceListHandle3), Return(0)));
+
+    IAccessoryModeQueryChain::Promise::Pointer queryChainPromise;
+    EXPECT_CALL(queryChainMock_, start(deviceHandle_, _)).WillOnce(SaveArg<1>(&queryChainPromise));
+    IAccessoryModeQueryChain::Promise::Pointer queryChainPromise2;
+    EXPECT_CALL(queryChainMock2, start(deviceHandle2, _)).WillOnce(SaveArg<1>(&queryChainPromise2));
+    IAccessoryModeQueryChain::Promise::Pointer queryChainPromise3;
+    EXPECT_CALL(queryChainMock3, start(deviceHandle3, _)).WillOnce(SaveArg<1>(&queryChainPromise3));
+
+    connectedAccessoriesEnumerator->enumerate(std::move(promise_));
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(queryChainMock_, cancel());
+    EXPECT_CALL(promiseHandlerMock_, onResolve(true));
+    EXPECT_CALL(promiseHandlerMock_, onReject(_)).Times(0);
+    queryChainPromise2->resolve(deviceHandle2);
+    ioService_.run();
+    ioService_.reset();
+
+    // the next enumeration starts before the cancelled chain reports its abort
+    ConnectedAccessoriesEnumeratorPromiseHandlerMock promiseHandlerMock2;
+    auto promise2 = IConnectedAccessoriesEnumerator::Promise::defer(ioService_);
+    promise2->then(std::bind(&ConnectedAccessoriesEnumeratorPromiseHandlerMock::onResolve, &promiseHandlerMock2, std::placeholders::_1),
+                   std::bind(&ConnectedAccessoriesEnumeratorPromiseHandlerMock::onReject, &promiseHandlerMock2, std::placeholders::_1));
+    connectedAccessoriesEnumerator->enumerate(std::move(promise2));
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(queryChainMock3, cancel()).Times(0);
+    EXPECT_CALL(promiseHandlerMock2, onReject(_)).Times(0);
+    queryChainPromise->reject(error::Error(error::ErrorCode::OPERATION_ABORTED));
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(promiseHandlerMock2, onResolve(true));
+    queryChainPromise3->resolve(deviceHandle3);
+    ioService_.run();
+}
+
 }
 }
 }
@@ -0,0 +1,610 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <f1x/aasdk/USB/SimulatedUSBWrapper.hpp>
+#include <f1x/aasdk/IO/SimulationTimer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+
+constexpr uint8_t SimulatedUSBWrapper::cAccessoryGetProtocol;
+constexpr uint8_t SimulatedUSBWrapper::cAccessorySendString;
+constexpr uint8_t SimulatedUSBWrapper::cAccessoryStart;
+constexpr uint16_t SimulatedUSBWrapper::cGoogleVendorId;
+constexpr uint16_t SimulatedUSBWrapper::cAOAPId;
+constexpr uint8_t SimulatedUSBWrapper::cInEndpointAddress;
+constexpr uint8_t SimulatedUSBWrapper::cOutEndpointAddress;
+
+SimulatedUSBWrapper::SimulatedUSBWrapper(boost::asio::io_service& ioService, SimulatedPhoneConfiguration configuration)
+    : ioService_(ioService)
+    , configuration_(std::move(configuration))
+    , nextHotplugCallbackId_(1)
+    , accessoryModeStarted_(false)
+    , eventsInterrupted_(false)
+    , endpointDescriptors_()
+    , interfaceDescriptor_()
+    , interface_()
+    , configDescriptor_()
+    , alive_(std::make_shared<bool>(true))
+{
+    endpointDescriptors_[0].bEndpointAddress = cInEndpointAddress;
+    endpointDescriptors_[0].bmAttributes = LIBUSB_TRANSFER_TYPE_BULK;
+    endpointDescriptors_[0].wMaxPacketSize = 512;
+    endpointDescriptors_[1].bEndpointAddress = cOutEndpointAddress;
+    endpointDescriptors_[1].bmAttributes = LIBUSB_TRANSFER_TYPE_BULK;
+    endpointDescriptors_[1].wMaxPacketSize = 512;
+
+    interfaceDescriptor_.bNumEndpoints = 2;
+    interfaceDescriptor_.bInterfaceClass = LIBUSB_CLASS_VENDOR_SPEC;
+    interfaceDescriptor_.endpoint = endpointDescriptors_;
+
+    interface_.altsetting = &interfaceDescriptor_;
+    interface_.num_altsetting = 1;
+
+    configDescriptor_.bNumInterfaces = 1;
+    configDescriptor_.interface = &interface_;
+}
+
+SimulatedUSBWrapper::~SimulatedUSBWrapper()
+{
+    alive_.reset();
+}
+
+void SimulatedUSBWrapper::connectPhone()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    auto& device = this->addDevice(configuration_.vendorId, configuration_.productId);
+    this->notifyArrival(device);
+}
+
+void SimulatedUSBWrapper::disconnectPhone()
+{
+    std::deque<libusb_transfer*> pendingInTransfers;
+
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        std::for_each(devices_.begin(), devices_.end(), [](Device& device) { device.connected = false; });
+        std::swap(pendingInTransfers, pendingInTransfers_);
+    }
+
+    for(auto* transfer : pendingInTransfers)
+    {
+        this->scheduleCompletion(transfer, io::SimulationClock::now(), LIBUSB_TRANSFER_NO_DEVICE, 0);
+    }
+}
+
+void SimulatedUSBWrapper::sendToHeadUnit(common::Data data)
+{
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        phoneData_.insert(phoneData_.end(), data.begin(), data.end());
+    }
+
+    this->completeInTransfers();
+}
+
+void SimulatedUSBWrapper::setHeadUnitDataHandler(HeadUnitDataHandler handler)
+{
+    common::Data headUnitData;
+
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        headUnitDataHandler_ = handler;
+        std::swap(headUnitData, headUnitData_);
+    }
+
+    if(handler && !headUnitData.empty())
+    {
+        handler(std::move(headUnitData));
+    }
+}
+
+std::string SimulatedUSBWrapper::getAccessoryString(uint16_t index) const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    const auto it = accessoryStrings_.find(index);
+    return it != accessoryStrings_.end() ? it->second : std::string();
+}
+
+bool SimulatedUSBWrapper::isAccessoryModeStarted() const
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    return accessoryModeStarted_;
+}
+
+int SimulatedUSBWrapper::releaseInterface(const DeviceHandle&, int)
+{
+    return LIBUSB_SUCCESS;
+}
+
+libusb_device* SimulatedUSBWrapper::getDevice(const DeviceHandle& dev_handle)
+{
+    // handles and devices are the same simulated object
+    return reinterpret_cast<libusb_device*>(dev_handle.get());
+}
+
+int SimulatedUSBWrapper::claimInterface(const DeviceHandle& dev_handle, int interface_number)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    auto device = this->findDevice(this->getDevice(dev_handle));
+    return device != nullptr && device->connected && interface_number == 0 ? LIBUSB_SUCCESS : LIBUSB_ERROR_IO;
+}
+
+DeviceHandle SimulatedUSBWrapper::openDeviceWithVidPid(uint16_t vendor_id, uint16_t product_id)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    for(auto& device : devices_)
+    {
+        if(device.connected && device.descriptor.idVendor == vendor_id && device.descriptor.idProduct == product_id)
+        {
+            return DeviceHandle(reinterpret_cast<libusb_device_handle*>(&device), [](auto*) {});
+        }
+    }
+
+    return DeviceHandle();
+}
+
+int SimulatedUSBWrapper::getConfigDescriptor(libusb_device *dev, uint8_t config_index, ConfigDescriptorHandle& config_descriptor_handle)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    if(this->findDevice(dev) == nullptr || config_index != 0)
+    {
+        config_descriptor_handle.reset();
+        return LIBUSB_ERROR_IO;
+    }
+
+    config_descriptor_handle = ConfigDescriptorHandle(&configDescriptor_, [](auto*) {});
+    return LIBUSB_SUCCESS;
+}
+
+void SimulatedUSBWrapper::fillBulkTransfer(libusb_transfer *transfer,
+    const DeviceHandle& dev_handle, unsigned char endpoint,
+    unsigned char *buffer, int length, libusb_transfer_cb_fn callback,
+    void *user_data, unsigned int timeout)
+{
+    transfer->dev_handle = dev_handle.get();
+    transfer->endpoint = endpoint;
+    transfer->type = LIBUSB_TRANSFER_TYPE_BULK;
+    transfer->timeout = timeout;
+    transfer->buffer = buffer;
+    transfer->length = length;
+    transfer->actual_length = 0;
+    transfer->callback = callback;
+    transfer->user_data = user_data;
+}
+
+void SimulatedUSBWrapper::fillInterruptTransfer(libusb_transfer *transfer,
+    const DeviceHandle& dev_handle, unsigned char endpoint,
+    unsigned char *buffer, int length, libusb_transfer_cb_fn callback,
+    void *user_data, unsigned int timeout)
+{
+    this->fillBulkTransfer(transfer, dev_handle, endpoint, buffer, length, callback, user_data, timeout);
+    transfer->type = LIBUSB_TRANSFER_TYPE_INTERRUPT;
+}
+
+void SimulatedUSBWrapper::fillControlTransfer(
+    libusb_transfer *transfer, const DeviceHandle& dev_handle,
+    unsigned char *buffer, libusb_transfer_cb_fn callback, void *user_data,
+    unsigned int timeout)
+{
+    const uint16_t wLength = buffer[6] | (buffer[7] << 8);
+
+    transfer->dev_handle = dev_handle.get();
+    transfer->endpoint = 0;
+    transfer->type = LIBUSB_TRANSFER_TYPE_CONTROL;
+    transfer->timeout = timeout;
+    transfer->buffer = buffer;
+    transfer->length = LIBUSB_CONTROL_SETUP_SIZE + wLength;
+    transfer->actual_length = 0;
+    transfer->callback = callback;
+    transfer->user_data = user_data;
+}
+
+int SimulatedUSBWrapper::submitTransfer(libusb_transfer *transfer)
+{
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        auto device = this->findDevice(reinterpret_cast<libusb_device*>(transfer->dev_handle));
+
+        if(device == nullptr || !device->connected)
+        {
+            return LIBUSB_ERROR_IO;
+        }
+    }
+
+    if(transfer->type == LIBUSB_TRANSFER_TYPE_CONTROL)
+    {
+        this->handleControlTransfer(transfer);
+    }
+    else if((transfer->endpoint & LIBUSB_ENDPOINT_DIR_MASK) == LIBUSB_ENDPOINT_IN)
+    {
+        {
+            std::lock_guard<decltype(mutex_)> lock(mutex_);
+            pendingInTransfers_.push_back(transfer);
+        }
+
+        this->completeInTransfers();
+    }
+    else
+    {
+        this->handleBulkOutTransfer(transfer);
+    }
+
+    return LIBUSB_SUCCESS;
+}
+
+int SimulatedUSBWrapper::cancelTransfer(libusb_transfer *transfer)
+{
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        auto it = std::find(pendingInTransfers_.begin(), pendingInTransfers_.end(), transfer);
+
+        // transfers already scheduled for completion finish normally, as they would on real hardware
+        if(it == pendingInTransfers_.end())
+        {
+            return LIBUSB_ERROR_NOT_FOUND;
+        }
+
+        pendingInTransfers_.erase(it);
+    }
+
+    this->scheduleCompletion(transfer, io::SimulationClock::now(), LIBUSB_TRANSFER_CANCELLED, 0);
+    return LIBUSB_SUCCESS;
+}
+
+void SimulatedUSBWrapper::freeTransfer(libusb_transfer *transfer)
+{
+    delete transfer;
+}
+
+ssize_t SimulatedUSBWrapper::getDeviceList(DeviceListHandle& handle)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    handle = std::make_shared<DeviceList>();
+
+    for(auto& device : devices_)
+    {
+        if(device.connected)
+        {
+            handle->push_back(reinterpret_cast<libusb_device*>(&device));
+        }
+    }
+
+    return handle->size();
+}
+
+int SimulatedUSBWrapper::open(libusb_device *dev, DeviceHandle& dev_handle)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    auto device = this->findDevice(dev);
+
+    if(device == nullptr || !device->connected)
+    {
+        dev_handle.reset();
+        return LIBUSB_ERROR_IO;
+    }
+
+    dev_handle = DeviceHandle(reinterpret_cast<libusb_device_handle*>(device), [](auto*) {});
+    return LIBUSB_SUCCESS;
+}
+
+void SimulatedUSBWrapper::fillControlSetup(unsigned char *buffer,
+    uint8_t bmRequestType, uint8_t bRequest, uint16_t wValue, uint16_t wIndex,
+    uint16_t wLength)
+{
+    buffer[0] = bmRequestType;
+    buffer[1] = bRequest;
+    buffer[2] = wValue & 0xFF;
+    buffer[3] = wValue >> 8;
+    buffer[4] = wIndex & 0xFF;
+    buffer[5] = wIndex >> 8;
+    buffer[6] = wLength & 0xFF;
+    buffer[7] = wLength >> 8;
+}
+
+int SimulatedUSBWrapper::getDeviceDescriptor(libusb_device *dev, libusb_device_descriptor &desc)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    auto device = this->findDevice(dev);
+
+    if(device == nullptr)
+    {
+        return LIBUSB_ERROR_IO;
+    }
+
+    desc = device->descriptor;
+    return LIBUSB_SUCCESS;
+}
+
+void SimulatedUSBWrapper::handleEvents()
+{
+    // transfers complete on the io_service, an event thread only has to idle here
+    std::unique_lock<decltype(mutex_)> lock(mutex_);
+    eventsCondition_.wait_for(lock, std::chrono::milliseconds(100), [this]() { return eventsInterrupted_; });
+    eventsInterrupted_ = false;
+}
+
+void SimulatedUSBWrapper::interruptEventHandler()
+{
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        eventsInterrupted_ = true;
+    }
+
+    eventsCondition_.notify_all();
+}
+
+int SimulatedUSBWrapper::handleEventsTimeout(timeval*)
+{
+    return LIBUSB_SUCCESS;
+}
+
+PollfdList SimulatedUSBWrapper::getPollfds()
+{
+    return PollfdList();
+}
+
+void SimulatedUSBWrapper::setPollfdNotifiers(libusb_pollfd_added_cb, libusb_pollfd_removed_cb, void*)
+{
+
+}
+
+int SimulatedUSBWrapper::getNextTimeout(timeval*)
+{
+    return 0;
+}
+
+bool SimulatedUSBWrapper::pollfdsHandleTimeouts()
+{
+    return true;
+}
+
+HotplugCallbackHandle SimulatedUSBWrapper::hotplugRegisterCallback(libusb_hotplug_event events, libusb_hotplug_flag, int, int, int,
+                                                                   libusb_hotplug_callback_fn cb_fn, void *user_data)
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+    const auto id = nextHotplugCallbackId_++;
+    hotplugCallbacks_.emplace(id, HotplugCallback{events, cb_fn, user_data});
+
+    std::weak_ptr<bool> alive(alive_);
+    return HotplugCallbackHandle(new libusb_hotplug_callback_handle(id), [this, alive](libusb_hotplug_callback_handle* handle) {
+        if(!alive.expired())
+        {
+            std::lock_guard<decltype(mutex_)> lock(mutex_);
+            hotplugCallbacks_.erase(*handle);
+        }
+
+        delete handle;
+    });
+}
+
+libusb_transfer* SimulatedUSBWrapper::allocTransfer(int)
+{
+    return new libusb_transfer();
+}
+
+unsigned char* SimulatedUSBWrapper::devMemAlloc(const DeviceHandle&, size_t)
+{
+    return nullptr;
+}
+
+int SimulatedUSBWrapper::devMemFree(const DeviceHandle&, unsigned char*, size_t)
+{
+    return LIBUSB_ERROR_NOT_SUPPORTED;
+}
+
+SimulatedUSBWrapper::Device& SimulatedUSBWrapper::addDevice(uint16_t vendorId, uint16_t productId)
+{
+    Device device{};
+    device.descriptor.bLength = sizeof(libusb_device_descriptor);
+    device.descriptor.bcdUSB = 0x0200;
+    device.descriptor.bMaxPacketSize0 = 64;
+    device.descriptor.idVendor = vendorId;
+    device.descriptor.idProduct = productId;
+    device.descriptor.bNumConfigurations = 1;
+    device.connected = true;
+
+    devices_.push_back(device);
+    return devices_.back();
+}
+
+SimulatedUSBWrapper::Device* SimulatedUSBWrapper::findDevice(libusb_device* device)
+{
+    const auto it = std::find_if(devices_.begin(), devices_.end(), [device](const Device& item) { return reinterpret_cast<const libusb_device*>(&item) == device; });
+    return it != devices_.end() ? &(*it) : nullptr;
+}
+
+void SimulatedUSBWrapper::notifyArrival(Device& device)
+{
+    auto* rawDevice = reinterpret_cast<libusb_device*>(&device);
+
+    this->schedule(io::SimulationClock::now(), [this, rawDevice]() {
+        HotplugCallbacks hotplugCallbacks;
+
+        {
+            std::lock_guard<decltype(mutex_)> lock(mutex_);
+            hotplugCallbacks = hotplugCallbacks_;
+        }
+
+        for(const auto& hotplugCallback : hotplugCallbacks)
+        {
+            if((hotplugCallback.second.events & LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED) != 0)
+            {
+                hotplugCallback.second.callback(nullptr, rawDevice, LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED, hotplugCallback.second.userData);
+            }
+        }
+    });
+}
+
+void SimulatedUSBWrapper::handleControlTransfer(libusb_transfer* transfer)
+{
+    const uint8_t bRequest = transfer->buffer[1];
+    const uint16_t wIndex = transfer->buffer[4] | (transfer->buffer[5] << 8);
+    const uint16_t wLength = transfer->buffer[6] | (transfer->buffer[7] << 8);
+    auto* payload = transfer->buffer + LIBUSB_CONTROL_SETUP_SIZE;
+    const auto when = io::SimulationClock::now() + configuration_.controlTransferLatency;
+
+    if(bRequest == cAccessoryGetProtocol && wLength >= sizeof(uint16_t))
+    {
+        payload[0] = configuration_.protocolVersion & 0xFF;
+        payload[1] = configuration_.protocolVersion >> 8;
+        this->scheduleCompletion(transfer, when, LIBUSB_TRANSFER_COMPLETED, sizeof(uint16_t));
+    }
+    else if(bRequest == cAccessorySendString)
+    {
+        {
+            std::lock_guard<decltype(mutex_)> lock(mutex_);
+            accessoryStrings_[wIndex] = std::string(reinterpret_cast<const char*>(payload), strnlen(reinterpret_cast<const char*>(payload), wLength));
+        }
+
+        this->scheduleCompletion(transfer, when, LIBUSB_TRANSFER_COMPLETED, wLength);
+    }
+    else if(bRequest == cAccessoryStart)
+    {
+        auto* phone = reinterpret_cast<libusb_device*>(transfer->dev_handle);
+
+        this->scheduleCompletion(transfer, when, LIBUSB_TRANSFER_COMPLETED, 0, [this, phone]() {
+            std::lock_guard<decltype(mutex_)> lock(mutex_);
+            accessoryModeStarted_ = true;
+
+            this->schedule(io::SimulationClock::now() + configuration_.reenumerationDelay, [this, phone]() {
+                std::lock_guard<decltype(mutex_)> lock(mutex_);
+                auto device = this->findDevice(phone);
+
+                if(device != nullptr)
+                {
+                    device->connected = false;
+                }
+
+                auto& accessory = this->addDevice(cGoogleVendorId, cAOAPId);
+                this->notifyArrival(accessory);
+            });
+        });
+    }
+    else
+    {
+        this->scheduleCompletion(transfer, when, LIBUSB_TRANSFER_STALL, 0);
+    }
+}
+
+void SimulatedUSBWrapper::handleBulkOutTransfer(libusb_transfer* transfer)
+{
+    common::Data data(transfer->buffer, transfer->buffer + transfer->length);
+    TimePoint when;
+
+    {
+        std::lock_guard<decltype(mutex_)> lock(mutex_);
+        const auto linkBusyUntil = outLinkBusyUntil_;
+        when = this->reserveLink(outLinkBusyUntil_, data.size());
+
+        // libusb gives up on a transfer that cannot complete within its timeout, nothing reaches the phone
+        const auto timeout = std::chrono::milliseconds(transfer->timeout);
+        if(transfer->timeout > 0 && when - io::SimulationClock::now() > timeout)
+        {
+            outLinkBusyUntil_ = linkBusyUntil;
+            this->scheduleCompletion(transfer, io::SimulationClock::now() + timeout, LIBUSB_TRANSFER_TIMED_OUT, 0);
+            return;
+        }
+    }
+
+    this->scheduleCompletion(transfer, when, LIBUSB_TRANSFER_COMPLETED, transfer->length, [this, data = std::move(data)]() mutable {
+        HeadUnitDataHandler handler;
+
+        {
+            std::lock_guard<decltype(mutex_)> lock(mutex_);
+            handler = headUnitDataHandler_;
+
+            if(!handler)
+            {
+                headUnitData_.insert(headUnitData_.end(), data.begin(), data.end());
+            }
+        }
+
+        if(handler)
+        {
+            handler(std::move(data));
+        }
+    });
+}
+
+void SimulatedUSBWrapper::completeInTransfers()
+{
+    std::lock_guard<decltype(mutex_)> lock(mutex_);
+
+    while(!pendingInTransfers_.empty() && !phoneData_.empty())
+    {
+        auto* transfer = pendingInTransfers_.front();
+        pendingInTransfers_.pop_front();
+
+        const auto size = std::min<size_t>(transfer->length, phoneData_.size());
+        std::copy(phoneData_.begin(), phoneData_.begin() + size, transfer->buffer);
+        phoneData_.erase(phoneData_.begin(), phoneData_.begin() + size);
+
+        this->scheduleCompletion(transfer, this->reserveLink(inLinkBusyUntil_, size), LIBUSB_TRANSFER_COMPLETED, size);
+    }
+}
+
+SimulatedUSBWrapper::TimePoint SimulatedUSBWrapper::reserveLink(TimePoint& linkBusyUntil, size_t size)
+{
+    const auto start = std::max(io::SimulationClock::now(), linkBusyUntil);
+    const auto transmissionTime = configuration_.bytesPerSecond == 0
+            ? std::chrono::microseconds(0)
+            : std::chrono::microseconds(size * 1000000 / configuration_.bytesPerSecond);
+
+    linkBusyUntil = start + transmissionTime;
+    return linkBusyUntil + configuration_.bulkTransferLatency;
+}
+
+void SimulatedUSBWrapper::scheduleCompletion(libusb_transfer* transfer, TimePoint when, libusb_transfer_status status, int actualLength, std::function<void()> afterCompletion)
+{
+    this->schedule(when, [transfer, status, actualLength, afterCompletion = std::move(afterCompletion)]() {
+        transfer->status = status;
+        transfer->actual_length = actualLength;
+        transfer->callback(transfer);
+
+        if(afterCompletion)
+        {
+            afterCompletion();
+        }
+    });
+}
+
+void SimulatedUSBWrapper::schedule(TimePoint when, std::function<void()> handler)
+{
+    auto timer = std::make_shared<io::SimulationTimer>(ioService_, when);
+    std::weak_ptr<bool> alive(alive_);
+
+    timer->asyncWait([timer, alive, handler = std::move(handler)](const boost::system::error_code& e) {
+        if(!e && !alive.expired())
+        {
+            handler();
+        }
+    });
+}
+
+}
+}
+}
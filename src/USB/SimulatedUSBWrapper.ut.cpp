@@ -0,0 +1,139 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/USB/SimulatedUSBWrapper.hpp>
+#include <f1x/aasdk/USB/USBHub.hpp>
+#include <f1x/aasdk/USB/AccessoryModeQueryFactory.hpp>
+#include <f1x/aasdk/USB/AccessoryModeQueryChainFactory.hpp>
+#include <f1x/aasdk/USB/AOAPDevice.hpp>
+#include <f1x/aasdk/Transport/USBTransport.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+namespace ut
+{
+
+class SimulatedUSBWrapperUnitTest
+{
+protected:
+    SimulatedUSBWrapperUnitTest()
+        : usbWrapper_(ioService_, createConfiguration())
+        , queryFactory_(usbWrapper_, ioService_)
+        , queryChainFactory_(usbWrapper_, ioService_, queryFactory_)
+    {
+
+    }
+
+    static SimulatedPhoneConfiguration createConfiguration()
+    {
+        SimulatedPhoneConfiguration configuration;
+        configuration.controlTransferLatency = std::chrono::microseconds(10);
+        configuration.reenumerationDelay = std::chrono::milliseconds(1);
+        configuration.bulkTransferLatency = std::chrono::microseconds(10);
+        return configuration;
+    }
+
+    DeviceHandle connectAccessory()
+    {
+        DeviceHandle accessoryHandle;
+        auto hub = std::make_shared<USBHub>(usbWrapper_, ioService_, queryChainFactory_, std::chrono::milliseconds(0));
+        auto hubPromise = IUSBHub::Promise::defer(ioService_);
+        hubPromise->then([&accessoryHandle](DeviceHandle handle) { accessoryHandle = std::move(handle); },
+                         [](const error::Error& e) { BOOST_FAIL(e.what()); });
+
+        hub->start(std::move(hubPromise));
+        ioService_.poll();
+        ioService_.reset();
+        usbWrapper_.connectPhone();
+        ioService_.run();
+        ioService_.reset();
+
+        hub->cancel();
+        ioService_.run();
+        ioService_.reset();
+        return accessoryHandle;
+    }
+
+    boost::asio::io_service ioService_;
+    SimulatedUSBWrapper usbWrapper_;
+    AccessoryModeQueryFactory queryFactory_;
+    AccessoryModeQueryChainFactory queryChainFactory_;
+};
+
+BOOST_FIXTURE_TEST_CASE(SimulatedUSBWrapper_SwitchToAccessoryMode, SimulatedUSBWrapperUnitTest)
+{
+    auto accessoryHandle = this->connectAccessory();
+    BOOST_REQUIRE(accessoryHandle != nullptr);
+
+    libusb_device_descriptor deviceDescriptor;
+    BOOST_TEST(usbWrapper_.getDeviceDescriptor(usbWrapper_.getDevice(accessoryHandle), deviceDescriptor) == 0);
+    BOOST_TEST(deviceDescriptor.idVendor == 0x18D1);
+    BOOST_TEST(deviceDescriptor.idProduct == 0x2D00);
+    BOOST_TEST(usbWrapper_.isAccessoryModeStarted());
+    BOOST_TEST(usbWrapper_.getAccessoryString(0) == "Android");
+
+    DeviceListHandle deviceList;
+    BOOST_TEST(usbWrapper_.getDeviceList(deviceList) == 1);
+}
+
+BOOST_FIXTURE_TEST_CASE(SimulatedUSBWrapper_BulkTransfersOverUSBTransport, SimulatedUSBWrapperUnitTest)
+{
+    auto accessoryHandle = this->connectAccessory();
+    BOOST_REQUIRE(accessoryHandle != nullptr);
+
+    common::Data phoneReceivedData;
+    usbWrapper_.setHeadUnitDataHandler([&phoneReceivedData](common::Data data) {
+        phoneReceivedData.insert(phoneReceivedData.end(), data.begin(), data.end());
+    });
+
+    auto transport = std::make_shared<transport::USBTransport>(ioService_, AOAPDevice::create(usbWrapper_, ioService_, accessoryHandle));
+
+    const common::Data sentData(50000, 0x5E);
+    bool sent = false;
+    auto sendPromise = transport::ITransport::SendPromise::defer(ioService_);
+    sendPromise->then([&sent]() { sent = true; }, [](const error::Error& e) { BOOST_FAIL(e.what()); });
+    transport->send(sentData, std::move(sendPromise));
+
+    const common::Data phoneData(30000, 0x5F);
+    common::Data receivedData;
+    auto receivePromise = transport::ITransport::ReceivePromise::defer(ioService_);
+    receivePromise->then([&receivedData](common::Data data) { receivedData = std::move(data); }, [](const error::Error& e) { BOOST_FAIL(e.what()); });
+    transport->receive(phoneData.size(), std::move(receivePromise));
+    usbWrapper_.sendToHeadUnit(phoneData);
+
+    ioService_.run();
+    ioService_.reset();
+
+    BOOST_TEST(sent);
+    BOOST_CHECK(phoneReceivedData == sentData);
+    BOOST_CHECK(receivedData == phoneData);
+
+    transport->stop();
+    transport.reset();
+    ioService_.run();
+}
+
+}
+}
+}
+}
@@ -16,6 +16,7 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include <algorithm>
 #include <f1x/aasdk/USB/USBEndpoint.hpp>
 #include <f1x/aasdk/USB/IUSBWrapper.hpp>
 #include <f1x/aasdk/Error/Error.hpp>
@@ -27,12 +28,33 @@ namespace aasdk
 namespace usb
 {
 
-USBEndpoint::USBEndpoint(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle, uint8_t endpointAddress)
+USBEndpoint::USBEndpoint(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, DeviceHandle handle, uint8_t endpointAddress, size_t transferPoolSize)
     : usbWrapper_(usbWrapper)
     , strand_(ioService)
     , handle_(std::move(handle))
     , endpointAddress_(endpointAddress)
+    , transfersInFlight_(0)
+    , transferPoolSize_(transferPoolSize)
 {
+    transferSlots_.resize(transferPoolSize_);
+    transferPool_.reserve(transferPoolSize_);
+}
+
+USBEndpoint::USBEndpoint(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& strand, DeviceHandle handle, uint8_t endpointAddress, size_t transferPoolSize)
+    : usbWrapper_(usbWrapper)
+    , strand_(strand)
+    , handle_(std::move(handle))
+    , endpointAddress_(endpointAddress)
+    , transfersInFlight_(0)
+    , transferPoolSize_(transferPoolSize)
+{
+    transferSlots_.resize(transferPoolSize_);
+    transferPool_.reserve(transferPoolSize_);
+}
+
+USBEndpoint::~USBEndpoint()
+{
+    std::for_each(transferPool_.begin(), transferPool_.end(), std::bind(&IUSBWrapper::freeTransfer, &usbWrapper_, std::placeholders::_1));
 }
 
 void USBEndpoint::controlTransfer(common::DataBuffer buffer, uint32_t timeout, Promise::Pointer promise)
@@ -43,7 +65,7 @@ void USBEndpoint::controlTransfer(common::DataBuffer buffer, uint32_t timeout, P
     }
     else
     {
-        auto* transfer = usbWrapper_.allocTransfer(0);
+        auto* transfer = this->acquireTransfer();
         if(transfer == nullptr)
         {
             promise->reject(error::Error(error::ErrorCode::USB_TRANSFER_ALLOCATION));
@@ -64,7 +86,7 @@ void USBEndpoint::interruptTransfer(common::DataBuffer buffer, uint32_t timeout,
     }
     else
     {
-        auto* transfer = usbWrapper_.allocTransfer(0);
+        auto* transfer = this->acquireTransfer();
         if(transfer == nullptr)
         {
             promise->reject(error::Error(error::ErrorCode::USB_TRANSFER_ALLOCATION));
@@ -85,7 +107,7 @@ void USBEndpoint::bulkTransfer(common::DataBuffer buffer, uint32_t timeout, Prom
     }
     else
     {
-        auto* transfer = usbWrapper_.allocTransfer(0);
+        auto* transfer = this->acquireTransfer();
         if(transfer == nullptr)
         {
             promise->reject(error::Error(error::ErrorCode::USB_TRANSFER_ALLOCATION));
@@ -111,12 +133,20 @@ void USBEndpoint::transfer(libusb_transfer *transfer, Promise::Pointer promise)
                 self_ = std::move(self);
             }
 
-            transfers_.insert(std::make_pair(transfer, std::move(promise)));
+            auto slot = this->findSlot(nullptr);
+            if(slot == transferSlots_.end())
+            {
+                slot = transferSlots_.emplace(transferSlots_.end());
+            }
+
+            slot->transfer = transfer;
+            slot->promise = std::move(promise);
+            ++transfersInFlight_;
         }
         else
         {
             promise->reject(error::Error(error::ErrorCode::USB_TRANSFER, submitResult));
-            usbWrapper_.freeTransfer(transfer);
+            this->releaseTransfer(transfer);
         }
     });
 }
@@ -129,9 +159,12 @@ uint8_t USBEndpoint::getAddress()
 void USBEndpoint::cancelTransfers()
 {
     strand_.dispatch([this, self = this->shared_from_this()]() mutable {
-        for(const auto& transfer : transfers_)
+        for(const auto& slot : transferSlots_)
         {
-            usbWrapper_.cancelTransfer(transfer.first);
+            if(slot.transfer != nullptr)
+            {
+                usbWrapper_.cancelTransfer(slot.transfer);
+            }
         }
     });
 }
@@ -141,17 +174,25 @@ DeviceHandle USBEndpoint::getDeviceHandle() const
     return handle_;
 }
 
+USBTransferBuffer::Pointer USBEndpoint::allocateTransferBuffer(size_t size)
+{
+    return std::make_shared<USBTransferBuffer>(usbWrapper_, handle_, size);
+}
+
 void USBEndpoint::transferHandler(libusb_transfer *transfer)
 {
     auto self = reinterpret_cast<USBEndpoint*>(transfer->user_data)->shared_from_this();
 
     self->strand_.dispatch([self, transfer]() mutable {
-        if(self->transfers_.count(transfer) == 0)
+        auto slot = self->findSlot(transfer);
+        if(slot == self->transferSlots_.end())
         {
             return;
         }
 
-        auto promise(std::move(self->transfers_.at(transfer)));
+        auto promise(std::move(slot->promise));
+        slot->transfer = nullptr;
+        --self->transfersInFlight_;
 
         if(transfer->status == LIBUSB_TRANSFER_COMPLETED)
         {
@@ -163,16 +204,51 @@ void USBEndpoint::transferHandler(libusb_transfer *transfer)
             promise->reject(error);
         }
 
-        self->usbWrapper_.freeTransfer(transfer);
-        self->transfers_.erase(transfer);
+        self->releaseTransfer(transfer);
 
-        if(self->transfers_.empty())
+        if(self->transfersInFlight_ == 0)
         {
             self->self_.reset();
         }
     });
 }
 
+libusb_transfer* USBEndpoint::acquireTransfer()
+{
+    {
+        std::lock_guard<decltype(transferPoolMutex_)> lock(transferPoolMutex_);
+
+        if(!transferPool_.empty())
+        {
+            auto* transfer = transferPool_.back();
+            transferPool_.pop_back();
+            return transfer;
+        }
+    }
+
+    return usbWrapper_.allocTransfer(0);
+}
+
+void USBEndpoint::releaseTransfer(libusb_transfer* transfer)
+{
+    {
+        std::lock_guard<decltype(transferPoolMutex_)> lock(transferPoolMutex_);
+
+        if(transferPool_.size() < transferPoolSize_)
+        {
+            transferPool_.push_back(transfer);
+            return;
+        }
+    }
+
+    usbWrapper_.freeTransfer(transfer);
+}
+
+USBEndpoint::TransferSlots::iterator USBEndpoint::findSlot(const libusb_transfer* transfer)
+{
+    return std::find_if(transferSlots_.begin(), transferSlots_.end(), [transfer](const TransferSlot& slot) { return slot.transfer == transfer; });
+}
+
 }
 }
 }
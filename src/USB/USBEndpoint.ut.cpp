@@ -288,6 +288,90 @@ BOOST_FIXTURE_TEST_CASE(USBEndpoint_BulkTransferFailed, USBEndpointUnitTest)
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(USBEndpoint_PooledTransfersAreReused, USBEndpointUnitTest)
+{
+    const uint8_t endpointAddress = 0x55;
+    const size_t transferPoolSize = 1;
+    USBEndpoint::Pointer usbEndpoint(std::make_shared<USBEndpoint>(usbWrapperMock_, ioService_, deviceHandle_, endpointAddress, transferPoolSize));
+
+    libusb_transfer transfer;
+    EXPECT_CALL(usbWrapperMock_, allocTransfer(0)).WillOnce(Return(&transfer));
+    EXPECT_CALL(usbWrapperMock_, submitTransfer(&transfer)).Times(2);
+    EXPECT_CALL(usbWrapperMock_, freeTransfer(_)).Times(0);
+
+    libusb_transfer_cb_fn transferCallback;
+    common::Data data(1000, 0);
+    common::DataBuffer buffer(data);
+    EXPECT_CALL(usbWrapperMock_, fillBulkTransfer(&transfer, _, endpointAddress, buffer.data, buffer.size, _, _, _))
+            .Times(2).WillRepeatedly(DoAll(SaveArg<5>(&transferCallback), SaveArg<6>(&transfer.user_data)));
+    EXPECT_CALL(promiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(promiseHandlerMock_, onResolve(buffer.size)).Times(2);
+
+    for(size_t i = 0; i < 2; ++i)
+    {
+        auto promise = IUSBEndpoint::Promise::defer(ioService_);
+        promise->then(std::bind(&USBEndpointPromiseHandlerMock::onResolve, &promiseHandlerMock_, std::placeholders::_1),
+                      std::bind(&USBEndpointPromiseHandlerMock::onReject, &promiseHandlerMock_, std::placeholders::_1));
+
+        usbEndpoint->bulkTransfer(common::DataBuffer(data), 0, std::move(promise));
+        ioService_.run();
+        ioService_.reset();
+
+        transfer.actual_length = buffer.size;
+        transfer.status = LIBUSB_TRANSFER_COMPLETED;
+        transferCallback(&transfer);
+        ioService_.run();
+        ioService_.reset();
+    }
+
+    ::testing::Mock::VerifyAndClearExpectations(&usbWrapperMock_);
+    EXPECT_CALL(usbWrapperMock_, freeTransfer(&transfer));
+    usbEndpoint.reset();
+}
+
+BOOST_FIXTURE_TEST_CASE(USBEndpoint_TransfersBeyondPoolSizeAreFreed, USBEndpointUnitTest)
+{
+    const uint8_t endpointAddress = 0x55;
+    const size_t transferPoolSize = 1;
+    USBEndpoint::Pointer usbEndpoint(std::make_shared<USBEndpoint>(usbWrapperMock_, ioService_, deviceHandle_, endpointAddress, transferPoolSize));
+
+    libusb_transfer transfer1;
+    libusb_transfer transfer2;
+    EXPECT_CALL(usbWrapperMock_, allocTransfer(0)).WillOnce(Return(&transfer1)).WillOnce(Return(&transfer2));
+    EXPECT_CALL(usbWrapperMock_, submitTransfer(_)).Times(2);
+
+    libusb_transfer_cb_fn transferCallback;
+    common::Data data(1000, 0);
+    EXPECT_CALL(usbWrapperMock_, fillBulkTransfer(&transfer1, _, endpointAddress, _, _, _, _, _))
+            .WillOnce(DoAll(SaveArg<5>(&transferCallback), SaveArg<6>(&transfer1.user_data)));
+    EXPECT_CALL(usbWrapperMock_, fillBulkTransfer(&transfer2, _, endpointAddress, _, _, _, _, _))
+            .WillOnce(SaveArg<6>(&transfer2.user_data));
+
+    auto promise2 = IUSBEndpoint::Promise::defer(ioService_);
+    promise2->then(std::bind(&USBEndpointPromiseHandlerMock::onResolve, &promiseHandlerMock_, std::placeholders::_1),
+                   std::bind(&USBEndpointPromiseHandlerMock::onReject, &promiseHandlerMock_, std::placeholders::_1));
+
+    usbEndpoint->bulkTransfer(common::DataBuffer(data), 0, std::move(promise_));
+    usbEndpoint->bulkTransfer(common::DataBuffer(data), 0, std::move(promise2));
+    ioService_.run();
+    ioService_.reset();
+
+    EXPECT_CALL(promiseHandlerMock_, onReject(_)).Times(0);
+    EXPECT_CALL(promiseHandlerMock_, onResolve(data.size())).Times(2);
+    EXPECT_CALL(usbWrapperMock_, freeTransfer(&transfer2));
+    EXPECT_CALL(usbWrapperMock_, freeTransfer(&transfer1));
+
+    transfer1.actual_length = data.size();
+    transfer1.status = LIBUSB_TRANSFER_COMPLETED;
+    transferCallback(&transfer1);
+    transfer2.actual_length = data.size();
+    transfer2.status = LIBUSB_TRANSFER_COMPLETED;
+    transferCallback(&transfer2);
+    ioService_.run();
+
+    usbEndpoint.reset();
+}
+
 }
 }
 }
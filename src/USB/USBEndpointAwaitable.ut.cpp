@@ -0,0 +1,130 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifdef AASDK_COROUTINES
+
+#include <future>
+#include <thread>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/USB/UT/USBEndpoint.mock.hpp>
+#include <f1x/aasdk/USB/USBEndpointAwaitable.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+namespace ut
+{
+
+using ::testing::Invoke;
+using ::testing::SaveArg;
+using ::testing::_;
+
+class USBEndpointAwaitableUnitTest
+{
+protected:
+    USBEndpointAwaitableUnitTest()
+        : strand_(ioService_)
+        , buffer_(bufferData_, sizeof(bufferData_))
+    {
+
+    }
+
+    io::Task bulkTransfer(std::promise<size_t>& transferred)
+    {
+        try
+        {
+            transferred.set_value(co_await asyncBulkTransfer(usbEndpointMock_, buffer_, 1000, strand_));
+        }
+        catch(const error::Error& e)
+        {
+            error_ = e;
+            transferred.set_value(0);
+        }
+    }
+
+    boost::asio::io_service ioService_;
+    boost::asio::io_service::strand strand_;
+    USBEndpointMock usbEndpointMock_;
+    uint8_t bufferData_[64];
+    common::DataBuffer buffer_;
+    error::Error error_;
+};
+
+BOOST_FIXTURE_TEST_CASE(USBEndpointAwaitable_BulkTransfer, USBEndpointAwaitableUnitTest)
+{
+    IUSBEndpoint::Promise::Pointer transferPromise;
+    EXPECT_CALL(usbEndpointMock_, bulkTransfer(_, 1000, _)).WillOnce(SaveArg<2>(&transferPromise));
+
+    std::promise<size_t> transferred;
+    this->bulkTransfer(transferred);
+    BOOST_TEST(transferPromise != nullptr);
+
+    transferPromise->resolve(64);
+    ioService_.run();
+
+    BOOST_TEST(transferred.get_future().get() == 64u);
+    BOOST_CHECK(error_ == error::Error());
+}
+
+BOOST_FIXTURE_TEST_CASE(USBEndpointAwaitable_ResolvedFromAnotherThreadBeforeInitiatorReturns, USBEndpointAwaitableUnitTest)
+{
+    boost::asio::io_service::work work(ioService_);
+    std::thread worker([this]() { ioService_.run(); });
+
+    std::promise<size_t> transferred;
+    auto transferredFuture = transferred.get_future().share();
+
+    // the completion resumes the coroutine on the worker, which finishes while bulkTransfer() is still running
+    EXPECT_CALL(usbEndpointMock_, bulkTransfer(_, 1000, _)).WillOnce(Invoke([&](common::DataBuffer, uint32_t, IUSBEndpoint::Promise::Pointer promise) {
+        promise->resolve(32);
+        transferredFuture.wait_for(std::chrono::seconds(5));
+    }));
+
+    this->bulkTransfer(transferred);
+
+    BOOST_TEST((transferredFuture.wait_for(std::chrono::seconds(5)) == std::future_status::ready));
+    BOOST_TEST(transferredFuture.get() == 32u);
+
+    ioService_.stop();
+    worker.join();
+}
+
+BOOST_FIXTURE_TEST_CASE(USBEndpointAwaitable_RejectThrows, USBEndpointAwaitableUnitTest)
+{
+    IUSBEndpoint::Promise::Pointer transferPromise;
+    EXPECT_CALL(usbEndpointMock_, bulkTransfer(_, _, _)).WillOnce(SaveArg<2>(&transferPromise));
+
+    std::promise<size_t> transferred;
+    this->bulkTransfer(transferred);
+
+    const error::Error expectedError(error::ErrorCode::USB_TRANSFER, 4);
+    transferPromise->reject(expectedError);
+    ioService_.run();
+
+    BOOST_CHECK(error_ == expectedError);
+}
+
+}
+}
+}
+}
+
+#endif
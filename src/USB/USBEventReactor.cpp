@@ -0,0 +1,192 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <poll.h>
+#include <f1x/aasdk/USB/USBEventReactor.hpp>
+#include <f1x/aasdk/Common/Log.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+
+USBEventReactor::USBEventReactor(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService)
+    : usbWrapper_(usbWrapper)
+    , strand_(ioService)
+    , timer_(ioService)
+    , started_(false)
+{
+
+}
+
+USBEventReactor::USBEventReactor(IUSBWrapper& usbWrapper, boost::asio::io_service::strand& strand)
+    : usbWrapper_(usbWrapper)
+    , strand_(strand)
+    , timer_(strand.context())
+    , started_(false)
+{
+
+}
+
+void USBEventReactor::start()
+{
+    strand_.dispatch([this, self = this->shared_from_this()]() mutable {
+        if(started_)
+        {
+            return;
+        }
+
+        started_ = true;
+        usbWrapper_.setPollfdNotifiers(&USBEventReactor::pollfdAddedHandler, &USBEventReactor::pollfdRemovedHandler, this);
+
+        for(const auto& pollfd : usbWrapper_.getPollfds())
+        {
+            this->addPollfd(pollfd.fd, pollfd.events);
+        }
+
+        this->handleEvents();
+    });
+}
+
+void USBEventReactor::stop()
+{
+    strand_.dispatch([this, self = this->shared_from_this()]() mutable {
+        if(!started_)
+        {
+            return;
+        }
+
+        started_ = false;
+        usbWrapper_.setPollfdNotifiers(nullptr, nullptr, nullptr);
+        timer_.cancel();
+
+        for(auto& descriptor : descriptors_)
+        {
+            boost::system::error_code ec;
+            descriptor.second->cancel(ec);
+            // the file descriptor is owned by libusb
+            descriptor.second->release();
+        }
+
+        descriptors_.clear();
+    });
+}
+
+void USBEventReactor::addPollfd(int fd, short events)
+{
+    this->removePollfd(fd);
+
+    auto descriptor = std::make_shared<boost::asio::posix::stream_descriptor>(strand_.context(), fd);
+    descriptors_.emplace(fd, descriptor);
+    AASDK_LOG(debug) << "[USBEventReactor] watching fd: " << fd << ", events: " << events;
+
+    if((events & POLLIN) != 0)
+    {
+        this->waitForEvent(descriptor, boost::asio::posix::stream_descriptor::wait_read);
+    }
+
+    if((events & POLLOUT) != 0)
+    {
+        this->waitForEvent(descriptor, boost::asio::posix::stream_descriptor::wait_write);
+    }
+}
+
+void USBEventReactor::removePollfd(int fd)
+{
+    auto it = descriptors_.find(fd);
+
+    if(it != descriptors_.end())
+    {
+        boost::system::error_code ec;
+        it->second->cancel(ec);
+        it->second->release();
+        descriptors_.erase(it);
+    }
+}
+
+void USBEventReactor::waitForEvent(Descriptor descriptor, boost::asio::posix::stream_descriptor::wait_type waitType)
+{
+    descriptor->async_wait(waitType, strand_.wrap([this, self = this->shared_from_this(), descriptor, waitType](const boost::system::error_code& e) mutable {
+        const auto it = descriptors_.find(descriptor->native_handle());
+
+        // descriptor was removed (and possibly its number reused) while waiting
+        if(e || it == descriptors_.end() || it->second != descriptor)
+        {
+            return;
+        }
+
+        this->handleEvents();
+
+        if(started_ && descriptors_.find(descriptor->native_handle()) != descriptors_.end())
+        {
+            this->waitForEvent(std::move(descriptor), waitType);
+        }
+    }));
+}
+
+void USBEventReactor::handleEvents()
+{
+    timeval zeroTimeout{0, 0};
+    usbWrapper_.handleEventsTimeout(&zeroTimeout);
+    this->scheduleTimeout();
+}
+
+void USBEventReactor::scheduleTimeout()
+{
+    if(!started_ || usbWrapper_.pollfdsHandleTimeouts())
+    {
+        return;
+    }
+
+    timeval timeout{0, 0};
+    if(usbWrapper_.getNextTimeout(&timeout) == 1)
+    {
+        timer_.expires_from_now(std::chrono::seconds(timeout.tv_sec) + std::chrono::microseconds(timeout.tv_usec));
+        timer_.async_wait(strand_.wrap([this, self = this->shared_from_this()](const boost::system::error_code& e) mutable {
+            if(!e && started_)
+            {
+                this->handleEvents();
+            }
+        }));
+    }
+}
+
+void USBEventReactor::pollfdAddedHandler(int fd, short events, void* userData)
+{
+    auto self = reinterpret_cast<USBEventReactor*>(userData)->shared_from_this();
+    self->strand_.dispatch([self, fd, events]() mutable {
+        if(self->started_)
+        {
+            self->addPollfd(fd, events);
+        }
+    });
+}
+
+void USBEventReactor::pollfdRemovedHandler(int fd, void* userData)
+{
+    auto self = reinterpret_cast<USBEventReactor*>(userData)->shared_from_this();
+    self->strand_.dispatch([self, fd]() mutable {
+        self->removePollfd(fd);
+    });
+}
+
+}
+}
+}
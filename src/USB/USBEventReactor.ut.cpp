@@ -0,0 +1,134 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <poll.h>
+#include <unistd.h>
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/USB/UT/USBWrapper.mock.hpp>
+#include <f1x/aasdk/USB/USBEventReactor.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+namespace ut
+{
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::Return;
+using ::testing::SaveArg;
+using ::testing::SetArgPointee;
+using ::testing::DoAll;
+
+class USBEventReactorUnitTest
+{
+protected:
+    USBEventReactorUnitTest()
+    {
+        BOOST_REQUIRE(pipe(pipe_) == 0);
+    }
+
+    ~USBEventReactorUnitTest()
+    {
+        close(pipe_[0]);
+        close(pipe_[1]);
+    }
+
+    boost::asio::io_service ioService_;
+    USBWrapperMock usbWrapperMock_;
+    int pipe_[2];
+};
+
+BOOST_FIXTURE_TEST_CASE(USBEventReactor_HandleEventsWhenPollfdIsReadable, USBEventReactorUnitTest)
+{
+    auto reactor = std::make_shared<USBEventReactor>(usbWrapperMock_, ioService_);
+
+    libusb_pollfd pollfd{pipe_[0], POLLIN};
+    EXPECT_CALL(usbWrapperMock_, setPollfdNotifiers(_, _, reactor.get()));
+    EXPECT_CALL(usbWrapperMock_, getPollfds()).WillOnce(Return(PollfdList{pollfd}));
+    EXPECT_CALL(usbWrapperMock_, pollfdsHandleTimeouts()).WillRepeatedly(Return(true));
+    EXPECT_CALL(usbWrapperMock_, handleEventsTimeout(_)).WillOnce(Return(0));
+
+    reactor->start();
+    ioService_.poll();
+    ioService_.reset();
+
+    const char byte = 0x5E;
+    BOOST_REQUIRE(write(pipe_[1], &byte, 1) == 1);
+
+    EXPECT_CALL(usbWrapperMock_, handleEventsTimeout(_)).WillOnce(Invoke([this](timeval* tv) {
+        BOOST_TEST(tv->tv_sec == 0);
+        BOOST_TEST(tv->tv_usec == 0);
+
+        char readByte = 0;
+        BOOST_TEST(read(pipe_[0], &readByte, 1) == 1);
+        return 0;
+    }));
+    ioService_.run_one();
+    ioService_.reset();
+
+    EXPECT_CALL(usbWrapperMock_, setPollfdNotifiers(nullptr, nullptr, nullptr));
+    reactor->stop();
+    ioService_.run();
+}
+
+BOOST_FIXTURE_TEST_CASE(USBEventReactor_HandleEventsOnLibusbTimeout, USBEventReactorUnitTest)
+{
+    auto reactor = std::make_shared<USBEventReactor>(usbWrapperMock_, ioService_);
+
+    libusb_pollfd_added_cb addedCallback = nullptr;
+    EXPECT_CALL(usbWrapperMock_, setPollfdNotifiers(_, _, reactor.get())).WillOnce(SaveArg<0>(&addedCallback));
+    EXPECT_CALL(usbWrapperMock_, getPollfds()).WillOnce(Return(PollfdList()));
+    EXPECT_CALL(usbWrapperMock_, pollfdsHandleTimeouts()).WillRepeatedly(Return(false));
+
+    timeval timeout{0, 1000};
+    EXPECT_CALL(usbWrapperMock_, getNextTimeout(_)).WillOnce(DoAll(SetArgPointee<0>(timeout), Return(1))).WillRepeatedly(Return(0));
+    EXPECT_CALL(usbWrapperMock_, handleEventsTimeout(_)).Times(2).WillRepeatedly(Return(0));
+
+    reactor->start();
+    ioService_.run();
+    ioService_.reset();
+
+    // fds announced by libusb after start are watched as well
+    BOOST_REQUIRE(addedCallback != nullptr);
+    addedCallback(pipe_[0], POLLIN, reactor.get());
+    ioService_.poll();
+    ioService_.reset();
+
+    const char byte = 0x5E;
+    BOOST_REQUIRE(write(pipe_[1], &byte, 1) == 1);
+    EXPECT_CALL(usbWrapperMock_, handleEventsTimeout(_)).WillOnce(Invoke([this](timeval*) {
+        char readByte = 0;
+        BOOST_TEST(read(pipe_[0], &readByte, 1) == 1);
+        return 0;
+    }));
+    ioService_.run_one();
+    ioService_.reset();
+
+    EXPECT_CALL(usbWrapperMock_, setPollfdNotifiers(nullptr, nullptr, nullptr));
+    reactor->stop();
+    ioService_.run();
+}
+
+}
+}
+}
+}
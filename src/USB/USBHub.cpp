@@ -16,7 +16,6 @@
 *  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
 */
 
-#include <thread>
 #include <f1x/aasdk/USB/IUSBWrapper.hpp>
 #include <f1x/aasdk/USB/USBHub.hpp>
 #include <f1x/aasdk/USB/AccessoryModeQueryChain.hpp>
@@ -29,10 +28,14 @@ namespace aasdk
 namespace usb
 {
 
-USBHub::USBHub(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, IAccessoryModeQueryChainFactory& queryChainFactory)
+constexpr std::chrono::milliseconds USBHub::cDefaultDeviceSettleDelay;
+
+USBHub::USBHub(IUSBWrapper& usbWrapper, boost::asio::io_service& ioService, IAccessoryModeQueryChainFactory& queryChainFactory,
+               std::chrono::milliseconds deviceSettleDelay)
     : usbWrapper_(usbWrapper)
     , strand_(ioService)
     , queryChainFactory_(queryChainFactory)
+    , deviceSettleDelay_(deviceSettleDelay)
 {
 }
 
@@ -66,6 +69,7 @@ void USBHub::cancel()
         }
 
         std::for_each(queryChainQueue_.begin(), queryChainQueue_.end(), std::bind(&IAccessoryModeQueryChain::cancel, std::placeholders::_1));
+        std::for_each(settleTimers_.begin(), settleTimers_.end(), [](const SettleTimers::value_type& timer) { timer->cancel(); });
 
         if(self_ != nullptr)
         {
@@ -118,27 +122,43 @@ void USBHub::handleDevice(libusb_device* device)
         hotplugPromise_->resolve(std::move(handle));
         hotplugPromise_.reset();
     }
+    else if(deviceSettleDelay_.count() == 0)
+    {
+        this->queryDevice(std::move(handle));
+    }
     else
     {
-        ////////// Workaround for VMware
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
-        //////////
-
-        queryChainQueue_.emplace_back(queryChainFactory_.create());
-
-        auto queueElementIter = std::prev(queryChainQueue_.end());
-        auto queryChainPromise = IAccessoryModeQueryChain::Promise::defer(strand_);
-        queryChainPromise->then([this, self = this->shared_from_this(), queueElementIter](DeviceHandle handle) mutable {
-                queryChainQueue_.erase(queueElementIter);
-            },
-            [this, self = this->shared_from_this(), queueElementIter](const error::Error& e) mutable {
-                queryChainQueue_.erase(queueElementIter);
-            });
-
-        queryChainQueue_.back()->start(std::move(handle), std::move(queryChainPromise));
+        // let the device settle without blocking the strand, other devices are handled meanwhile
+        settleTimers_.emplace_back(std::make_shared<boost::asio::steady_timer>(strand_.context(), deviceSettleDelay_));
+
+        auto timerIter = std::prev(settleTimers_.end());
+        (*timerIter)->async_wait(strand_.wrap([this, self = this->shared_from_this(), timerIter, handle = std::move(handle)](const boost::system::error_code& e) mutable {
+            settleTimers_.erase(timerIter);
+
+            if(e != boost::asio::error::operation_aborted && hotplugPromise_ != nullptr)
+            {
+                this->queryDevice(std::move(handle));
+            }
+        }));
     }
 }
 
+void USBHub::queryDevice(DeviceHandle handle)
+{
+    queryChainQueue_.emplace_back(queryChainFactory_.create());
+
+    auto queueElementIter = std::prev(queryChainQueue_.end());
+    auto queryChainPromise = IAccessoryModeQueryChain::Promise::defer(strand_);
+    queryChainPromise->then([this, self = this->shared_from_this(), queueElementIter](DeviceHandle handle) mutable {
+            queryChainQueue_.erase(queueElementIter);
+        },
+        [this, self = this->shared_from_this(), queueElementIter](const error::Error& e) mutable {
+            queryChainQueue_.erase(queueElementIter);
+        });
+
+    queryChainQueue_.back()->start(std::move(handle), std::move(queryChainPromise));
+}
+
 }
 }
 }
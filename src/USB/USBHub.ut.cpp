@@ -238,6 +238,38 @@ BOOST_FIXTURE_TEST_CASE(USBHub_CancelAllQueryChains, USBHubUnitTest)
     ioService_.run();
 }
 
+BOOST_FIXTURE_TEST_CASE(USBHub_CancelDuringDeviceSettleDelay, USBHubUnitTest)
+{
+    void* userData = nullptr;
+    EXPECT_CALL(usbWrapperMock_, hotplugRegisterCallback(LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED, LIBUSB_HOTPLUG_NO_FLAGS,
+                                                         LIBUSB_HOTPLUG_MATCH_ANY, LIBUSB_HOTPLUG_MATCH_ANY,
+                                                         LIBUSB_HOTPLUG_MATCH_ANY, _, _))
+            .WillOnce(DoAll(SaveArg<5>(&hotplugCallback_), SaveArg<6>(&userData), Return(hotplugCallbackHandle_)));
+
+    USBHub::Pointer usbHub(std::make_shared<USBHub>(usbWrapperMock_, ioService_, queryChainFactoryMock_, std::chrono::hours(1)));
+    usbHub->start(std::move(promise_));
+
+    ioService_.run();
+    ioService_.reset();
+
+    libusb_device_descriptor connectedDeviceDescriptor = {0};
+    connectedDeviceDescriptor.idVendor = 123;
+    connectedDeviceDescriptor.idProduct = 456;
+
+    EXPECT_CALL(usbWrapperMock_, getDeviceDescriptor(device_, _)).WillOnce(DoAll(SetArgReferee<1>(connectedDeviceDescriptor), Return(0)));
+    EXPECT_CALL(usbWrapperMock_, open(device_, _)).WillOnce(DoAll(SetArgReferee<1>(deviceHandle_), Return(0)));
+    EXPECT_CALL(queryChainFactoryMock_, create()).Times(0);
+
+    hotplugCallback_(nullptr, device_, LIBUSB_HOTPLUG_EVENT_DEVICE_ARRIVED, userData);
+    ioService_.poll();
+    ioService_.reset();
+
+    EXPECT_CALL(promiseHandlerMock_, onResolve(_)).Times(0);
+    EXPECT_CALL(promiseHandlerMock_, onReject(error::Error(error::ErrorCode::OPERATION_ABORTED)));
+    usbHub->cancel();
+    ioService_.run();
+}
+
 }
 }
 }
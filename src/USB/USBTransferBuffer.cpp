@@ -0,0 +1,67 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <f1x/aasdk/USB/USBTransferBuffer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+
+USBTransferBuffer::USBTransferBuffer(IUSBWrapper& usbWrapper, DeviceHandle handle, size_t size)
+    : usbWrapper_(usbWrapper)
+    , handle_(std::move(handle))
+    , size_(size)
+    , deviceMemory_(usbWrapper_.devMemAlloc(handle_, size_))
+{
+    if(deviceMemory_ == nullptr)
+    {
+        fallbackMemory_.resize(size_);
+    }
+}
+
+USBTransferBuffer::~USBTransferBuffer()
+{
+    if(deviceMemory_ != nullptr)
+    {
+        usbWrapper_.devMemFree(handle_, deviceMemory_, size_);
+    }
+}
+
+common::DataBuffer USBTransferBuffer::getBuffer(size_t size)
+{
+    const auto bufferSize = size == 0 ? size_ : std::min(size, size_);
+    return deviceMemory_ != nullptr ? common::DataBuffer(deviceMemory_, bufferSize) : common::DataBuffer(fallbackMemory_.data(), bufferSize);
+}
+
+size_t USBTransferBuffer::getSize() const
+{
+    return size_;
+}
+
+bool USBTransferBuffer::isDeviceMemory() const
+{
+    return deviceMemory_ != nullptr;
+}
+
+}
+}
+}
@@ -0,0 +1,81 @@
+/*
+*  This file is part of aasdk library project.
+*  Copyright (C) 2018 f1x.studio (Michal Szwaj)
+*
+*  aasdk is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation; either version 3 of the License, or
+*  (at your option) any later version.
+
+*  aasdk is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with aasdk. If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <boost/test/unit_test.hpp>
+#include <f1x/aasdk/USB/UT/USBWrapper.mock.hpp>
+#include <f1x/aasdk/USB/USBTransferBuffer.hpp>
+
+namespace f1x
+{
+namespace aasdk
+{
+namespace usb
+{
+namespace ut
+{
+
+using ::testing::_;
+using ::testing::Return;
+
+class USBTransferBufferUnitTest
+{
+protected:
+    USBTransferBufferUnitTest()
+        : deviceHandle_(reinterpret_cast<libusb_device_handle*>(&dummyDeviceHandle_), [](auto*) {})
+    {
+
+    }
+
+    USBWrapperMock usbWrapperMock_;
+    USBWrapperMock::DummyDeviceHandle dummyDeviceHandle_;
+    DeviceHandle deviceHandle_;
+};
+
+BOOST_FIXTURE_TEST_CASE(USBTransferBuffer_DeviceMemory, USBTransferBufferUnitTest)
+{
+    common::Data deviceMemory(1024);
+    EXPECT_CALL(usbWrapperMock_, devMemAlloc(deviceHandle_, deviceMemory.size())).WillOnce(Return(deviceMemory.data()));
+
+    {
+        USBTransferBuffer transferBuffer(usbWrapperMock_, deviceHandle_, deviceMemory.size());
+        BOOST_TEST(transferBuffer.isDeviceMemory());
+        BOOST_TEST(transferBuffer.getSize() == deviceMemory.size());
+        BOOST_CHECK(transferBuffer.getBuffer().data == deviceMemory.data());
+        BOOST_TEST(transferBuffer.getBuffer().size == deviceMemory.size());
+        BOOST_TEST(transferBuffer.getBuffer(100).size == 100u);
+        BOOST_TEST(transferBuffer.getBuffer(4096).size == deviceMemory.size());
+
+        EXPECT_CALL(usbWrapperMock_, devMemFree(deviceHandle_, deviceMemory.data(), deviceMemory.size())).WillOnce(Return(0));
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(USBTransferBuffer_FallbackToHeapMemory, USBTransferBufferUnitTest)
+{
+    EXPECT_CALL(usbWrapperMock_, devMemAlloc(deviceHandle_, 1024)).WillOnce(Return(nullptr));
+    EXPECT_CALL(usbWrapperMock_, devMemFree(_, _, _)).Times(0);
+
+    USBTransferBuffer transferBuffer(usbWrapperMock_, deviceHandle_, 1024);
+    BOOST_TEST(!transferBuffer.isDeviceMemory());
+    BOOST_CHECK(transferBuffer.getBuffer().data != nullptr);
+    BOOST_TEST(transferBuffer.getBuffer().size == 1024u);
+}
+
+}
+}
+}
+}
@@ -153,6 +153,51 @@ void USBWrapper::handleEvents()
     libusb_handle_events(usbContext_);
 }
 
+void USBWrapper::interruptEventHandler()
+{
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+    libusb_interrupt_event_handler(usbContext_);
+#endif
+}
+
+int USBWrapper::handleEventsTimeout(timeval* tv)
+{
+    return libusb_handle_events_timeout_completed(usbContext_, tv, nullptr);
+}
+
+PollfdList USBWrapper::getPollfds()
+{
+    PollfdList pollfds;
+    const libusb_pollfd** rawPollfds = libusb_get_pollfds(usbContext_);
+
+    if(rawPollfds != nullptr)
+    {
+        for(auto pollfd = rawPollfds; *pollfd != nullptr; ++pollfd)
+        {
+            pollfds.push_back(**pollfd);
+        }
+
+        libusb_free_pollfds(rawPollfds);
+    }
+
+    return pollfds;
+}
+
+void USBWrapper::setPollfdNotifiers(libusb_pollfd_added_cb added_cb, libusb_pollfd_removed_cb removed_cb, void* user_data)
+{
+    libusb_set_pollfd_notifiers(usbContext_, added_cb, removed_cb, user_data);
+}
+
+int USBWrapper::getNextTimeout(timeval* tv)
+{
+    return libusb_get_next_timeout(usbContext_, tv);
+}
+
+bool USBWrapper::pollfdsHandleTimeouts()
+{
+    return libusb_pollfds_handle_timeouts(usbContext_) != 0;
+}
+
 HotplugCallbackHandle USBWrapper::hotplugRegisterCallback(libusb_hotplug_event events, libusb_hotplug_flag flags, int vendor_id, int product_id, int dev_class,
                                                           libusb_hotplug_callback_fn cb_fn, void *user_data)
 {
@@ -168,6 +213,24 @@ libusb_transfer* USBWrapper::allocTransfer(int iso_packets)
     return libusb_alloc_transfer(iso_packets);
 }
 
+unsigned char* USBWrapper::devMemAlloc(const DeviceHandle& dev_handle, size_t length)
+{
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+    return libusb_dev_mem_alloc(dev_handle.get(), length);
+#else
+    return nullptr;
+#endif
+}
+
+int USBWrapper::devMemFree(const DeviceHandle& dev_handle, unsigned char* buffer, size_t length)
+{
+#if defined(LIBUSB_API_VERSION) && (LIBUSB_API_VERSION >= 0x01000105)
+    return libusb_dev_mem_free(dev_handle.get(), buffer, length);
+#else
+    return LIBUSB_ERROR_NOT_SUPPORTED;
+#endif
+}
+
 }
 }
 }